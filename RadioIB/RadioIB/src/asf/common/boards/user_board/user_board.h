@@ -1,17 +1,17 @@
-/**
- * \file
- *
- * \brief User board definition template
- *
- */
-
-#ifndef USER_BOARD_H
-#define USER_BOARD_H
-
-/* This file is intended to contain definitions and configuration details for
- * features and devices that are available on the board, e.g., frequency and
- * startup time for an external crystal, external memory devices, LED and USART
- * pins.
- */
-
-#endif // USER_BOARD_H
+/**
+ * \file
+ *
+ * \brief User board definition template
+ *
+ */
+
+#ifndef USER_BOARD_H
+#define USER_BOARD_H
+
+/* This file is intended to contain definitions and configuration details for
+ * features and devices that are available on the board, e.g., frequency and
+ * startup time for an external crystal, external memory devices, LED and USART
+ * pins.
+ */
+
+#endif // USER_BOARD_H
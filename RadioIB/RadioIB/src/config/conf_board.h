@@ -1,41 +1,51 @@
-/**
- * \file
- *
- * \brief User board configuration template
- *
- */
-
-#ifndef CONF_BOARD_H
-#define CONF_BOARD_H
-
-/** Define which Radio IB this is	*/
-#define RADIO_IB_1
-//#define RADIO_IB_2
-
-/** Define DEBUG to run debug task only (when debugging on STK600)	*/
-#define DEBUG
-
-// VCP Addresses. Make permanent change in vcp library !
-#ifdef RADIO_IB_1
-	#define VCP_RADIOIB		0x0C			
-	#define VCP_RADIO		VCP_RADIO_1	
-	#define VCP_CDHIB		VCP_CDHIB_1
-#else
-	#define VCP_RADIOIB		0x0D
-	#define VCP_RADIO		VCP_RADIO_2
-	#define VCP_CDHIB		VCP_CDHIB_2
-#endif
-	
-
-// User declarations:
-//extern Bool xosc_recovey;
-
-// User functions:
-void clock_init				(void); // in init.c
-void switch_to_ext_osc		(void); // in init.c
-void timers_init			(void); // in init.c
-void interrupts_init		(void); // in init.c
-void usart_init				(void); // in init.c
-void io_init				(void); // in init.c
-
-#endif // CONF_BOARD_H
+/**
+ * \file
+ *
+ * \brief User board configuration template
+ *
+ */
+
+#ifndef CONF_BOARD_H
+#define CONF_BOARD_H
+
+/** Define which Radio IB this is	*/
+#define RADIO_IB_1
+//#define RADIO_IB_2
+
+/** Define DEBUG to run debug task only (when debugging on STK600). Never for the POSIX backend (HAL_POSIX)	*/
+#ifndef HAL_POSIX
+	#define DEBUG
+#endif
+
+/** Define DEBUG_CLOCK_OUT to output the CPU clock on PD7 (STK600). PD7 is the radio external event input otherwise	*/
+//#define DEBUG_CLOCK_OUT
+
+/** Define RX_CAPTURE to log every byte received from the radio and the CDHIB with its arrival time (debug/rx_capture.h)	*/
+//#define RX_CAPTURE
+
+// VCP Addresses. Make permanent change in vcp library !
+#ifdef RADIO_IB_1
+	#define VCP_RADIOIB		VCP_RADIOIB_1
+	#define VCP_RADIO		VCP_RADIO_1	
+	#define VCP_CDHIB		VCP_CDHIB_1
+#else
+	#define VCP_RADIOIB		VCP_RADIOIB_2
+	#define VCP_RADIO		VCP_RADIO_2
+	#define VCP_CDHIB		VCP_CDHIB_2
+#endif
+	
+
+// User declarations:
+//extern Bool xosc_recovey;
+
+// User functions:
+void boot_clock_init			(void); // in init.c
+void clock_init				(void); // in init.c
+void clock_init_rc32m			(void); // in init.c
+void switch_to_ext_osc		(void); // in init.c
+void timers_init			(void); // in init.c
+void interrupts_init		(void); // in init.c
+void usart_init				(void); // in init.c
+void io_init				(void); // in init.c
+
+#endif // CONF_BOARD_H
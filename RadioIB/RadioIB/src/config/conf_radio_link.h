@@ -0,0 +1,47 @@
+/** \file
+ * conf_radio_link.h
+ *
+ * \brief Radio link configuration
+ *
+ *	Selective repeat ARQ (radio/arq.c) and frame compression (radio/lzss.c) on the radio link.
+ *	This file is also used by the host tools - defines only.
+ *	The RTO must be longer than a full frame on the air plus the round trip,
+ *	the NAK holdoff about one round trip (see host/arq_sim for the air rate used here).
+ *
+ */ 
+
+
+#ifndef _CONF_RADIO_LINK_H_
+#define _CONF_RADIO_LINK_H_
+
+#define ARQ_WINDOW				8			///< Frames in flight per direction. Power of 2, 2 to 16. Window RAM is about 2 x 130 bytes per frame
+#define ARQ_MAX_PAYLOAD			120			///< Max payload per frame. Escaped frame must fit in RADIO_TRANSMIT_MESSAGE_BUFF_SIZE
+#define ARQ_RTO_MS				400			///< Retransmit timeout in ms (default, can be changed at run time)
+#define ARQ_NAK_HOLDOFF_MS		200			///< Min time between a transmission and its NAK retransmission, in ms
+#define ARQ_MAX_RETRIES			8			///< Retransmissions before a frame is given up
+
+#define FLOW_HIGH_WATER			(ARQ_WINDOW - 2)	///< Frames waiting for the radio that throttle the CDHIB (0 credits)
+#define FLOW_LOW_WATER			2			///< Frames waiting for the radio that release the CDHIB
+
+#define RADIO_COMPRESSION		1			///< Compress frames to the radio (radio/lzss.c), 0 to send them as they are
+#define RADIO_REFERENCE_INTERVAL	16		///< Frames compressed against one reference payload before a new one is picked
+#define LZSS_MAX_INPUT			ARQ_MAX_PAYLOAD	///< Largest frame the compressor takes (below 128)
+#define LZSS_MAX_CHAIN			8			///< Match candidates tried per position - speed vs. ratio
+
+#define RADIO_PACING_RATE		960			///< Radio air rate in bytes per second (9600 bps), for the transmit token bucket. 0 - no pacing
+#define RADIO_PACING_BURST		256			///< Radio transmit buffer size in bytes - the most sent ahead of the air rate
+
+#define RADIO_RESET_ACTIVE_LOW	1			///< Radio reset pin (PD4) is active low
+#define RADIO_RESET_PULSE_MS	10			///< Radio reset pulse length, in ms
+#define RADIO_BOOT_MS			100			///< Time for the radio to start after a reset, in ms. Transmissions are held meanwhile
+#define RADIO_CONFIG_DEFAULT	0			///< Radio configuration pins (PD5 bit 0, PD6 bit 1) at power up
+
+#define RADIO_STORE				1			///< Keep frames for the radio while out of contact and send them on the next pass (radio/store.c)
+#define STORE_PAGES				16			///< Store-and-forward pages (RAM). Below 255
+#define STORE_PAGE_SIZE			256			///< Store-and-forward page size in bytes
+#define STORE_CLASSES			4			///< Data classes - class 0 is sent first and dropped last
+
+#define RADIO_FEC				0			///< Reed-Solomon FEC blocks on the radio downlink (radio/fec.c), decoded on the ground by host/fec_decode.
+											///< Adds 36 bytes per block of up to 223 - raise ARQ_RTO_MS to cover the longer frames
+
+#endif  //! _CONF_RADIO_LINK_H_
@@ -0,0 +1,110 @@
+/** \file
+ * dlog.c
+ * \brief Binary debug log source file
+ *
+ */ 
+
+#include "dlog.h"
+#include "../config/conf_usart_serial.h"
+#include "../hal/hal.h"
+
+static uint8_t			dlog_buffer[DLOG_BUFFER_SIZE];	///< log ring buffer
+static volatile uint8_t	dlog_head;						///< next free byte in the log ring buffer
+static volatile uint8_t	dlog_tail;						///< oldest byte not yet sent
+static uint8_t			dlog_in_flight;					///< bytes handed to the DMA, released on the next flush
+
+volatile uint8_t		dlog_dropped;					///< counts records dropped because the log buffer was full
+
+/**
+ * Name         : dlog_init
+ *
+ * Synopsis     : void dlog_init (void)
+ *
+ * Description  : Initialize the log ring buffer and the debug USART DMA channel.
+ *				  Call after dma_init().
+ * 
+ */
+void dlog_init (void)
+{
+	dlog_head =			0;
+	dlog_tail =			0;
+	dlog_in_flight =	0;
+	dlog_dropped =		0;
+	
+	hal_uart_dma_init(DLOG_DMA_CHANNEL, DMA_CH_TRIGSRC_DEBUG_UART_DRE_gc);	// USART Trigger source - Data Register Empty
+}
+
+/**
+ * Name         : dlog_write
+ *
+ * Synopsis     : void dlog_write (uint8_t id, const uint8_t* args, uint8_t size)
+ *
+ * \param	id		Message id (dlog_id_t)
+ * \param	args	Raw argument bytes, layout as declared in dlog_ids.h
+ * \param	size	Number of argument bytes
+ *
+ * Description  : Copy one log record into the log ring buffer. Never blocks - 
+ *				  if the record does not fit it is dropped and counted in dlog_dropped.
+ *				  Safe to call from interrupt handlers.
+ * 
+ */
+void dlog_write (uint8_t id, const uint8_t* args, uint8_t size)
+{
+	HAL_CRITICAL
+	{
+		uint8_t head = dlog_head;
+		
+		// Free space, keep one byte empty to tell full from empty
+		if ((uint8_t)(DLOG_BUFFER_SIZE - 1 - (uint8_t)(head - dlog_tail)) < (uint8_t)(size + 2))
+		{
+			dlog_dropped++;
+		}
+		else
+		{
+			dlog_buffer[head++] = DLOG_SYNC;
+			dlog_buffer[head++] = id;
+			while (size--)
+				dlog_buffer[head++] = *args++;	// head wraps at 256
+			dlog_head = head;
+		}
+	}
+}
+
+/**
+ * Name         : dlog_flush
+ *
+ * Synopsis     : void dlog_flush (void)
+ *
+ * Description  : Opportunistic drain of the log ring buffer.
+ * *			If the debug DMA channel is still busy - return
+ * *			Release the bytes sent by the last transfer
+ * *			Start a DMA transfer of the next contiguous block of the ring buffer
+ * 
+ */
+void dlog_flush (void)
+{
+	uint8_t head;
+	uint8_t tail;
+	uint8_t block_size;
+	
+	if (hal_uart_busy(DLOG_DMA_CHANNEL))
+		return;
+	
+	// Bytes of the finished transfer can be reused
+	tail =				dlog_tail + dlog_in_flight;
+	dlog_tail =			tail;
+	dlog_in_flight =	0;
+	
+	head = dlog_head;
+	if (head == tail)
+		return;
+	
+	// Send up to the head, or up to the end of the buffer if the data wraps
+	if (head > tail)
+		block_size = head - tail;
+	else
+		block_size = (uint8_t)(DLOG_BUFFER_SIZE - tail);
+	
+	dlog_in_flight = block_size;
+	hal_uart_send(&DEBUG_UART, DLOG_DMA_CHANNEL, &dlog_buffer[tail], block_size);
+}
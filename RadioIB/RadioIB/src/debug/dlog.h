@@ -0,0 +1,85 @@
+/** \file
+ * dlog.h
+ * \brief Binary debug log header file
+ *
+ *	Non-blocking debug log. A log call stores a sync byte, the message id and the raw
+ *	argument bytes in a RAM ring buffer - no formatting is done on the MCU.
+ *	dlog_flush() drains the ring buffer through the debug USART with DMA,
+ *	and RadioIB/host/dlog_decode formats the messages using dlog_ids.h.
+ *
+ *	Record on the wire: DLOG_SYNC, id, arguments (little endian, layout from dlog_ids.h)
+ */ 
+
+
+#ifndef DLOG_H_
+#define DLOG_H_
+
+#include <asf.h>
+
+#define DLOG_SYNC				0xA5			///< First byte of every log record
+#define DLOG_BUFFER_SIZE		256				///< Log ring buffer size. Must be 256 - indexes wrap as uint8_t
+#define DLOG_DMA_CHANNEL		(&DMA.CH2)		///< DMA channel used to drain the log to the debug USART
+
+/// Log message ids, from dlog_ids.h
+typedef enum {
+	#define DLOG_MSG(id, args, format)	id,
+	#include "dlog_ids.h"
+	#undef DLOG_MSG
+	DLOG_ID_COUNT
+} dlog_id_t;
+
+extern volatile uint8_t			dlog_dropped;	///< counts records dropped because the log buffer was full
+
+// Functions
+void dlog_init					(void);
+void dlog_flush					(void);
+void dlog_write					(uint8_t id, const uint8_t* args, uint8_t size);
+
+/// Log a message without arguments
+static inline void dlog_0(uint8_t id)
+{
+	dlog_write(id, NULL, 0);
+}
+
+/// Log a message with one byte argument
+static inline void dlog_b(uint8_t id, uint8_t b0)
+{
+	dlog_write(id, &b0, 1);
+}
+
+/// Log a message with two byte arguments
+static inline void dlog_bb(uint8_t id, uint8_t b0, uint8_t b1)
+{
+	uint8_t args[2] = {b0, b1};
+	dlog_write(id, args, 2);
+}
+
+/// Log a message with one word argument
+static inline void dlog_w(uint8_t id, uint16_t w0)
+{
+	uint8_t args[2] = {LSB(w0), MSB(w0)};
+	dlog_write(id, args, 2);
+}
+
+/// Log a message with a byte and a word argument
+static inline void dlog_bw(uint8_t id, uint8_t b0, uint16_t w1)
+{
+	uint8_t args[3] = {b0, LSB(w1), MSB(w1)};
+	dlog_write(id, args, 3);
+}
+
+/// Log a message with two byte and a word arguments
+static inline void dlog_bbw(uint8_t id, uint8_t b0, uint8_t b1, uint16_t w2)
+{
+	uint8_t args[4] = {b0, b1, LSB(w2), MSB(w2)};
+	dlog_write(id, args, 4);
+}
+
+/// Log a message with two word arguments
+static inline void dlog_ww(uint8_t id, uint16_t w0, uint16_t w1)
+{
+	uint8_t args[4] = {LSB(w0), MSB(w0), LSB(w1), MSB(w1)};
+	dlog_write(id, args, 4);
+}
+
+#endif /* DLOG_H_ */
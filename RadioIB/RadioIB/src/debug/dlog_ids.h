@@ -0,0 +1,38 @@
+/** \file
+ * dlog_ids.h
+ * \brief Debug log message table
+ *
+ *	Every debug log message is declared here once as
+ *	DLOG_MSG(id, argument layout, format string).
+ *
+ * *	The firmware only uses the id, and stores the raw argument bytes.
+ * *	The host decoder (RadioIB/host/dlog_decode.c) includes this same file
+ *		to get the format strings, so the table cannot go out of sync.
+ * *	Argument layout: one character per argument,
+ *		'b' = uint8_t, 'w' = uint16_t, 'd' = uint32_t (little endian).
+ * *	Format strings use printf conversions, one per argument.
+ *
+ *	Append new messages at the end - the ids of old captures must stay valid.
+ *	This file has no include guard on purpose.
+ */
+
+//			Id							Args	Format
+DLOG_MSG(	DLOG_BOOT,					"b",	"boot, reset cause 0x%02x")
+DLOG_MSG(	DLOG_XOSC_FAIL,				"",		"external oscillator failure, running on RC32M")
+DLOG_MSG(	DLOG_PLL_LOCKED,			"",		"system clock switched to XOSC PLL")
+DLOG_MSG(	DLOG_RX_OVERFLOW,			"b",	"receive ring buffer overflow, VCP address 0x%02x")
+DLOG_MSG(	DLOG_VCP_RX_ERR,			"bb",	"VCP receive error 0x%02x, VCP address 0x%02x")
+DLOG_MSG(	DLOG_VCP_TX_ERR,			"bb",	"VCP transmit error 0x%02x, VCP address 0x%02x")
+DLOG_MSG(	DLOG_COMMAND,				"bw",	"command 0x%02x, argument 0x%04x")
+DLOG_MSG(	DLOG_STACK_WARNING,			"w",	"stack low-water warning, %u bytes free")
+DLOG_MSG(	DLOG_RADIO_DROP,			"w",	"frame for the radio dropped, %u bytes - empty or more than ARQ_MAX_PAYLOAD")
+DLOG_MSG(	DLOG_LZSS_ERR,				"w",	"compressed frame from the radio dropped, %u bytes do not decompress")
+DLOG_MSG(	DLOG_BOOT_TIMELINE,			"ww",	"boot timeline, rx ready %u, link ready %u x 2 us")
+DLOG_MSG(	DLOG_BOOT_RX_GOAL,			"w",	"rx ready after %u x 2 us, over the goal")
+DLOG_MSG(	DLOG_WARM_START,			"bw",	"start done, warm %u, %u x 2 us")
+DLOG_MSG(	DLOG_STATS_JOURNAL,			"ww",	"statistics journal: boot %u, last commit %u")
+DLOG_MSG(	DLOG_RX_CAPTURE,			"bbw",	"rx capture, VCP address 0x%02x, byte 0x%02x, at %u x 8 us")
+DLOG_MSG(	DLOG_RX_CAPTURE_LOST,		"b",	"rx capture, %u log records lost")
+DLOG_MSG(	DLOG_BERT_START,			"bbw",	"BERT started, VCP address 0x%02x, PRBS-%u (0 - loopback), %u bytes/s")
+DLOG_MSG(	DLOG_BERT_STOP,				"ww",	"BERT stopped, %u bit errors, %u sync losses")
+DLOG_MSG(	DLOG_BERT_DROP,				"w",	"frame for the radio dropped, %u bytes, the radio link is under a BERT")
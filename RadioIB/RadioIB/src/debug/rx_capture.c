@@ -0,0 +1,42 @@
+/** \file
+ * rx_capture.c
+ * \brief Receive capture through the debug log
+ *
+ *	See rx_capture.h. Every captured byte costs a 6 byte log record, so the debug USART
+ *	keeps up with about a sixth of its baud rate of received bytes. What does not fit is 
+ *	dropped by the log and marked in the capture with DLOG_RX_CAPTURE_LOST.
+ */ 
+
+#include <asf.h>
+#include "rx_capture.h"
+#include "dlog.h"
+#include "../tasks/tasks.h"
+
+static uint8_t		rx_capture_dropped;		///< dlog_dropped when the last loss was marked
+
+/**
+ * Name         : rx_capture
+ *
+ * Synopsis     : void rx_capture (uint8_t link, uint8_t byte)
+ *
+ * \param	link	VCP address of the receiving peripheral
+ * \param	byte	Received byte
+ *
+ * Description  : Log a received byte with the timer ticks (DLOG_RX_CAPTURE). Called from the 
+ *				  receive interrupt handlers. Log records lost since the last call are marked first.
+ * 
+ */
+void rx_capture (uint8_t link, uint8_t byte)
+{
+	uint8_t		dropped = dlog_dropped;
+	uint16_t	ticks = get_timer_ticks();
+	
+	if (dropped != rx_capture_dropped)
+	{
+		dlog_b(DLOG_RX_CAPTURE_LOST, dropped - rx_capture_dropped);
+		if (dlog_dropped == dropped)
+			rx_capture_dropped = dropped;			// The mark got through
+	}
+	
+	dlog_bbw(DLOG_RX_CAPTURE, link, byte, ticks);
+}
@@ -0,0 +1,37 @@
+/** \file
+ * rx_capture.h
+ * \brief Receive capture - every received byte with its arrival time
+ *
+ *	With RX_CAPTURE (conf_board.h) the USART receive interrupt handlers log every byte of the
+ *	radio and the CDHIB links through the debug log (DLOG_RX_CAPTURE). host/dlog_decode -x turns
+ *	the log into a capture file, host/radioib_posix -w records one on the host, and
+ *	host/rx_replay feeds a capture back into the bridge with the same timing.
+ *
+ *	Capture file, all fields little endian:
+ * *	Header:	'R' 'X' 'C' 'P', version, 0, tick length in ns (2 bytes)
+ * *	Record:	[link][byte][delta (2 bytes)] - delta in ticks since the previous record.
+ *		link is the VCP address of the receiving peripheral (VCP_CDHIB, VCP_RADIO), or
+ *		RX_CAPTURE_TIME - time only, for gaps over 0xFFFF ticks, or
+ *		RX_CAPTURE_LOST - byte is the number of debug log records lost here, the capture has a hole
+ *
+ *	dlog_decode and frame_archive read captures with these definitions.
+ */ 
+
+
+#ifndef RX_CAPTURE_H_
+#define RX_CAPTURE_H_
+
+#include <stdint.h>
+
+#define RX_CAPTURE_VERSION		1			///< Capture file version
+#define RX_CAPTURE_HEADER_SIZE	8			///< Capture file header size
+#define RX_CAPTURE_RECORD_SIZE	4			///< Capture record size
+#define RX_CAPTURE_TICK_NS		8000		///< Capture tick - the timer tick of get_timer_ticks(), 256 cycles at 32 MHz
+
+#define RX_CAPTURE_TIME			0xFF		///< Record link: time only
+#define RX_CAPTURE_LOST			0xFE		///< Record link: debug log records lost
+
+// Functions
+void	rx_capture				(uint8_t link, uint8_t byte);
+
+#endif /* RX_CAPTURE_H_ */
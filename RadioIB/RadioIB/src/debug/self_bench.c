@@ -0,0 +1,154 @@
+/** \file
+ * self_bench.c
+ * \brief In-flight self-benchmark of the VCP codec and the CRC
+ *
+ *	See self_bench.h. The reference buffer is telemetry-like: random bytes with about
+ *	one in sixteen a FEND or FESC, so the encoder escapes some of them.
+ */ 
+
+#include "self_bench.h"
+#include "../config/conf_board.h"
+#include "../vcp/vcp_library.h"
+#include "../vcp/crclib.h"
+#include "../tasks/tasks.h"
+
+#define SELF_BENCH_ENCODED		(2 * SELF_BENCH_BYTES + 8)	///< Encoded reference frame, every byte escaped
+
+static self_bench_t		self_bench;
+static uint8_t			bench_data[SELF_BENCH_BYTES];		///< Reference buffer
+static uint8_t			bench_encoded[SELF_BENCH_ENCODED];	///< Reference buffer as a VCP frame
+static uint16_t			bench_encoded_size;
+static uint8_t			bench_decoded[SELF_BENCH_BYTES + 2];	///< Decoded frame, with the CRC
+static vcp_ptrbuffer	bench_vcp;
+
+/**
+ * Name         : self_bench_start
+ *
+ * Synopsis     : Bool self_bench_start (void)
+ *
+ * Description  : Build the reference buffer and its VCP frame, clear the results
+ * 
+ * \return		false if a benchmark is already in progress
+ */
+Bool self_bench_start (void)
+{
+	uint16_t	seed = 0xACE1;
+	uint8_t		i;
+	
+	if (self_bench.running)
+		return false;
+	
+	for (i = 0; i < SELF_BENCH_BYTES; i++)
+	{
+		seed = (seed >> 1) ^ (-(seed & 1) & 0xB400);		// 16 bit Galois LFSR
+		bench_data[i] = LSB(seed);
+		if ((MSB(seed) & 0x0F) == 0)
+			bench_data[i] = (MSB(seed) & 0x10) ? FEND : FESC;
+	}
+	bench_encoded_size = sizeof(bench_encoded);
+	Create_VCP_frame(bench_encoded, &bench_encoded_size, VCP_RADIOIB, bench_data, SELF_BENCH_BYTES);
+	
+	for (i = 0; i < SELF_BENCH_ROUTINES; i++)
+		self_bench.cycles[i] = 0xFFFFFFFF;
+	self_bench.clock_source =	CLK.CTRL & CLK_SCLKSEL_gm;
+	self_bench.running =		true;
+	return true;
+}
+
+/**
+ * Name         : self_bench_step
+ *
+ * Synopsis     : void self_bench_step (uint8_t step)
+ *
+ * \param	step	0 to SELF_BENCH_STEPS - 1, routine step / SELF_BENCH_RUNS
+ *
+ * Description  : One timed run of one routine. Interrupts stay enabled - a run they slow down 
+ *				  is not the fewest. One TCC1 overflow is allowed for (131072 cycles)
+ * 
+ */
+void self_bench_step (uint8_t step)
+{
+	uint8_t		routine = step / SELF_BENCH_RUNS;
+	uint16_t	size = sizeof(bench_encoded);
+	uint16_t	crc = CRC16_INIT_VALUE;
+	uint32_t	cycles;
+	uint8_t		i;
+	
+	vcpptr_init(&bench_vcp, bench_decoded, sizeof(bench_decoded));
+	
+	TCC1.CTRLA =	TC_CLKSEL_DIV1_gc;
+	TCC1.CNT =		0;
+	TCC1.INTFLAGS =	TC1_OVFIF_bm;
+	switch (routine)
+	{
+		case 0:
+			Create_VCP_frame(bench_encoded, &size, VCP_RADIOIB, bench_data, SELF_BENCH_BYTES);
+			break;
+		case 1:
+			for (i = 0; i < bench_encoded_size; i++)
+				Receive_VCP_byte(&bench_vcp, bench_encoded[i]);
+			break;
+		case 2:
+			crc = crc16(bench_data, SELF_BENCH_BYTES);
+			break;
+		default:
+			for (i = 0; i < SELF_BENCH_BYTES; i++)
+				append_crc16(bench_data[i], &crc);
+			break;
+	}
+	cycles = TCC1.CNT;
+	if (TCC1.INTFLAGS & TC1_OVFIF_bm)
+		cycles += 0x10000;
+	TCC1.CTRLA =	TC_CLKSEL_OFF_gc;
+	
+	if (routine < SELF_BENCH_ROUTINES && cycles < self_bench.cycles[routine])
+		self_bench.cycles[routine] = cycles;
+	(void)crc;
+}
+
+/**
+ * Name         : self_bench_telemetry
+ *
+ * Synopsis     : uint8_t self_bench_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least SELF_BENCH_SIZE bytes
+ *
+ * Description  : Build the self-benchmark packet (MSB first) and end the benchmark - clock source 
+ *				  (CLK.CTRL SCLKSEL), external oscillator recovery pending, reference bytes, runs and 
+ *				  the fewest cycles of Create_VCP_frame, Receive_VCP_byte (the whole encoded frame), 
+ *				  crc16 and append_crc16. Cycles per byte = cycles / reference bytes
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t self_bench_telemetry (uint8_t* dst)
+{
+	uint8_t i, index = 0;
+	
+	dst[index++] = self_bench.clock_source;
+	dst[index++] = xosc_recovey;
+	dst[index++] = SELF_BENCH_BYTES;
+	dst[index++] = SELF_BENCH_RUNS;
+	for (i = 0; i < SELF_BENCH_ROUTINES; i++)
+	{
+		dst[index++] = MSB0W(self_bench.cycles[i]);
+		dst[index++] = MSB1W(self_bench.cycles[i]);
+		dst[index++] = MSB2W(self_bench.cycles[i]);
+		dst[index++] = MSB3W(self_bench.cycles[i]);
+	}
+	
+	self_bench_stop();
+	return index;
+}
+
+/**
+ * Name         : self_bench_stop
+ *
+ * Synopsis     : void self_bench_stop (void)
+ *
+ * Description  : End the benchmark in progress, a new one can start
+ * 
+ */
+void self_bench_stop (void)
+{
+	self_bench.running = false;
+}
@@ -0,0 +1,41 @@
+/** \file
+ * self_bench.h
+ * \brief In-flight self-benchmark of the VCP codec and the CRC header file
+ *
+ *	SELF_BENCH_COMMAND times Create_VCP_frame, Receive_VCP_byte, crc16 and append_crc16 on a 
+ *	reference buffer with TCC1 at clk/1, in CPU cycles - the real speed on this part, with this 
+ *	build and the clock source in use (the RC32M fallback runs at a different speed than the PLL).
+ *
+ * *	One routine, one run per self_bench_step() - every step is bounded by the reference buffer size
+ * *	Each routine runs SELF_BENCH_RUNS times and keeps the fewest cycles, so an interrupt in a run
+ *		does not count
+ * *	TCC1 is free after the boot timeline (warm_start.c), nothing else uses it
+ */ 
+
+
+#ifndef SELF_BENCH_H_
+#define SELF_BENCH_H_
+
+#include <asf.h>
+
+#define SELF_BENCH_BYTES		64			///< Reference buffer size in bytes
+#define SELF_BENCH_RUNS			4			///< Runs per routine, the fewest cycles are kept
+#define SELF_BENCH_ROUTINES		4			///< Create_VCP_frame, Receive_VCP_byte, crc16, append_crc16
+#define SELF_BENCH_STEPS		(SELF_BENCH_ROUTINES * SELF_BENCH_RUNS)	///< self_bench_step() calls in a benchmark
+#define SELF_BENCH_SIZE			(4 + 4 * SELF_BENCH_ROUTINES)			///< Size in bytes of the self-benchmark packet
+#define SELF_BENCH_IDLE_WAIT_MS	1000		///< Longest wait for idle receive buffers before a step runs anyway
+
+/// Self-benchmark results
+typedef struct {
+	uint32_t		cycles[SELF_BENCH_ROUTINES];	///< Fewest CPU cycles per routine for the reference buffer
+	uint8_t			clock_source;					///< CLK.CTRL system clock selection when it ran
+	Bool			running;						///< A benchmark is in progress
+} self_bench_t;
+
+// Functions
+Bool		self_bench_start		(void);
+void		self_bench_step			(uint8_t step);
+void		self_bench_stop			(void);
+uint8_t		self_bench_telemetry	(uint8_t* dst);
+
+#endif /* SELF_BENCH_H_ */
@@ -0,0 +1,36 @@
+/** \file
+ * hal.h
+ * \brief Hardware abstraction layer header file
+ *
+ *	A thin layer between the bridge logic (tasks, commands, memory, dlog, radio control)
+ *	and the hardware, so the same code runs on the XMEGA and as a Linux process:
+ *
+ * *	UART				hal_uart_read(), hal_uart_send(), hal_uart_busy(), hal_uart_dma_init()
+ * *	DMA					hal_dma_init()
+ * *	Timer				hal_timer_count(), hal_timer_overflow(), hal_timer_period(),
+ *						hal_timer_capture(), hal_capture_init() - the 1 kHz tick timer, which
+ *						also captures the radio external event (PD7) edges
+ * *	GPIO				hal_gpio_set(), hal_gpio_clear(), hal_gpio_toggle(), hal_gpio_read()
+ * *	Critical sections	HAL_CRITICAL { ... } - no interrupt handler runs inside
+ *
+ *	Backends:
+ * *	hal_xmega.h - static inline register access, compiles to the same code as direct access
+ * *	hal_posix.h - when HAL_POSIX is defined (host/Makefile). UARTs are pseudo-terminals or
+ *		socketpairs, interrupt handlers run from a thread, the tick comes from the monotonic clock.
+ *		See host/hal_posix.c
+ *
+ *	Board bring-up (init.c), the interrupt vectors (isr.c) and the services tied to the XMEGA
+ *	(RAM monitor, warm start, EEPROM journal) stay outside the HAL.
+ */
+
+
+#ifndef HAL_H_
+#define HAL_H_
+
+#ifdef HAL_POSIX
+	#include "hal_posix.h"
+#else
+	#include "hal_xmega.h"
+#endif
+
+#endif /* HAL_H_ */
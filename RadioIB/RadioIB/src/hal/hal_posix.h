@@ -0,0 +1,106 @@
+/** \file
+ * hal_posix.h
+ * \brief Hardware abstraction layer, POSIX backend header file
+ *
+ *	Runs the bridge logic as a Linux process (HAL_POSIX, see host/Makefile):
+ * *	UART - a file descriptor, the master side of a pseudo-terminal or one end of a socketpair.
+ *		Transmissions are written straight away, so the "DMA" is never busy. Like a UART, the
+ *		bytes go out whether anybody reads them or not - what does not fit is dropped after HAL_POSIX_TX_WAIT_MS
+ * *	Interrupts - one thread stands in for the interrupt controller. It reads the UARTs and
+ *		calls their receive handlers, and calls the tick handler every ms of the monotonic clock.
+ *		The handlers run with the critical section lock held, so HAL_CRITICAL keeps them out
+ * *	GPIO - output pins read back what was driven, inputs are set by hal_posix_gpio_input(),
+ *		which also captures the radio external event edges
+ * *	Virtual clock - hal_posix_virtual(): no thread, the program injects the received bytes
+ *		(hal_posix_uart_inject()) and moves the time (hal_posix_advance_to()), for repeatable runs
+ *
+ *	The implementation is in host/hal_posix.c.
+ */
+
+
+#ifndef HAL_POSIX_H_
+#define HAL_POSIX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void (*hal_vector_t)(void);			///< Interrupt handler
+
+/// UART
+typedef struct {
+	int					fd;						///< Pseudo-terminal master or socketpair end, -1 if not attached
+	hal_vector_t		rx_vector;				///< Receive handler, NULL for transmit only
+	uint16_t			rx_per_ms;				///< Receive rate limit in bytes per ms (the baud rate), 0 for none
+	uint16_t			rx_budget;				///< Bytes that can still be received in this ms
+	uint8_t				rx_byte;				///< Byte for hal_uart_read()
+	uint32_t			rx_bytes;				///< Bytes received
+	uint32_t			tx_bytes;				///< Bytes transmitted
+	uint32_t			tx_dropped;				///< Bytes dropped - nobody reading at the other end
+	uint32_t			tx_hash;				///< FNV-1a hash of the bytes transmitted, 0 before the first
+} hal_uart_t;
+
+/// DMA channel
+typedef struct {
+	uint32_t			transfers;				///< Blocks transmitted
+} hal_dma_t;
+
+/// GPIO port
+typedef struct {
+	volatile uint8_t	out;					///< Driven levels
+	volatile uint8_t	in;						///< Pin levels
+	uint8_t				capture;				///< Pins whose edges are captured
+} hal_port_t;
+
+/// DMA controller
+typedef struct {
+	hal_dma_t			CH0, CH1, CH2, CH3;
+} hal_posix_dma_t;
+
+// The XMEGA names used by the board configuration (conf_usart_serial.h, dlog.h, radio control)
+extern hal_uart_t		USARTC0, USARTD0, USARTE0;
+extern hal_posix_dma_t	DMA;
+extern hal_port_t		PORTA, PORTD;
+
+#define DMA_CH_TRIGSRC_USARTC0_DRE_gc	0x4C
+#define DMA_CH_TRIGSRC_USARTD0_DRE_gc	0x6C
+#define DMA_CH_TRIGSRC_USARTE0_DRE_gc	0x8C
+
+#define HAL_POSIX_TIMER_PERIOD	125			///< Tick timer counts per ms, as the XMEGA TCC0
+#define HAL_POSIX_TX_WAIT_MS	10			///< Longest wait for the reader of a UART before bytes are dropped
+
+// Critical section - HAL_CRITICAL { ... }, the interrupt thread is held off inside. Nests, 'return' is safe
+void	hal_posix_lock			(void);
+void	hal_posix_unlock		(void);
+static inline uint8_t	hal_critical_enter		(void)				{ hal_posix_lock(); return 1; }
+static inline void		hal_critical_cleanup	(uint8_t* flag)		{ (void)flag; hal_posix_unlock(); }
+#define HAL_CRITICAL			for (uint8_t hal_critical_flag __attribute__ ((cleanup (hal_critical_cleanup))) = hal_critical_enter(); hal_critical_flag; hal_critical_flag = 0)
+
+// HAL
+void		hal_uart_dma_init		(hal_dma_t* channel, uint8_t trigger);
+void		hal_uart_send			(hal_uart_t* uart, hal_dma_t* channel, const uint8_t* data, uint16_t size);
+void		hal_dma_init			(void);
+uint16_t	hal_timer_count			(void);
+uint8_t		hal_timer_overflow		(void);
+uint16_t	hal_timer_capture		(void);
+void		hal_capture_init		(void);
+void		hal_gpio_set			(hal_port_t* port, uint8_t mask);
+void		hal_gpio_clear			(hal_port_t* port, uint8_t mask);
+void		hal_gpio_toggle			(hal_port_t* port, uint8_t mask);
+
+static inline uint8_t	hal_uart_read		(hal_uart_t* uart)			{ return uart->rx_byte; }
+static inline uint8_t	hal_uart_busy		(hal_dma_t* channel)		{ (void)channel; return 0; }
+static inline uint16_t	hal_timer_period	(void)						{ return HAL_POSIX_TIMER_PERIOD; }
+static inline uint8_t	hal_gpio_read		(hal_port_t* port, uint8_t mask)	{ return port->in & mask; }
+
+// Backend control, for the host programs
+void		hal_posix_uart_attach	(hal_uart_t* uart, int fd, hal_vector_t rx_vector, uint32_t baudrate);
+int			hal_posix_uart_pty		(hal_uart_t* uart, hal_vector_t rx_vector, uint32_t baudrate, char* name, size_t name_size);
+void		hal_posix_gpio_input	(hal_port_t* port, uint8_t mask, uint8_t level);
+void		hal_posix_start			(hal_vector_t tick_vector, hal_vector_t capture_vector);
+void		hal_posix_stop			(void);
+void		hal_posix_uart_inject	(hal_uart_t* uart, uint8_t byte);
+void		hal_posix_virtual		(void);
+void		hal_posix_advance_to	(int64_t ns);
+int64_t		hal_posix_now			(void);
+
+#endif /* HAL_POSIX_H_ */
@@ -0,0 +1,153 @@
+/** \file
+ * hal_xmega.h
+ * \brief Hardware abstraction layer, XMEGA backend header file
+ *
+ *	Static inline register access - the same code as accessing the registers directly.
+ */
+
+
+#ifndef HAL_XMEGA_H_
+#define HAL_XMEGA_H_
+
+#include <asf.h>
+#include <util/atomic.h>
+#include "../memory/dma_driver.h"
+
+typedef USART_t				hal_uart_t;		///< UART
+typedef volatile DMA_CH_t	hal_dma_t;		///< DMA channel
+typedef PORT_t				hal_port_t;		///< GPIO port
+
+#define HAL_TIMER			TCC0			///< 1 kHz tick timer (timers_init() in init.c)
+
+/// Critical section - HAL_CRITICAL { ... }, interrupts are disabled inside and restored after
+#define HAL_CRITICAL		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+
+
+/********/
+/* UART */
+/********/
+
+/// Read the received byte. Call from the receive interrupt handler
+static inline uint8_t hal_uart_read(hal_uart_t* uart)
+{
+	return uart->DATA;
+}
+
+/// Set up a DMA channel to feed a UART, one byte on every Data Register Empty trigger
+static inline void hal_uart_dma_init(hal_dma_t* channel, uint8_t trigger)
+{
+	DMA_EnableSingleShot(channel);
+	DMA_SetTriggerSource(channel, trigger);
+}
+
+/// Start a DMA transmission of a data block to a UART. The block must stay unchanged until hal_uart_busy() is false
+static inline void hal_uart_send(hal_uart_t* uart, hal_dma_t* channel, const uint8_t* data, uint16_t size)
+{
+	DMA_SetupBlock(	channel,								// DMA Channel
+					data,									// Source buffer address
+					DMA_CH_SRCRELOAD_NONE_gc,				// No reload
+					DMA_CH_SRCDIR_INC_gc,					// Source address direction - Increment address
+					(void *)&uart->DATA,					// Destination - USART DATA reg
+					DMA_CH_DESTRELOAD_NONE_gc,				// No reload
+					DMA_CH_DESTDIR_FIXED_gc,				// Destination address direction - Fixed address
+					size,									// Block size
+					DMA_CH_BURSTLEN_1BYTE_gc,				// 1 byte per transfer
+					0,										// No repeat
+					false);									// No repeat
+
+	// Enable channel - the channel will be automatically disabled when a transfer is finished
+	DMA_EnableChannel(channel);
+}
+
+/// DMA transmission in progress
+static inline Bool hal_uart_busy(hal_dma_t* channel)
+{
+	// The channel is automatically disabled when a transfer is finished
+	return (channel->CTRLA & DMA_CH_ENABLE_bm) != 0;
+}
+
+
+/*******/
+/* DMA */
+/*******/
+
+/// Enable the DMA controller, round robin on all the channels
+static inline void hal_dma_init(void)
+{
+	// Enable clock to the DMA
+	sysclk_enable_peripheral_clock(&DMA);
+
+	DMA_Enable();
+	DMA_SetPriority(DMA_PRIMODE_RR0123_gc);					// Round Robin on channels 0/1/2/3
+}
+
+
+/*********/
+/* Timer */
+/*********/
+
+/// Tick timer count, 0 to hal_timer_period() - 1 in every ms
+static inline uint16_t hal_timer_count(void)
+{
+	return HAL_TIMER.CNT;
+}
+
+/// Tick timer overflow not handled by its interrupt handler yet
+static inline Bool hal_timer_overflow(void)
+{
+	return (HAL_TIMER.INTFLAGS & TC0_OVFIF_bm) != 0;
+}
+
+/// Tick timer counts per ms
+static inline uint16_t hal_timer_period(void)
+{
+	return HAL_TIMER.PER + 1;
+}
+
+/// Tick timer count at the last radio external event edge
+static inline uint16_t hal_timer_capture(void)
+{
+	return HAL_TIMER.CCA;
+}
+
+/// Capture the radio external event (PD7) edges: PD7 -> event channel 0 -> tick timer capture A interrupt
+static inline void hal_capture_init(void)
+{
+	PORTD.DIRCLR =			PIN7_bm;
+	PORTD.PIN7CTRL =		PORT_ISC_BOTHEDGES_gc;
+	EVSYS.CH0MUX =			EVSYS_CHMUX_PORTD_PIN7_gc;
+	HAL_TIMER.CTRLD =		TC_EVACT_CAPT_gc | TC_EVSEL_CH0_gc;
+	HAL_TIMER.CTRLB |=		TC0_CCAEN_bm;
+	HAL_TIMER.INTCTRLB =	(HAL_TIMER.INTCTRLB & ~TC0_CCAINTLVL_gm) | TC_CCAINTLVL_LO_gc;
+}
+
+
+/********/
+/* GPIO */
+/********/
+
+/// Drive the output pins in mask high
+static inline void hal_gpio_set(hal_port_t* port, uint8_t mask)
+{
+	port->OUTSET = mask;
+}
+
+/// Drive the output pins in mask low
+static inline void hal_gpio_clear(hal_port_t* port, uint8_t mask)
+{
+	port->OUTCLR = mask;
+}
+
+/// Toggle the output pins in mask
+static inline void hal_gpio_toggle(hal_port_t* port, uint8_t mask)
+{
+	port->OUTTGL = mask;
+}
+
+/// Read the pins in mask, non zero if any is high
+static inline uint8_t hal_gpio_read(hal_port_t* port, uint8_t mask)
+{
+	return port->IN & mask;
+}
+
+#endif /* HAL_XMEGA_H_ */
@@ -1,218 +1,432 @@
-/** \file
- * memory.c
- * \brief Memory source file
- *
- *  Author: Liran
- */ 
-
-#include "memory.h"
-
-/**
- * Name         : memory_init
- *
- * Synopsis     : void memory_init (void)
- *
- * Description  : Initialize structure members and buffers for all the Peripherals
- * 
- */
-void memory_init (void)
-{
-	// CDH IB
-	RingBuffer_InitBuffer			(&cdhib.rx_ringbuff);	
-	Queue_RingBuffer_InitBuffer		(&cdhib_queue_ringbuff);
-	cdhib.USART =					&CDHIB_UART;
-	cdhib.DMA_channel =				&DMA.CH0;
-	cdhib.rx_data =					cdhib_rx_data;
-	cdhib.rx_data_buffer_size =		CDHIB_RECEIVE_MESSAGE_BUFF_SIZE;
-	cdhib.tx_data =					cdhib_tx_data;
-	cdhib.tx_data_buffer_size =		CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE;
-	cdhib.VCP_address =				VCP_CDHIB; 
-	
-		
-	// Radio
-	RingBuffer_InitBuffer			(&radio.rx_ringbuff);	
-	Queue_RingBuffer_InitBuffer		(&radio_queue_ringbuff);
-	radio.USART =					&RADIO_UART; 
-	radio.DMA_channel =				&DMA.CH1;
-	radio.rx_data =					radio_rx_data;
-	radio.rx_data_buffer_size =		RADIO_RECEIVE_MESSAGE_BUFF_SIZE;
-	radio.tx_data =					radio_tx_data;
-	radio.tx_data_buffer_size =		RADIO_TRANSMIT_MESSAGE_BUFF_SIZE;
-	radio.VCP_address =				VCP_RADIO;
-	
-	// RADIO IB
-	radioib.VCP_address =			VCP_RADIOIB;	
-	// Acknowledge message
-	ACK[0] =						0x41;	// "A"
-	ACK[1] =						0x43;	// "C"
-	ACK[2] =						0x4B;	// "K"
-
-}
-
-
-/**
- * Name         : dma_init
- *
- * Synopsis     : void dma_init (void)
- *
- * Description  : Initialize and enable DMA for all Peripheral USARTs
- * 
- */
-void dma_init (void)
-{
-	// Enable clock to the DMA
-	sysclk_enable_peripheral_clock(&DMA);
-	
-	DMA_Enable();
-	DMA_SetPriority(DMA_PRIMODE_RR0123_gc);					// Round Robin on channels 0/1/2/3
-	
-	// CDHIB
-	DMA_EnableSingleShot(cdhib.DMA_channel);				// Single shot - every trigger pulls one byte 
-    DMA_SetTriggerSource(cdhib.DMA_channel, 
-						DMA_CH_TRIGSRC_CDHIB_UART_DRE_gc);	// USART Trigger source - Data Register Empty
-	
-	// Radio
-	DMA_EnableSingleShot(radio.DMA_channel);
-    DMA_SetTriggerSource(radio.DMA_channel, 
-						DMA_CH_TRIGSRC_RADIO_UART_DRE_gc);	
-	
-}
-
-
-/**
- * Name         : read_VCP_receive_buff
- *
- * Synopsis     : void read_VCP_receive_buff(peripheral_t* Peripheral)
- *
- *	\param	Peripheral	Address to the peripheral which is the source of the transmission
- *
- * Description  : This function reads a VCP peripheral ring buffer into a linear non-VCP buffer.
- *				  When data is ready, it raises flag.
- * 
- */
-void read_VCP_receive_buff(peripheral_t* Peripheral)
-{
-	while(!RingBuffer_IsEmpty(&Peripheral->rx_ringbuff))
-	{
-		//if there's no vcp buffer, initialize it
-		if (Peripheral->vcp_rx_msg.message == NULL)
-		{
-			vcpptr_init(&(Peripheral->vcp_rx_msg), Peripheral->rx_data, Peripheral->rx_data_buffer_size);
-			Peripheral->rx_byte_count = 0;
-		}
-		
-		// Get byte from receive ring buffer
-		uint8_t rx_byte = RingBuffer_Remove(&Peripheral->rx_ringbuff);
-		// decode VCP
-		Peripheral->VCP_rx_status = Receive_VCP_byte(&(Peripheral->vcp_rx_msg), rx_byte);
-
-		if (Peripheral->VCP_rx_status & VCP_OVR_ERR)	{}
-		if (Peripheral->VCP_rx_status & VCP_CRC_ERR)	
-		{
-			Peripheral->VCP_rx_status = 0;
-		
-		}
-		if (Peripheral->VCP_rx_status & VCP_NULL_ERR)	{}
-		if (Peripheral->VCP_rx_status & VCP_ADDR_ERR)	{}
-		if (Peripheral->VCP_rx_status & VCP_ESC_ERR)	{}
-		if (Peripheral->VCP_rx_status == VCP_TERM) // Done with no errors
-		{
-			// save received byte count
-			Peripheral->rx_byte_count = Peripheral->vcp_rx_msg.index;
-			// Destination from VCP address field
-			Peripheral->rx_data_destination = Peripheral->vcp_rx_msg.address;
-			// Set Data ready flag			
-			Peripheral->rx_data_ready = true;											
-
-			// Add to received packet count
-			Peripheral->rx_packet_count++;
-			// kill VCP buffer
-			Peripheral->vcp_rx_msg.message = NULL;
-			
-			// Toggle the RX LED to show packet received
-			#ifdef DEBUG
-				PORTA.OUTTGL = Peripheral->rx_LED_pin;
-			#endif
-			
-			// Exit the while loop
-			break;
-		}	
-	}		
-}
-
-/**
- * Name         : DMA_transmit
- *
- * Synopsis     : void DMA_transmit(peripheral_t*	Peripheral)
- *
- * \param	Peripheral	Address to the peripheral which is the destination for the transmission
- *
- * Description  : Transmit data block through USART using DMA
- * 
- */
-void DMA_transmit(peripheral_t*	Peripheral)
-{
-	// Set up the block transfer
-	DMA_SetupBlock(	Peripheral->DMA_channel,				// DMA Channel
-					Peripheral->tx_data,					// Source buffer address
-					DMA_CH_SRCRELOAD_NONE_gc,				// No reload
-					DMA_CH_SRCDIR_INC_gc,					// Source address direction - Increment address
-					(void *)&Peripheral->USART->DATA,		// Destination - USART DATA reg
-					DMA_CH_DESTRELOAD_NONE_gc,				// No reload
-					DMA_CH_DESTDIR_FIXED_gc,				// Destination address direction - Fixed address
-					Peripheral->tx_byte_count,				// Block size
-					DMA_CH_BURSTLEN_1BYTE_gc,				// 1 byte per transfer
-					0,										// No repeat
-					false);									// No repeat
-
-	// Enable channel - the channel will be automatically disabled when a transfer is finished
-	DMA_EnableChannel(Peripheral->DMA_channel);
-	
-	// Toggle the TX LED to show packet sent
-	#ifdef DEBUG
-		PORTA.OUTTGL = Peripheral->tx_LED_pin;
-	#endif
-		
-	// Add to transmit packet count
-	Peripheral->tx_packet_count++;
-}
-
-/**
- * Name         : VCP_DMA_transmit
- *
- * Synopsis     : void VCP_DMA_transmit(peripheral_t* source, peripheral_t* destination)
- *
- * \param	source			Address to the peripheral which is the source of the transmission
- * \param	destination		Address to the peripheral which is the destination for the transmission
- *
- * Description  : Package a packet from a source peripheral rx buffer
- *				  to a destination peripheral tx buffer in VCP frame and transmit using DMA
- * 
- */
-void VCP_DMA_transmit(peripheral_t* source, peripheral_t* destination)
-{
-	// Reset transmit data count to full buffer size
-	destination->tx_byte_count = destination->tx_data_buffer_size;
-	
-	// create VCP frame in the peripheral transmit buffer
-	destination->VCP_tx_status = Create_VCP_frame(	destination->tx_data, 
-													(uint16ptr)&destination->tx_byte_count, 
-													source->VCP_address, 
-													source->rx_data, 
-													source->rx_byte_count);
-
-	if (destination->VCP_tx_status == VCP_OVR_ERR)	{}
-	if (destination->VCP_tx_status == VCP_NULL_ERR)	{}
-	if (destination->VCP_tx_status == VCP_ADDR_ERR)	{}
-	if (destination->VCP_tx_status == VCP_TERM)			// Done with no errors
-	{
-
-		#ifndef DEBUG
-		// Reset the source received byte count
-		source->rx_byte_count = 0;
-		#endif
-		
-		// Transmit with DMA
-		DMA_transmit(destination);
-	}		
-}
+/** \file
+ * memory.c
+ * \brief Memory source file
+ *
+ *  Author: Liran
+ */ 
+
+#include "memory.h"
+#include "../debug/dlog.h"
+#include "warm_start.h"
+
+// Radio link state kept across warm restarts
+arq_t				radio_arq			WARM_NOINIT;
+radio_reference_t	radio_reference		WARM_NOINIT;
+radio_compression_t	radio_compression	WARM_NOINIT;
+pacing_t			radio_pacing		WARM_NOINIT;
+uint8_t				radio_pacing_mode	WARM_NOINIT;
+uint32_t			radio_downlink_bytes	WARM_NOINIT;
+#if RADIO_STORE
+store_t				radio_store			WARM_NOINIT;
+radio_pass_t		radio_pass			WARM_NOINIT;
+#endif
+
+static uint8_t radioib_response_in;		///< next free Radio IB response slot
+static uint8_t radioib_response_out;		///< oldest posted Radio IB response slot
+static uint8_t radioib_response_count;	///< number of posted Radio IB responses
+
+/// Peripheral setup for memory_init() - hardware, buffers and VCP address
+typedef struct {
+	peripheral_t*				peripheral;
+	Queue_RingBuff_t*			queue;
+	hal_uart_t*					USART;
+	hal_dma_t*					DMA_channel;
+	uint8ptr					rx_data;
+	uint16_t					rx_data_buffer_size;
+	uint8ptr					tx_data;
+	uint16_t					tx_data_buffer_size;
+	uint8_t						VCP_address;
+} peripheral_setup_t;
+
+static const peripheral_setup_t peripheral_setup[] = {
+	// CDH IB
+	{	&cdhib,	&cdhib_queue_ringbuff,	&CDHIB_UART,	&DMA.CH0,	cdhib_rx_data,	CDHIB_RECEIVE_MESSAGE_BUFF_SIZE,	cdhib_tx_data,	CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE,	VCP_CDHIB	},
+	// Radio
+	{	&radio,	&radio_queue_ringbuff,	&RADIO_UART,	&DMA.CH1,	radio_rx_data,	RADIO_RECEIVE_MESSAGE_BUFF_SIZE,	radio_tx_data,	RADIO_TRANSMIT_MESSAGE_BUFF_SIZE,	VCP_RADIO	},
+};
+
+/**
+ * Name         : memory_init
+ *
+ * Synopsis     : void memory_init (void)
+ *
+ * Description  : Initialize structure members and buffers for all the Peripherals.
+ *				  First boot phase, before the receive interrupts are enabled - the USART peripherals 
+ *				  are set up from the peripheral_setup table. Everything else starts as zero (.bss).
+ * 
+ */
+void memory_init (void)
+{
+	const peripheral_setup_t*	setup;
+	peripheral_t*				peripheral;
+	
+	for (setup = peripheral_setup; setup < peripheral_setup + sizeof(peripheral_setup) / sizeof(peripheral_setup[0]); setup++)
+	{
+		peripheral =						setup->peripheral;
+		RingBuffer_InitBuffer				(&peripheral->rx_ringbuff);
+		Queue_RingBuffer_InitBuffer			(setup->queue);
+		peripheral->USART =					setup->USART;
+		peripheral->DMA_channel =			setup->DMA_channel;
+		peripheral->rx_data =				setup->rx_data;
+		peripheral->rx_data_buffer_size =	setup->rx_data_buffer_size;
+		peripheral->tx_data =				setup->tx_data;
+		peripheral->tx_data_buffer_size =	setup->tx_data_buffer_size;
+		peripheral->VCP_address =			setup->VCP_address;
+	}
+	
+	// Radio
+	radio_data_pending =			false;
+	radio_delivery_queued =			false;
+	fec_tx_start					(&radio_fec, NULL, 0);
+	radio_fec_bytes =				0;
+	radio_fec_ticks =				0;
+	
+	// RADIO IB
+	radioib.VCP_address =			VCP_RADIOIB;	
+	radioib.rx_data =				radioib_responses[0].data;
+	radioib.rx_data_buffer_size =	RADIOIB_RESPONSE_BUFF_SIZE;
+	radioib_response_in =			0;
+	radioib_response_out =			0;
+	radioib_response_count =		0;
+	// Acknowledge message
+	ACK[0] =						0x41;	// "A"
+	ACK[1] =						0x43;	// "C"
+	ACK[2] =						0x4B;	// "K"
+
+}
+
+
+/**
+ * Name         : radio_link_init
+ *
+ * Synopsis     : void radio_link_init (void)
+ *
+ * Description  : Cold start - initialize the radio link state kept across warm restarts
+ * 
+ */
+void radio_link_init (void)
+{
+	arq_init						(&radio_arq);
+	memset(&radio_compression, 0, sizeof(radio_compression));
+	radio_reference.state =			RADIO_REFERENCE_NONE;
+	memset(&radio_pacing, 0, sizeof(radio_pacing));
+	pacing_init						(&radio_pacing, RADIO_PACING_RATE, RADIO_PACING_BURST, 0);
+	radio_pacing_mode =				0;
+	radio_downlink_bytes =			0;
+#if RADIO_STORE
+	store_init						(&radio_store);
+	memset(&radio_pass, 0, sizeof(radio_pass));
+	radio_pass.contact =			true;		// Until the CDHIB ends a pass - frames are sent as they come
+#endif
+}
+
+/**
+ * Name         : radio_link_resume
+ *
+ * Synopsis     : void radio_link_resume (void)
+ *
+ * Description  : Warm start - keep the radio link state. The pacing starts again with a full bucket
+ *				  (the radio buffer drained during the reset).
+ * 
+ */
+void radio_link_resume (void)
+{
+	pacing_init						(&radio_pacing, radio_pacing.rate, radio_pacing.burst, mTicks);
+}
+
+
+/**
+ * Name         : dma_init
+ *
+ * Synopsis     : void dma_init (void)
+ *
+ * Description  : Initialize and enable DMA for all Peripheral USARTs
+ * 
+ */
+void dma_init (void)
+{
+	hal_dma_init();											// Round Robin on all channels
+	
+	// Single shot - every USART Data Register Empty trigger pulls one byte
+	hal_uart_dma_init(cdhib.DMA_channel, DMA_CH_TRIGSRC_CDHIB_UART_DRE_gc);
+	hal_uart_dma_init(radio.DMA_channel, DMA_CH_TRIGSRC_RADIO_UART_DRE_gc);
+	
+}
+
+
+/**
+ * Name         : read_VCP_receive_buff
+ *
+ * Synopsis     : void read_VCP_receive_buff(peripheral_t* Peripheral)
+ *
+ *	\param	Peripheral	Address to the peripheral which is the source of the transmission
+ *
+ * Description  : This function reads a VCP peripheral ring buffer into a linear non-VCP buffer.
+ *				  When data is ready, it raises flag.
+ * 
+ */
+void read_VCP_receive_buff(peripheral_t* Peripheral)
+{
+	while(!RingBuffer_IsEmpty(&Peripheral->rx_ringbuff))
+	{
+		//if there's no vcp buffer, initialize it
+		if (Peripheral->vcp_rx_msg.message == NULL)
+		{
+			vcpptr_init(&(Peripheral->vcp_rx_msg), Peripheral->rx_data, Peripheral->rx_data_buffer_size);
+			Peripheral->rx_byte_count = 0;
+		}
+		
+		// Get byte from receive ring buffer
+		uint8_t rx_byte = RingBuffer_Remove(&Peripheral->rx_ringbuff);
+		// decode VCP
+		Peripheral->VCP_rx_status = Receive_VCP_byte(&(Peripheral->vcp_rx_msg), rx_byte);
+
+		// Bad frame - drop it and start over, or every frame after it fails too.
+		// The FEND that ended it may start the next frame
+		if (Peripheral->VCP_rx_status >= VCP_OVR_ERR && Peripheral->VCP_rx_status <= VCP_ESC_ERR)
+		{
+			dlog_bb(DLOG_VCP_RX_ERR, Peripheral->VCP_rx_status, Peripheral->VCP_address);
+			Peripheral->rx_error_count++;
+			Peripheral->VCP_rx_status = 0;
+			vcpptr_init(&(Peripheral->vcp_rx_msg), Peripheral->rx_data, Peripheral->rx_data_buffer_size);
+			if (rx_byte == FEND)
+				Receive_VCP_byte(&(Peripheral->vcp_rx_msg), FEND);
+			continue;
+		}
+		if (Peripheral->VCP_rx_status == VCP_TERM) // Done with no errors
+		{
+			// save received byte count
+			Peripheral->rx_byte_count = Peripheral->vcp_rx_msg.index;
+			// Destination from VCP address field
+			Peripheral->rx_data_destination = Peripheral->vcp_rx_msg.address;
+			// Set Data ready flag			
+			Peripheral->rx_data_ready = true;											
+
+			// Add to received packet count
+			Peripheral->rx_packet_count++;
+			// kill VCP buffer
+			Peripheral->vcp_rx_msg.message = NULL;
+			
+			// Toggle the RX LED to show packet received
+			#ifdef DEBUG
+				hal_gpio_toggle(&PORTA, Peripheral->rx_LED_pin);
+			#endif
+			
+			// Exit the while loop
+			break;
+		}	
+	}		
+}
+
+/**
+ * Name         : DMA_transmit
+ *
+ * Synopsis     : void DMA_transmit(peripheral_t*	Peripheral)
+ *
+ * \param	Peripheral	Address to the peripheral which is the destination for the transmission
+ *
+ * Description  : Transmit the peripheral transmit buffer through USART using DMA
+ * 
+ */
+void DMA_transmit(peripheral_t*	Peripheral)
+{
+	DMA_transmit_block(Peripheral, Peripheral->tx_data, Peripheral->tx_byte_count);
+}
+
+/**
+ * Name         : DMA_transmit_block
+ *
+ * Synopsis     : void DMA_transmit_block(peripheral_t* Peripheral, uint8ptr data, uint16_t size)
+ *
+ * \param	Peripheral	Address to the peripheral which is the destination for the transmission
+ * \param	data		Data block, must stay unchanged until the transmission is done
+ * \param	size		Data block size
+ *
+ * Description  : Transmit a data block through USART using DMA
+ * 
+ */
+void DMA_transmit_block(peripheral_t* Peripheral, uint8ptr data, uint16_t size)
+{
+	hal_uart_send(Peripheral->USART, Peripheral->DMA_channel, data, size);
+	
+	// Toggle the TX LED to show packet sent
+	#ifdef DEBUG
+		hal_gpio_toggle(&PORTA, Peripheral->tx_LED_pin);
+	#endif
+		
+	// Add to transmit packet count
+	Peripheral->tx_packet_count++;
+}
+
+/**
+ * Name         : VCP_DMA_transmit
+ *
+ * Synopsis     : void VCP_DMA_transmit(peripheral_t* source, peripheral_t* destination)
+ *
+ * \param	source			Address to the peripheral which is the source of the transmission
+ * \param	destination		Address to the peripheral which is the destination for the transmission
+ *
+ * Description  : Package a packet from a source peripheral rx buffer
+ *				  to a destination peripheral tx buffer in VCP frame and transmit using DMA
+ * 
+ */
+void VCP_DMA_transmit(peripheral_t* source, peripheral_t* destination)
+{
+	if (VCP_DMA_transmit_buffer(source->VCP_address, source->rx_data, source->rx_byte_count, destination) == VCP_TERM)
+	{
+		#ifndef DEBUG
+		// Reset the source received byte count
+		source->rx_byte_count = 0;
+		#endif
+	}
+}
+
+/**
+ * Name         : VCP_DMA_transmit_buffer
+ *
+ * Synopsis     : uint8_t VCP_DMA_transmit_buffer(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination)
+ *
+ * \param	address			VCP address for the frame
+ * \param	data			Data to send. Create_VCP_frame writes the CRC in the 2 bytes after the data
+ * \param	size			Data size
+ * \param	destination		Address to the peripheral which is the destination for the transmission
+ *
+ * Description  : Package a data buffer to a destination peripheral tx buffer in VCP frame and transmit using DMA
+ * 
+ * \return					VCP status flags
+ */
+uint8_t VCP_DMA_transmit_buffer(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination)
+{
+	// Transmit with DMA when done with no errors
+	if (VCP_frame_buffer(address, data, size, destination) == VCP_TERM)
+		DMA_transmit(destination);
+	
+	return destination->VCP_tx_status;
+}
+
+/**
+ * Name         : VCP_frame_buffer
+ *
+ * Synopsis     : uint8_t VCP_frame_buffer(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination)
+ *
+ * \param	address			VCP address for the frame
+ * \param	data			Data to send. Create_VCP_frame writes the CRC in the 2 bytes after the data
+ * \param	size			Data size
+ * \param	destination		Address to the peripheral which is the destination for the transmission
+ *
+ * Description  : Package a data buffer to a destination peripheral tx buffer in VCP frame, without transmitting it
+ * 
+ * \return					VCP status flags
+ */
+uint8_t VCP_frame_buffer(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination)
+{
+	// Reset transmit data count to full buffer size
+	destination->tx_byte_count = destination->tx_data_buffer_size;
+	
+	// create VCP frame in the peripheral transmit buffer
+	destination->VCP_tx_status = Create_VCP_frame(	destination->tx_data, 
+													(uint16ptr)&destination->tx_byte_count, 
+													address, 
+													data, 
+													size);
+
+	if (destination->VCP_tx_status == VCP_OVR_ERR)	
+	{
+		dlog_bb(DLOG_VCP_TX_ERR, VCP_OVR_ERR, address);
+	}
+	if (destination->VCP_tx_status == VCP_NULL_ERR)	{}
+	if (destination->VCP_tx_status == VCP_ADDR_ERR)	{}
+	
+	return destination->VCP_tx_status;
+}
+
+/**
+ * Name         : DMA_transmit_idle
+ *
+ * Synopsis     : Bool DMA_transmit_idle(peripheral_t*	Peripheral)
+ *
+ * \param	Peripheral	Address to the peripheral
+ *
+ * Description  : Check if the last DMA transmission to the peripheral is done,
+ *				  so the transmit buffer can be reused
+ *
+ * \return				true if the transmit buffer is free
+ */
+Bool DMA_transmit_idle(peripheral_t* Peripheral)
+{
+	return !hal_uart_busy(Peripheral->DMA_channel);
+}
+
+/**
+ * Name         : radioib_response_alloc
+ *
+ * Synopsis     : uint8ptr radioib_response_alloc(void)
+ *
+ * Description  : Get a free Radio IB response buffer, RADIOIB_RESPONSE_BUFF_SIZE - 2 bytes can be used.
+ *				  The buffer is handed to the CDHIB transmit queue by radioib_response_post().
+ *
+ * \return				Response buffer, NULL if all the buffers or the CDHIB queue are full
+ */
+uint8ptr radioib_response_alloc(void)
+{
+	if (radioib_response_count >= RADIOIB_RESPONSE_SLOTS || Queue_RingBuffer_IsFull(&cdhib_queue_ringbuff))
+		return NULL;
+	
+	return radioib_responses[radioib_response_in].data;
+}
+
+/**
+ * Name         : radioib_response_post
+ *
+ * Synopsis     : void radioib_response_post(uint16_t size)
+ *
+ * \param	size		Response size
+ *
+ * Description  : Queue the buffer from the last radioib_response_alloc() for transmission to the CDHIB
+ * 
+ */
+void radioib_response_post(uint16_t size)
+{
+	radioib_responses[radioib_response_in].size = size;
+	
+	if (++radioib_response_in == RADIOIB_RESPONSE_SLOTS)
+		radioib_response_in = 0;
+	radioib_response_count++;
+	
+	Queue_RingBuffer_Insert(&cdhib_queue_ringbuff, radioib.VCP_address);	// Insert to cdhib transmit queue
+}
+
+/**
+ * Name         : radioib_response_next
+ *
+ * Synopsis     : Bool radioib_response_next(void)
+ *
+ * Description  : Point the Radio IB peripheral receive buffer at the oldest posted response, 
+ *				  ready for VCP_DMA_transmit(&radioib, ...)
+ *
+ * \return				false if there is no posted response
+ */
+Bool radioib_response_next(void)
+{
+	if (radioib_response_count == 0)
+		return false;
+	
+	radioib.rx_data =		radioib_responses[radioib_response_out].data;
+	radioib.rx_byte_count =	radioib_responses[radioib_response_out].size;
+	return true;
+}
+
+/**
+ * Name         : radioib_response_release
+ *
+ * Synopsis     : void radioib_response_release(void)
+ *
+ * Description  : Free the oldest posted response, once it was copied to a VCP frame
+ * 
+ */
+void radioib_response_release(void)
+{
+	if (++radioib_response_out == RADIOIB_RESPONSE_SLOTS)
+		radioib_response_out = 0;
+	radioib_response_count--;
+}
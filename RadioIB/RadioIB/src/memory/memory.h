@@ -1,93 +1,207 @@
-/** \file
- * memory.h
- * \brief Memory header file
- *
- *  Author: Liran
- */ 
-
-
-#ifndef MEMORY_H_
-#define MEMORY_H_
-
-#include <asf.h>
-#include "../config/conf_board.h"
-#include "../config/conf_usart_serial.h"
-#include "LightweightRingBuff.h"
-#include "dma_driver.h"
-#include "../vcp/common.h"
-#include "../vcp/vcp_library.h"
-#include "../tasks/tasks.h"
-#include "../tasks/radioib.h"
-
-// Non-VCP receive Buffers size
-#define RADIO_RECEIVE_MESSAGE_BUFF_SIZE		256			///< Radio receive buffer size(non - VCP)
-#define CDHIB_RECEIVE_MESSAGE_BUFF_SIZE		256			///< CDHIB receive buffer size(non - VCP)
-
-// VCP transmit Buffers size
-#define CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE	256			///< CDHIB transmit buffer size (VCP)
-
-// Non-VCP transmit buffers
-#define RADIO_TRANSMIT_MESSAGE_BUFF_SIZE	256			///< Radio transmit buffer size(non - VCP)
-
-
-/// Peripheral structure
-typedef struct {
-	
-	// Hardware
-	USART_t *					USART;					///< USART associated with this peripheral
-	volatile DMA_CH_t *			DMA_channel;			///< DMA channel for data transmission
-	
-	// Buffers
-	Receive_RingBuff_t 			rx_ringbuff;			///< ring buffer to receive from USART
-	vcp_ptrbuffer				vcp_rx_msg;				///< VCP buffer pointer
-	uint8ptr					rx_data;				///< linear buffer for non VCP received data
-	uint16_t					rx_data_buffer_size;	///< allocated size of receive buffer
-	uint8ptr					tx_data;				///< linear buffer for VCP frame ready to transmit
-	uint16_t					tx_data_buffer_size;	///< allocated size of transmit buffer
-	
-	// Flags and Counters
-	volatile uint8_t			rx_ringbuff_overflow;	///< counts receive ring buffer overflow
-	uint16_t					rx_byte_count;			///< number of received bytes after VCP decoding (actual data size)
-	Bool						rx_data_ready;			///< flag for VCP decoding done and non-VCP data ready 
-	uint16_t					tx_byte_count;			///< bytes to tx in transmit buffer (actual data size)
-
-	// VCP
-	uint8_t						VCP_address;			///< VCP address
-	uint8_t						rx_data_destination;	///< destination for received data (VCP address from received packet)
-	uint8_t						VCP_rx_status;			///< VCP receive status register
-	uint8_t						VCP_tx_status;			///< VCP transmit status register
-	uint16_t					rx_packet_count;		///< keeps track of number of packets received from this peripheral 
-	uint16_t					tx_packet_count;		///< keeps track of number of packets transmitted to this peripheral 
-
-	#ifdef DEBUG
-		uint8_t					tx_LED_pin;				///< DEUBG - STK LED pin	
-		uint8_t					rx_LED_pin;				///< DEUBG - STK LED pin
-	#endif
-	
-} peripheral_t;
-
-// Declare peripheral structures
-peripheral_t					radio;					///< Radio Peripheral
-peripheral_t					cdhib;					///< CDHIB Peripheral
-peripheral_t					radioib;				///< RadioIB (Self) Peripheral - enables the use of all the peripheral functions
-
-// FC and Radio transmit queue ring buffers
-Queue_RingBuff_t 				cdhib_queue_ringbuff;	///< CDHIB Queue ring buffer
-Queue_RingBuff_t 				radio_queue_ringbuff;	///< Radio Queue ring buffer
-
-// Data buffers allocation
-uint8_t radio_rx_data			[RADIO_RECEIVE_MESSAGE_BUFF_SIZE];	///< Radio receive buffer allocation
-uint8_t radio_tx_data			[RADIO_TRANSMIT_MESSAGE_BUFF_SIZE];	///< Radio transmit buffer allocation
-uint8_t cdhib_rx_data			[CDHIB_RECEIVE_MESSAGE_BUFF_SIZE];	///< CDHIB receive buffer allocation
-uint8_t cdhib_tx_data			[CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE];	///< CDHIB transmit buffer allocation
-
-
-// Functions
-void memory_init				(void);
-void dma_init					(void);
-void read_VCP_receive_buff		(peripheral_t* Peripheral);
-void read_Non_VCP_receive_buff	(peripheral_t* Peripheral);
-void DMA_transmit				(peripheral_t* Peripheral);
-void VCP_DMA_transmit			(peripheral_t* source, peripheral_t* destination);
-
+/** \file
+ * memory.h
+ * \brief Memory header file
+ *
+ *  Author: Liran
+ */ 
+
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+
+#include <asf.h>
+#include "../config/conf_board.h"
+#include "../config/conf_usart_serial.h"
+#include "LightweightRingBuff.h"
+#include "../hal/hal.h"
+#include "../debug/dlog.h"
+#include "../debug/rx_capture.h"
+#include "../vcp/common.h"
+#include "../vcp/vcp_library.h"
+#include "../tasks/tasks.h"
+#include "../tasks/radioib.h"
+#include "../radio/arq.h"
+#include "../radio/lzss.h"
+#include "../radio/fec.h"
+#include "../radio/pacing.h"
+#include "../radio/store.h"
+
+// Non-VCP receive Buffers size
+#define RADIO_RECEIVE_MESSAGE_BUFF_SIZE		256			///< Radio receive buffer size(non - VCP)
+#define CDHIB_RECEIVE_MESSAGE_BUFF_SIZE		256			///< CDHIB receive buffer size(non - VCP)
+
+// VCP transmit Buffers size
+#define CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE	256			///< CDHIB transmit buffer size (VCP)
+
+// Non-VCP transmit buffers
+#define RADIO_TRANSMIT_MESSAGE_BUFF_SIZE	256			///< Radio transmit buffer size(non - VCP)
+
+// Radio IB response buffers (non-VCP, +2 bytes for the CRC added by Create_VCP_frame)
+#define RADIOIB_RESPONSE_BUFF_SIZE			64			///< Radio IB command response buffer size
+#define RADIOIB_RESPONSE_SLOTS				4			///< Number of Radio IB responses that can wait for the CDHIB link
+
+
+/// Peripheral structure
+typedef struct {
+	
+	// Hardware
+	hal_uart_t *				USART;					///< USART associated with this peripheral
+	hal_dma_t *					DMA_channel;			///< DMA channel for data transmission
+	
+	// Buffers
+	Receive_RingBuff_t 			rx_ringbuff;			///< ring buffer to receive from USART
+	vcp_ptrbuffer				vcp_rx_msg;				///< VCP buffer pointer
+	uint8ptr					rx_data;				///< linear buffer for non VCP received data
+	uint16_t					rx_data_buffer_size;	///< allocated size of receive buffer
+	uint8ptr					tx_data;				///< linear buffer for VCP frame ready to transmit
+	uint16_t					tx_data_buffer_size;	///< allocated size of transmit buffer
+	
+	// Flags and Counters
+	volatile uint8_t			rx_ringbuff_overflow;	///< counts receive ring buffer overflow
+	uint16_t					rx_error_count;			///< counts VCP receive errors (overrun, CRC, escape)
+	uint16_t					rx_byte_count;			///< number of received bytes after VCP decoding (actual data size)
+	Bool						rx_data_ready;			///< flag for VCP decoding done and non-VCP data ready 
+	uint16_t					tx_byte_count;			///< bytes to tx in transmit buffer (actual data size)
+
+	// VCP
+	uint8_t						VCP_address;			///< VCP address
+	uint8_t						rx_data_destination;	///< destination for received data (VCP address from received packet)
+	uint8_t						VCP_rx_status;			///< VCP receive status register
+	uint8_t						VCP_tx_status;			///< VCP transmit status register
+	uint16_t					rx_packet_count;		///< keeps track of number of packets received from this peripheral 
+	uint16_t					tx_packet_count;		///< keeps track of number of packets transmitted to this peripheral 
+
+	#ifdef DEBUG
+		uint8_t					tx_LED_pin;				///< DEUBG - STK LED pin	
+		uint8_t					rx_LED_pin;				///< DEUBG - STK LED pin
+	#endif
+	
+} peripheral_t;
+
+/// Radio IB response waiting in the CDHIB transmit queue
+typedef struct {
+	uint8_t						data[RADIOIB_RESPONSE_BUFF_SIZE];	///< response data
+	uint16_t					size;					///< response size
+} radioib_response_t;
+
+/// Reference payload for radio frame compression
+typedef struct {
+	uint8_t						data[LZSS_MAX_INPUT];	///< payload, as sent
+	uint8_t						size;					///< payload size
+	uint8_t						seq;					///< ARQ sequence number it was sent with
+	uint8_t						state;					///< RADIO_REFERENCE_...
+	uint8_t						uses;					///< frames compressed against it
+	uint16_t					given_up;				///< ARQ tx_given_up when it was sent
+	uint32_t					check;					///< arq_check() of the payload, written with it
+} radio_reference_t;
+
+// Reference payload states
+#define RADIO_REFERENCE_NONE		0x00		///< No reference
+#define RADIO_REFERENCE_WAIT		0x01		///< Sent, waiting for the acknowledge
+#define RADIO_REFERENCE_READY		0x02		///< Acknowledged - the ground has it
+
+/// Radio link compression statistics
+typedef struct {
+	uint32_t					bytes_in;				///< payload bytes from the CDHIB for the radio
+	uint32_t					bytes_out;				///< payload bytes given to the ARQ, compressed or not
+	uint32_t					timer_ticks;			///< time spent compressing, in timer ticks (256 CPU cycles)
+	uint16_t					frames;					///< frames sent compressed
+} radio_compression_t;
+
+/// Ground pass state, for the store-and-forward buffer
+typedef struct {
+	Bool						contact;				///< in contact - frames for the radio are sent and the store is dumped
+	uint16_t					remaining;				///< seconds left in the pass, 0 - until STORE_PASS_END
+	uint16_t					second_time;			///< mTicks at the start of the current second
+	uint8_t						data_class;				///< store data class of the next frames from the CDHIB
+	uint16_t					passes;					///< passes started
+} radio_pass_t;
+
+// Declare peripheral structures
+peripheral_t					radio;					///< Radio Peripheral
+peripheral_t					cdhib;					///< CDHIB Peripheral
+peripheral_t					radioib;				///< RadioIB (Self) Peripheral - enables the use of all the peripheral functions
+
+// FC and Radio transmit queue ring buffers
+Queue_RingBuff_t 				cdhib_queue_ringbuff;	///< CDHIB Queue ring buffer
+Queue_RingBuff_t 				radio_queue_ringbuff;	///< Radio Queue ring buffer
+
+// Data buffers allocation
+uint8_t radio_rx_data			[RADIO_RECEIVE_MESSAGE_BUFF_SIZE];	///< Radio receive buffer allocation
+uint8_t radio_tx_data			[RADIO_TRANSMIT_MESSAGE_BUFF_SIZE];	///< Radio transmit buffer allocation
+uint8_t cdhib_rx_data			[CDHIB_RECEIVE_MESSAGE_BUFF_SIZE];	///< CDHIB receive buffer allocation
+uint8_t cdhib_tx_data			[CDHIB_TRANSMIT_MESSAGE_BUFF_SIZE];	///< CDHIB transmit buffer allocation
+radioib_response_t radioib_responses	[RADIOIB_RESPONSE_SLOTS];	///< Radio IB response buffers allocation
+
+// Radio link state kept across warm restarts - in .noinit, defined in memory.c (see warm_start.h)
+extern arq_t				radio_arq;			///< Radio link selective repeat ARQ (transmit and receive windows)
+extern radio_reference_t	radio_reference;	///< Radio frame compression reference payload
+extern radio_compression_t	radio_compression;	///< Radio link compression statistics
+extern pacing_t				radio_pacing;		///< Radio transmit token bucket
+extern uint8_t				radio_pacing_mode;	///< Radio pacing mode flags (RADIO_PACING_PD7...)
+extern uint32_t				radio_downlink_bytes;	///< Payload bytes of the CDHIB frames accepted for the radio
+#if RADIO_STORE
+extern store_t				radio_store;		///< Store-and-forward buffer for frames to the radio while out of contact
+extern radio_pass_t			radio_pass;			///< Ground pass state
+#endif
+
+// Radio link
+Bool	radio_data_pending;				///< CDHIB frame for the radio waiting for space in the ARQ window
+Bool	radio_delivery_queued;			///< A radio token is in the CDHIB queue for the next in-order ARQ payload
+lzss_t	radio_lzss;						///< Radio frame compressor work area
+uint8_t	radio_lzss_buff[LZSS_MAX_INPUT + ARQ_CRC_SPACE];	///< Compressed / decompressed radio payload
+fec_tx_t	radio_fec;					///< FEC blocks of the VCP frame being sent to the radio
+uint32_t	radio_fec_bytes;			///< VCP frame bytes FEC encoded
+uint32_t	radio_fec_ticks;			///< time spent FEC encoding, in timer ticks (256 CPU cycles)
+
+
+// Functions
+void memory_init				(void);
+void radio_link_init			(void);
+void radio_link_resume			(void);
+void dma_init					(void);
+void read_VCP_receive_buff		(peripheral_t* Peripheral);
+void read_Non_VCP_receive_buff	(peripheral_t* Peripheral);
+void DMA_transmit				(peripheral_t* Peripheral);
+void DMA_transmit_block			(peripheral_t* Peripheral, uint8ptr data, uint16_t size);
+void VCP_DMA_transmit			(peripheral_t* source, peripheral_t* destination);
+uint8_t VCP_DMA_transmit_buffer	(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination);
+uint8_t VCP_frame_buffer		(uint8_t address, uint8ptr data, uint16_t size, peripheral_t* destination);
+Bool DMA_transmit_idle			(peripheral_t* Peripheral);
+uint8ptr radioib_response_alloc	(void);
+void radioib_response_post		(uint16_t size);
+Bool radioib_response_next		(void);
+void radioib_response_release	(void);
+
+/**
+ * Name         : peripheral_receive
+ *
+ * Synopsis     : static inline void peripheral_receive(peripheral_t* Peripheral)
+ *
+ * \param	Peripheral	Peripheral whose USART received a byte
+ *
+ * Description  : USART receive interrupt handler body - read the received byte into the 
+ *				  peripheral receive ring buffer, count and log an overflow when it is full.
+ *				  With RX_CAPTURE the byte is logged for the capture (rx_capture.h) first
+ * 
+ */
+static inline void peripheral_receive(peripheral_t* Peripheral)
+{
+	uint8_t rx_byte = hal_uart_read(Peripheral->USART);				// also clears the interrupt flag
+	
+#ifdef RX_CAPTURE
+	rx_capture(Peripheral->VCP_address, rx_byte);
+#endif
+	
+	if (RingBuffer_IsFull(&Peripheral->rx_ringbuff))
+	{
+		Peripheral->rx_ringbuff_overflow++;								// buffer overflow
+		dlog_b(DLOG_RX_OVERFLOW, Peripheral->VCP_address);
+	}
+	else
+	{
+		RingBuffer_Insert(&Peripheral->rx_ringbuff, rx_byte);			// read received byte into the ring buffer
+	}
+}
+
 #endif /* MEMORY_H_ */
\ No newline at end of file
@@ -0,0 +1,139 @@
+/** \file
+ * ram_monitor.c
+ * \brief RAM and stack high-water monitor source file
+ *
+ */ 
+
+#include "ram_monitor.h"
+#include "memory.h"
+#include "../debug/dlog.h"
+#include "warm_start.h"
+
+extern uint8_t		_end;					///< Linker symbol: end of .data/.bss/.noinit
+extern uint8_t		__stack;				///< Linker symbol: top of RAM, initial stack pointer
+
+ram_monitor_t		ram_monitor;			///< RAM monitor results
+
+static uint8_t*		scan_ptr;				///< Next byte to check in the current scan
+
+/**
+ * Name         : ram_paint
+ *
+ * Synopsis     : void ram_paint (void)
+ *
+ * Description  : Fill the free RAM, from _end up to the top of the stack, with RAM_CANARY. Runs 
+ *				  from .init5 - after .data/.bss are initialized, before main(). Naked code in the 
+ *				  startup sequence, not a function: nothing may be on the stack while it is painted, 
+ *				  so the loop is in asm. The CPU already runs at 32MHz (boot_clock_start() in init.c).
+ *				  Skipped on a warm reset (warm_start_reset()) - it is the slowest part of the start, 
+ *				  and the paint from the cold start is still there.
+ * 
+ */
+void ram_paint (void) __attribute__ ((naked, used, section (".init5")));
+void ram_paint (void)
+{
+	__asm__ __volatile__ (
+		"	call	warm_start_reset		\n"	// Returns before the paint, the stack is empty again
+		"	tst		r24						\n"
+		"	brne	2f						\n"
+		"	ldi		r26, lo8(_end)			\n"
+		"	ldi		r27, hi8(_end)			\n"
+		"	ldi		r25, hi8(__stack + 1)	\n"
+		"	ldi		r24, %[canary]			\n"
+		"1:	st		X+, r24					\n"
+		"	cpi		r26, lo8(__stack + 1)	\n"
+		"	cpc		r27, r25				\n"
+		"	brne	1b						\n"
+		"2:									\n"
+		:: [canary] "M" (RAM_CANARY));
+}
+
+/**
+ * Name         : ram_monitor_init
+ *
+ * Synopsis     : void ram_monitor_init (void)
+ *
+ * Description  : Initialize the RAM monitor results
+ * 
+ */
+void ram_monitor_init (void)
+{
+	ram_monitor.stack_free_min =		(uint16_t)(&__stack - &_end);
+	ram_monitor.stack_warning_count =	0;
+	ram_monitor.scan_count =			0;
+	scan_ptr =							&_end;
+}
+
+/**
+ * Name         : ram_monitor_update
+ *
+ * Synopsis     : void ram_monitor_update (void)
+ *
+ * Description  : Continue the scan for the stack low-water mark.
+ * *			Check up to RAM_MONITOR_SCAN_BYTES bytes upwards from the end of the globals
+ * *			The first byte that is not RAM_CANARY is the deepest the stack has reached
+ * *			When the scan is done, update stack_free_min, raise the warning counter if
+ *				the free space is below STACK_WARNING_MARGIN and start a new scan
+ * 
+ */
+void ram_monitor_update (void)
+{
+	uint8_t count = RAM_MONITOR_SCAN_BYTES;
+	
+	// The stack only grows down, so the scan never has to go above the last low-water mark
+	uint8_t* limit = &_end + ram_monitor.stack_free_min;
+	
+	while (count-- && scan_ptr < limit && *scan_ptr == RAM_CANARY)
+		scan_ptr++;
+
+	if (scan_ptr < limit && *scan_ptr == RAM_CANARY)
+		return;	// Not done yet
+	
+	// Scan done
+	ram_monitor.stack_free_min = (uint16_t)(scan_ptr - &_end);
+	ram_monitor.scan_count++;
+	
+	if (ram_monitor.stack_free_min < STACK_WARNING_MARGIN)
+	{
+		ram_monitor.stack_warning_count++;
+		dlog_w(DLOG_STACK_WARNING, ram_monitor.stack_free_min);
+	}
+	
+	scan_ptr = &_end;
+}
+
+/**
+ * Name         : ram_monitor_telemetry
+ *
+ * Synopsis     : uint8_t ram_monitor_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least RAM_TELEMETRY_SIZE bytes
+ *
+ * Description  : Build the memory telemetry packet (16 bit values are MSB first)
+ * *			Minimum free stack, stack warning count
+ * *			High-water marks of the CDHIB and Radio receive ring buffers
+ * *			High-water marks and current depth of the CDHIB and Radio transmit queues
+ * *			Receive ring buffer overflow counters, dropped debug log records
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t ram_monitor_telemetry (uint8_t* dst)
+{
+	uint8_t i = 0;
+	
+	dst[i++] = MSB(ram_monitor.stack_free_min);
+	dst[i++] = LSB(ram_monitor.stack_free_min);
+	dst[i++] = MSB(ram_monitor.stack_warning_count);
+	dst[i++] = LSB(ram_monitor.stack_warning_count);
+	dst[i++] = cdhib.rx_ringbuff.HighWater;
+	dst[i++] = radio.rx_ringbuff.HighWater;
+	dst[i++] = cdhib_queue_ringbuff.HighWater;
+	dst[i++] = radio_queue_ringbuff.HighWater;
+	dst[i++] = Queue_RingBuffer_GetCount(&cdhib_queue_ringbuff);
+	dst[i++] = Queue_RingBuffer_GetCount(&radio_queue_ringbuff);
+	dst[i++] = cdhib.rx_ringbuff_overflow;
+	dst[i++] = radio.rx_ringbuff_overflow;
+	dst[i++] = dlog_dropped;
+	
+	return i;
+}
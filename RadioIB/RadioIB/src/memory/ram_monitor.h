@@ -0,0 +1,37 @@
+/** \file
+ * ram_monitor.h
+ * \brief RAM and stack high-water monitor header file
+ *
+ *	At startup (.init5) all RAM between the end of the globals (_end) and the stack
+ *	pointer is painted with RAM_CANARY. ram_monitor_update() then finds the lowest
+ *	byte the stack has ever written, a few bytes per call so it never stalls the
+ *	scheduler. Ring buffer high-water marks are kept by the ring buffers themselves.
+ */ 
+
+
+#ifndef RAM_MONITOR_H_
+#define RAM_MONITOR_H_
+
+#include <asf.h>
+
+#define RAM_CANARY					0xC5	///< Paint pattern for unused RAM
+#define RAM_MONITOR_SCAN_BYTES		64		///< Bytes checked per call to ram_monitor_update()
+#define STACK_WARNING_MARGIN		512		///< Early warning when fewer free bytes than this remain between stack and globals
+
+#define RAM_TELEMETRY_SIZE			13		///< Size in bytes of the memory telemetry packet
+
+/// RAM monitor results
+typedef struct {
+	uint16_t		stack_free_min;			///< Minimum free bytes seen between the stack and the globals
+	uint16_t		stack_warning_count;	///< Number of scans that found less than STACK_WARNING_MARGIN free
+	uint16_t		scan_count;				///< Number of completed scans
+} ram_monitor_t;
+
+extern ram_monitor_t		ram_monitor;	///< RAM monitor results
+
+// Functions
+void		ram_monitor_init		(void);
+void		ram_monitor_update		(void);
+uint8_t		ram_monitor_telemetry	(uint8_t* dst);
+
+#endif /* RAM_MONITOR_H_ */
@@ -0,0 +1,288 @@
+/** \file
+ * stats_journal.c
+ * \brief Persistent statistics journal (EEPROM) source file
+ *
+ */ 
+
+#include "stats_journal.h"
+#include "memory.h"
+#include "../debug/dlog.h"
+#include "../vcp/crclib.h"
+#include "../tasks/radio_control.h"
+#include "warm_start.h"
+
+stats_journal_t		stats_journal WARM_NOINIT;	///< Journal state, totals kept across warm restarts
+
+/// The page is written as it is in RAM
+typedef char stats_page_size_check[(sizeof(stats_page_t) == EEPROM_PAGE_SIZE) ? 1 : -1];
+
+/**
+ * Name         : stats_page_crc
+ *
+ * Synopsis     : static uint16_t stats_page_crc (stats_page_t* page)
+ *
+ * \return			CRC16 of the page sequence number and totals
+ */
+static uint16_t stats_page_crc (stats_page_t* page)
+{
+	return crc16((uint8ptr)page, sizeof(stats_page_t) - sizeof(page->crc));
+}
+
+/**
+ * Name         : stats_journal_init
+ *
+ * Synopsis     : void stats_journal_init (void)
+ *
+ * Description  : Cold start - find the newest valid journal page and load the totals from it
+ * 
+ */
+void stats_journal_init (void)
+{
+	stats_page_t	page;
+	Bool			found = false;
+	uint8_t			i;
+	
+	memset(&stats_journal, 0, sizeof(stats_journal));
+	
+	// Read the EEPROM memory mapped
+	while (NVM.STATUS & NVM_NVMBUSY_bm);
+	NVM.CTRLB |= NVM_EEMAPEN_bm;
+	
+	for (i = 0; i < STATS_JOURNAL_PAGES; i++)
+	{
+		memcpy(&page, (const void*)(MAPPED_EEPROM_START + i * EEPROM_PAGE_SIZE), sizeof(page));
+		
+		if (stats_page_crc(&page) != page.crc)
+		{
+			if (page.sequence != 0xFFFF)	// Erased
+				stats_journal.bad_pages++;
+			continue;
+		}
+		
+		if (!found || (int16_t)(page.sequence - stats_journal.sequence) > 0)
+		{
+			found =						true;
+			stats_journal.sequence =	page.sequence;
+			stats_journal.next_page =	(i + 1) % STATS_JOURNAL_PAGES;
+			stats_journal.totals =		page.totals;
+		}
+	}
+	
+	// Commits load the page buffer through the NVM registers
+	NVM.CTRLB &= ~NVM_EEMAPEN_bm;
+	
+	stats_journal_resume();
+}
+
+/**
+ * Name         : stats_journal_resume
+ *
+ * Synopsis     : void stats_journal_resume (void)
+ *
+ * Description  : Count this boot and commit it as soon as the EEPROM is free. 
+ *				  On a warm start the totals in RAM are newer than the journal - no scan.
+ *				  A commit cut by the reset is written again to the same page.
+ * 
+ */
+void stats_journal_resume (void)
+{
+	if (stats_journal.next_page >= STATS_JOURNAL_PAGES)
+		stats_journal.next_page = 0;
+	
+	stats_journal.totals.boots++;
+	stats_journal.totals.reset_cause =	boot_reset_cause;
+	stats_journal.dirty =				true;
+	stats_journal.commit_now =			true;
+	stats_journal.state =				STATS_JOURNAL_IDLE;
+	
+	dlog_ww(DLOG_STATS_JOURNAL, stats_journal.totals.boots, stats_journal.sequence);
+}
+
+/**
+ * Name         : stats_delta
+ *
+ * Synopsis     : static uint16_t stats_delta (uint16_t live, uint16_t* seen)
+ *
+ * Description  : Change of a free running counter since it was last seen
+ * 
+ */
+static uint16_t stats_delta (uint16_t live, uint16_t* seen)
+{
+	uint16_t delta = live - *seen;
+	
+	*seen = live;
+	return delta;
+}
+
+/**
+ * Name         : stats_journal_merge
+ *
+ * Synopsis     : static Bool stats_journal_merge (void)
+ *
+ * Description  : Add the counters of this run, since the last merge, to the totals
+ * 
+ * \return			true if any total changed
+ */
+static Bool stats_journal_merge (void)
+{
+	stats_journal_t*	j = &stats_journal;
+	stats_totals_t*		t = &stats_journal.totals;
+	uint16_t			delta, changed = 0;
+	uint32_t			bytes;
+	
+	delta = stats_delta(radio_arq.tx_frames,		&j->seen_tx_frames);		t->tx_frames += delta;		changed |= delta;
+	delta = stats_delta(radio_arq.tx_retransmits,	&j->seen_tx_retransmits);	t->tx_retransmits += delta;	changed |= delta;
+	delta = stats_delta(radio_arq.tx_given_up,		&j->seen_tx_given_up);		t->tx_given_up += delta;	changed |= delta;
+	delta = stats_delta(radio_arq.rx_frames,		&j->seen_rx_frames);		t->rx_frames += delta;		changed |= delta;
+	delta = stats_delta(radio_control.resets,		&j->seen_radio_resets);		t->radio_resets += delta;	changed |= delta;
+#if RADIO_STORE
+	delta = stats_delta(radio_pass.passes,			&j->seen_passes);			t->passes += delta;			changed |= delta;
+#endif
+	
+	bytes =						radio_downlink_bytes - j->seen_downlink_bytes;
+	j->seen_downlink_bytes =	radio_downlink_bytes;
+	t->downlink_bytes +=		bytes;
+	
+	return changed || bytes;
+}
+
+/**
+ * Name         : stats_journal_update
+ *
+ * Synopsis     : void stats_journal_update (void)
+ *
+ * Description  : Merge the counters into the totals. Start a commit if they changed and the
+ *				  interval is over (or a commit was asked for), and no commit is in progress.
+ *				  Called on every scheduler pass, never waits.
+ * 
+ */
+void stats_journal_update (void)
+{
+	stats_journal_t* j = &stats_journal;
+	
+	if (stats_journal_merge())
+		j->dirty = true;
+	
+	if (j->state != STATS_JOURNAL_IDLE || !j->dirty)
+		return;
+	
+	if (!j->commit_now && (uint16_t)(get_mticks() - j->commit_time) < STATS_JOURNAL_INTERVAL_MS)
+		return;
+	
+	// Page for the EEPROM ready interrupt to write
+	j->page.sequence =	j->sequence + 1;
+	j->page.totals =	j->totals;
+	j->page.crc =		stats_page_crc(&j->page);
+	j->dirty =			false;
+	j->commit_now =		false;
+	j->commit_time =	get_mticks();
+	j->state =			STATS_JOURNAL_LOAD;
+	
+	NVM.INTCTRL = (NVM.INTCTRL & ~NVM_EELVL_gm) | NVM_EELVL_LO_gc;
+}
+
+/**
+ * Name         : stats_journal_commit
+ *
+ * Synopsis     : void stats_journal_commit (void)
+ *
+ * Description  : Commit the totals on the next update, without waiting for the interval
+ * 
+ */
+void stats_journal_commit (void)
+{
+	stats_journal.dirty =		true;
+	stats_journal.commit_now =	true;
+}
+
+/**
+ * Name         : stats_journal_eeprom_ready
+ *
+ * Synopsis     : void stats_journal_eeprom_ready (void)
+ *
+ * Description  : EEPROM ready interrupt. With a page to commit, load the EEPROM page buffer and 
+ *				  start the page erase and write. When the write is done, move to the next page 
+ *				  and turn the interrupt off.
+ * 
+ */
+void stats_journal_eeprom_ready (void)
+{
+	stats_journal_t*	j = &stats_journal;
+	uint16_t			address = j->next_page * EEPROM_PAGE_SIZE;
+	const uint8_t*		data = (const uint8_t*)&j->page;
+	uint8_t				i;
+	
+	if (j->state == STATS_JOURNAL_LOAD)
+	{
+		NVM.CMD = NVM_CMD_LOAD_EEPROM_BUFFER_gc;
+		NVM.ADDR2 = 0;
+		for (i = 0; i < EEPROM_PAGE_SIZE; i++)
+		{
+			NVM.ADDR1 =	(address + i) >> 8;
+			NVM.ADDR0 =	(address + i) & 0xFF;
+			NVM.DATA0 =	data[i];					// Loads the byte into the page buffer
+		}
+		
+		NVM.CMD =	NVM_CMD_ERASE_WRITE_EEPROM_PAGE_gc;
+		NVM.ADDR1 =	address >> 8;
+		NVM.ADDR0 =	address & 0xFF;
+		ccp_write_io((uint8_t*)&NVM.CTRLA, NVM_CMDEX_bm);
+		NVM.CMD =	NVM_CMD_NO_OPERATION_gc;
+		
+		j->state = STATS_JOURNAL_WRITE;
+		return;
+	}
+	
+	if (j->state == STATS_JOURNAL_WRITE)
+	{
+		j->sequence =	j->page.sequence;
+		j->next_page =	(j->next_page + 1) % STATS_JOURNAL_PAGES;
+		j->commits++;
+		j->state =		STATS_JOURNAL_IDLE;
+	}
+	
+	NVM.INTCTRL = (NVM.INTCTRL & ~NVM_EELVL_gm) | NVM_EELVL_OFF_gc;
+}
+
+/**
+ * Name         : stats_journal_telemetry
+ *
+ * Synopsis     : uint8_t stats_journal_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least STATS_JOURNAL_SIZE bytes
+ *
+ * Description  : Build the statistics journal packet (MSB first) - the totals, the last commit
+ *				  sequence number, commits this run, bad pages found at boot and the commit state
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t stats_journal_telemetry (uint8_t* dst)
+{
+	stats_totals_t*	t = &stats_journal.totals;
+	uint32_t		counters[] = { t->tx_frames, t->tx_retransmits, t->tx_given_up, t->rx_frames, t->downlink_bytes };
+	uint8_t			k, i = 0;
+	
+	dst[i++] = MSB(t->boots);
+	dst[i++] = LSB(t->boots);
+	dst[i++] = t->reset_cause;
+	dst[i++] = t->reserved;
+	for (k = 0; k < sizeof(counters) / sizeof(counters[0]); k++)
+	{
+		dst[i++] = MSB0W(counters[k]);
+		dst[i++] = MSB1W(counters[k]);
+		dst[i++] = MSB2W(counters[k]);
+		dst[i++] = MSB3W(counters[k]);
+	}
+	dst[i++] = MSB(t->radio_resets);
+	dst[i++] = LSB(t->radio_resets);
+	dst[i++] = MSB(t->passes);
+	dst[i++] = LSB(t->passes);
+	dst[i++] = MSB(stats_journal.sequence);
+	dst[i++] = LSB(stats_journal.sequence);
+	dst[i++] = MSB(stats_journal.commits);
+	dst[i++] = LSB(stats_journal.commits);
+	dst[i++] = stats_journal.bad_pages;
+	dst[i++] = stats_journal.state;
+	
+	return i;
+}
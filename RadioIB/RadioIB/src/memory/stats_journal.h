@@ -0,0 +1,85 @@
+/** \file
+ * stats_journal.h
+ * \brief Persistent statistics journal (EEPROM) header file
+ *
+ *	Link statistics and reset counters kept across resets, in EEPROM.
+ *
+ * *	stats_journal_update() merges the counters of this run into RAM totals on every 
+ *		scheduler pass. The totals are committed when they changed, at most every STATS_JOURNAL_INTERVAL_MS
+ * *	A commit writes one EEPROM page, the next one round the journal (wear-levelling), with 
+ *		a sequence number and a CRC. The NVM EEPROM ready interrupt loads the page buffer and
+ *		starts the page write, and tells when it is done - nothing waits for the EEPROM
+ * *	At boot one scan of the journal finds the valid page with the newest sequence number.
+ *		A page torn by a reset fails its CRC and the one before it is used
+ */ 
+
+
+#ifndef STATS_JOURNAL_H_
+#define STATS_JOURNAL_H_
+
+#include <asf.h>
+
+#define STATS_JOURNAL_PAGES			(EEPROM_SIZE / EEPROM_PAGE_SIZE)	///< EEPROM pages used by the journal
+#define STATS_JOURNAL_INTERVAL_MS	60000	///< Min time between commits - 64 pages x 100k writes is 12 years at this rate
+#define STATS_JOURNAL_SIZE			34		///< Size in bytes of the statistics journal packet
+
+// Commit states
+#define STATS_JOURNAL_IDLE			0		///< No commit in progress
+#define STATS_JOURNAL_LOAD			1		///< Page ready, waiting for the EEPROM ready interrupt to write it
+#define STATS_JOURNAL_WRITE			2		///< Page write in progress, waiting for the EEPROM ready interrupt
+
+/// Persistent totals
+typedef struct {
+	uint16_t		boots;					///< Resets and power ups
+	uint8_t			reset_cause;			///< Reset cause of this run (RST.STATUS)
+	uint8_t			reserved;				///< Not used
+	uint32_t		tx_frames;				///< ARQ data frames sent, first transmissions
+	uint32_t		tx_retransmits;			///< ARQ data frames retransmitted
+	uint32_t		tx_given_up;			///< ARQ data frames given up
+	uint32_t		rx_frames;				///< ARQ data frames received
+	uint32_t		downlink_bytes;			///< Payload bytes of the CDHIB frames accepted for the radio
+	uint16_t		radio_resets;			///< Radio resets
+	uint16_t		passes;					///< Ground passes started
+} stats_totals_t;
+
+/// Journal page, one EEPROM page
+typedef struct {
+	uint16_t		sequence;				///< Commit number
+	stats_totals_t	totals;					///< Totals at the commit
+	uint16_t		crc;					///< CRC16 of the sequence and totals
+} stats_page_t;
+
+/// Journal state
+typedef struct {
+	stats_totals_t	totals;					///< Totals so far, this run merged in
+	stats_page_t	page;					///< Page being committed
+	volatile uint8_t	state;				///< STATS_JOURNAL_IDLE...
+	uint8_t			next_page;				///< EEPROM page for the next commit
+	uint16_t		sequence;				///< Sequence number of the last commit
+	Bool			dirty;					///< Totals changed since the last commit
+	Bool			commit_now;				///< Commit without waiting for the interval
+	uint16_t		commit_time;			///< Time of the last commit, ms
+	uint16_t		commits;				///< Commits this run
+	uint8_t			bad_pages;				///< Pages that failed the CRC at boot
+	
+	// Counters of this run already merged
+	uint16_t		seen_tx_frames;
+	uint16_t		seen_tx_retransmits;
+	uint16_t		seen_tx_given_up;
+	uint16_t		seen_rx_frames;
+	uint32_t		seen_downlink_bytes;
+	uint16_t		seen_radio_resets;
+	uint16_t		seen_passes;
+} stats_journal_t;
+
+extern stats_journal_t		stats_journal;	///< Journal state
+
+// Functions
+void		stats_journal_init		(void);
+void		stats_journal_resume	(void);
+void		stats_journal_update	(void);
+void		stats_journal_commit	(void);
+void		stats_journal_eeprom_ready	(void);
+uint8_t		stats_journal_telemetry	(uint8_t* dst);
+
+#endif /* STATS_JOURNAL_H_ */
@@ -0,0 +1,305 @@
+/** \file
+ * warm_start.c
+ * \brief Warm restart source file
+ *
+ */ 
+
+#include <stddef.h>
+#include "warm_start.h"
+#include "memory.h"
+#include "stats_journal.h"
+#include "../debug/dlog.h"
+#include "../tasks/tasks.h"
+
+warm_start_t		warm_start WARM_NOINIT;	///< Warm start state
+Bool				warm_boot;				///< This start is warm
+uint8_t				boot_reset_cause;		///< Reset cause of this start
+uint16_t			boot_timeline[BOOT_MARKS];	///< Boot timeline, 2 us ticks from reset
+uint16_t			boot_pll_ms;			///< First switch to the PLL, ms from the end of board_init()
+
+static uint16_t		boot_done_mticks;		///< mTicks at the end of board_init()
+
+/**
+ * Name         : warm_sum
+ *
+ * Synopsis     : static void warm_sum (uint16_t* sum1, uint16_t* sum2, const void* data, uint16_t size)
+ *
+ * Description  : Add a block to the checksum (Fletcher style, two 16 bit sums)
+ * 
+ */
+static void warm_sum (uint16_t* sum1, uint16_t* sum2, const void* data, uint16_t size)
+{
+	const uint8_t*	p = (const uint8_t*)data;
+	uint16_t		s1 = *sum1, s2 = *sum2;
+	
+	while (size--)
+	{
+		s1 += *p++;
+		s2 += s1;
+	}
+	
+	*sum1 = s1;
+	*sum2 = s2;
+}
+
+/**
+ * Name         : warm_checksum
+ *
+ * Synopsis     : static void warm_checksum (uint16_t* sum1, uint16_t* sum2)
+ *
+ * Description  : Checksum the descriptors of the state kept across resets - everything but 
+ *				  the payload bytes (ARQ frames, store pages, reference payload), to keep it 
+ *				  short enough for every scheduler pass. The payloads have their own checks,
+ *				  written with them and covered here (see warm_start_payloads()).
+ *				  State an ISR changes (mTicks, radio_control, journal commits) is not included.
+ * 
+ */
+static void warm_checksum (uint16_t* sum1, uint16_t* sum2)
+{
+	uint8_t i;
+	
+	*sum1 = WARM_MAGIC;
+	*sum2 = 0;
+	
+	for (i = 0; i < ARQ_WINDOW; i++)
+	{
+		warm_sum(sum1, sum2, &radio_arq.tx[i].size, sizeof(arq_slot_t) - offsetof(arq_slot_t, size));
+		warm_sum(sum1, sum2, &radio_arq.rx[i].size, sizeof(arq_slot_t) - offsetof(arq_slot_t, size));
+	}
+	warm_sum(sum1, sum2, &radio_arq.tx_base, offsetof(arq_t, rx) - offsetof(arq_t, tx_base));
+	warm_sum(sum1, sum2, &radio_arq.rx_next, sizeof(arq_t) - offsetof(arq_t, rx_next));
+	
+#if RADIO_STORE
+	warm_sum(sum1, sum2, &radio_store.used, sizeof(store_t) - offsetof(store_t, used));
+	warm_sum(sum1, sum2, &radio_pass, sizeof(radio_pass));
+#endif
+	warm_sum(sum1, sum2, &radio_reference.size, sizeof(radio_reference_t) - offsetof(radio_reference_t, size));
+	warm_sum(sum1, sum2, &radio_compression, sizeof(radio_compression));
+	warm_sum(sum1, sum2, &radio_pacing, sizeof(radio_pacing));
+	warm_sum(sum1, sum2, &radio_pacing_mode, sizeof(radio_pacing_mode));
+	warm_sum(sum1, sum2, &radio_downlink_bytes, sizeof(radio_downlink_bytes));
+	
+	warm_sum(sum1, sum2, &stats_journal.totals, sizeof(stats_journal.totals));
+	warm_sum(sum1, sum2, &stats_journal.seen_tx_frames, sizeof(stats_journal_t) - offsetof(stats_journal_t, seen_tx_frames));
+}
+
+/**
+ * Name         : warm_start_cold
+ *
+ * Synopsis     : static void warm_start_cold (void)
+ *
+ * Description  : Start cold - clear the warm start state and the millisecond tick
+ * 
+ */
+static void warm_start_cold (void)
+{
+	warm_boot = false;
+	memset(&warm_start, 0, sizeof(warm_start));
+	mTicks = 0;
+}
+
+/**
+ * Name         : warm_start_check
+ *
+ * Synopsis     : Bool warm_start_check (void)
+ *
+ * Description  : Read and clear the reset cause. Pick a warm start for a watchdog, brown-out or 
+ *				  software reset with good state in .noinit. Call once the CPU runs at 32MHz.
+ * 
+ * \return			true for a warm start
+ */
+Bool warm_start_check (void)
+{
+	uint16_t sum1, sum2;
+	
+	boot_pll_ms = BOOT_PLL_UNLOCKED;
+	
+	warm_boot = warm_start_reset() && warm_start.magic == WARM_MAGIC;
+	
+	boot_reset_cause = reset_cause_get_causes();
+	reset_cause_clear_causes(boot_reset_cause);
+	
+	if (warm_boot)
+	{
+		warm_checksum(&sum1, &sum2);
+		warm_boot = (sum1 == warm_start.sum1 && sum2 == warm_start.sum2);
+	}
+	
+	if (warm_boot)
+		warm_start.warm_starts++;
+	else
+		warm_start_cold();
+	
+	return warm_boot;
+}
+
+/**
+ * Name         : warm_start_payloads
+ *
+ * Synopsis     : Bool warm_start_payloads (void)
+ *
+ * Description  : Verify the payloads kept across the reset - ARQ frames, store pages and the 
+ *				  reference payload - against the checks written with them. A bad one turns the
+ *				  start cold. Called on a warm start after phase 1 of board_init(), so the time
+ *				  it takes (a few cycles a byte in use) is not in the way of the receive path.
+ * 
+ * \return			true if the start is still warm
+ */
+Bool warm_start_payloads (void)
+{
+	Bool good = arq_check_payloads(&radio_arq);
+	
+	if (good && radio_reference.state != RADIO_REFERENCE_NONE)
+		good = radio_reference.size <= LZSS_MAX_INPUT && arq_check(0, radio_reference.data, radio_reference.size) == radio_reference.check;
+#if RADIO_STORE
+	if (good)
+		good = store_check_pages(&radio_store);
+#endif
+	
+	if (!good)
+		warm_start_cold();
+	
+	return good;
+}
+
+/**
+ * Name         : warm_start_reset
+ *
+ * Synopsis     : Bool warm_start_reset (void)
+ *
+ * Description  : Check the reset cause (RST.STATUS, before warm_start_check() clears it) for a 
+ *				  watchdog, brown-out or software reset that kept the RAM. Uses no globals - 
+ *				  ram_paint() calls it from .init5.
+ * 
+ * \return			true for a warm reset cause
+ */
+Bool warm_start_reset (void)
+{
+	uint8_t causes = reset_cause_get_causes();
+	
+	return (causes & WARM_RESET_CAUSES) && !(causes & WARM_COLD_CAUSES);
+}
+
+/**
+ * Name         : warm_start_clock
+ *
+ * Synopsis     : void warm_start_clock (void)
+ *
+ * Description  : Keep the boot timer in 2 us ticks after the switch from the 2MHz reset clock to 32MHz
+ * 
+ */
+void warm_start_clock (void)
+{
+	TCC1.CTRLA = TC_CLKSEL_DIV64_gc;
+}
+
+/**
+ * Name         : warm_start_done
+ *
+ * Synopsis     : void warm_start_done (void)
+ *
+ * Description  : End of board_init() - stop the boot timer, keep the start time, log the 
+ *				  boot timeline and seal the state
+ * 
+ */
+void warm_start_done (void)
+{
+	uint16_t ticks = TCC1.CNT;
+	
+	TCC1.CTRLA = TC_CLKSEL_OFF_gc;
+	boot_done_mticks = get_mticks();
+	
+	if (warm_boot)
+		warm_start.warm_ticks = ticks;
+	else
+		warm_start.cold_ticks = ticks;
+	warm_start.magic = WARM_MAGIC;
+	warm_start_seal();
+	
+	dlog_ww(DLOG_BOOT_TIMELINE, boot_timeline[BOOT_MARK_RX], boot_timeline[BOOT_MARK_LINK]);
+	if (boot_timeline[BOOT_MARK_RX] > BOOT_RX_GOAL_TICKS)
+		dlog_w(DLOG_BOOT_RX_GOAL, boot_timeline[BOOT_MARK_RX]);
+	dlog_bw(DLOG_WARM_START, warm_boot, ticks);
+}
+
+/**
+ * Name         : boot_mark
+ *
+ * Synopsis     : void boot_mark (uint8_t mark)
+ *
+ * \param	mark	BOOT_MARK_...
+ *
+ * Description  : Mark the end of a boot phase on the boot timeline
+ * 
+ */
+void boot_mark (uint8_t mark)
+{
+	boot_timeline[mark] = TCC1.CNT;
+}
+
+/**
+ * Name         : boot_pll_locked
+ *
+ * Synopsis     : void boot_pll_locked (void)
+ *
+ * Description  : The system clock was switched to the PLL. Keep the time of the first switch
+ *				  after the start (later ones recover from an external oscillator failure).
+ * 
+ */
+void boot_pll_locked (void)
+{
+	if (boot_pll_ms == BOOT_PLL_UNLOCKED)
+		boot_pll_ms = get_mticks() - boot_done_mticks;
+}
+
+/**
+ * Name         : warm_start_seal
+ *
+ * Synopsis     : void warm_start_seal (void)
+ *
+ * Description  : Checksum the state kept across resets. Called at the end of every scheduler pass.
+ * 
+ */
+void warm_start_seal (void)
+{
+	warm_checksum(&warm_start.sum1, &warm_start.sum2);
+}
+
+/**
+ * Name         : warm_start_telemetry
+ *
+ * Synopsis     : uint8_t warm_start_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least WARM_START_SIZE bytes
+ *
+ * Description  : Build the warm start packet (MSB first) - warm flag, reset cause, warm starts,
+ *				  last cold and warm start times in 2 us ticks, boots (cold and warm, from the journal),
+ *				  the boot timeline of this start in 2 us ticks and the PLL lock time in ms
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t warm_start_telemetry (uint8_t* dst)
+{
+	uint8_t i = 0;
+	uint8_t mark;
+	
+	dst[i++] = warm_boot;
+	dst[i++] = boot_reset_cause;
+	dst[i++] = MSB(warm_start.warm_starts);
+	dst[i++] = LSB(warm_start.warm_starts);
+	dst[i++] = MSB(warm_start.cold_ticks);
+	dst[i++] = LSB(warm_start.cold_ticks);
+	dst[i++] = MSB(warm_start.warm_ticks);
+	dst[i++] = LSB(warm_start.warm_ticks);
+	dst[i++] = MSB(stats_journal.totals.boots);
+	dst[i++] = LSB(stats_journal.totals.boots);
+	for (mark = 0; mark < BOOT_MARKS; mark++)
+	{
+		dst[i++] = MSB(boot_timeline[mark]);
+		dst[i++] = LSB(boot_timeline[mark]);
+	}
+	dst[i++] = MSB(boot_pll_ms);
+	dst[i++] = LSB(boot_pll_ms);
+	
+	return i;
+}
@@ -0,0 +1,74 @@
+/** \file
+ * warm_start.h
+ * \brief Warm restart header file
+ *
+ *	After a watchdog, brown-out or software reset the Radio IB picks up where it was
+ *	instead of starting over. The radio link state - ARQ windows, store-and-forward 
+ *	queue, pass, pacing, compression reference and statistics - is in .noinit, which 
+ *	the startup code does not clear.
+ *
+ * *	warm_start_seal() checksums the state descriptors at the end of every scheduler pass.
+ *		A reset in the middle of a pass that changed them leaves a bad checksum
+ * *	warm_start_check() picks warm init for a warm reset cause with a good checksum, 
+ *		cold init otherwise (power up, external reset, bad checksum)
+ * *	The payloads (ARQ frames, store pages, reference payload) have checks written with 
+ *		them. warm_start_payloads() verifies them once the receive path is up - a bad one
+ *		turns the start cold
+ * *	Warm init sets up the peripherals again and skips the RAM paint, the radio reset and 
+ *		the EEPROM journal scan
+ *
+ *	Boot timeline - TCC1 times the start from .init3 to the end of board_init(), in 2 us ticks.
+ *	board_init() marks the end of each phase with boot_mark(). The goal is BOOT_RX_GOAL_TICKS 
+ *	from reset to the first byte the USARTs can accept (BOOT_MARK_RX). The PLL locks in the 
+ *	background, its time is kept in ms from the end of board_init().
+ */ 
+
+
+#ifndef WARM_START_H_
+#define WARM_START_H_
+
+#include <asf.h>
+
+#define WARM_NOINIT				__attribute__ ((section (".noinit")))	///< Kept across resets, not cleared at startup
+#define WARM_MAGIC				0x574D		///< "WM" - the .noinit state was written by this firmware
+#define WARM_RESET_CAUSES		(CHIP_RESET_CAUSE_WDT | CHIP_RESET_CAUSE_BOD_IO | CHIP_RESET_CAUSE_SOFT)	///< Reset causes that keep the RAM
+#define WARM_COLD_CAUSES		(CHIP_RESET_CAUSE_POR | CHIP_RESET_CAUSE_EXTRST | CHIP_RESET_CAUSE_OCD)	///< Reset causes that always start cold
+#define WARM_START_SIZE			18			///< Size in bytes of the warm start packet
+
+// Boot timeline marks
+#define BOOT_MARK_MAIN			0			///< C startup done, board_init() called
+#define BOOT_MARK_RX			1			///< Phase 1 done - USART receive interrupts on, the first byte can be accepted
+#define BOOT_MARK_LINK			2			///< Phase 2 done - radio link, DMA, timers, radio control and I/Os
+#define BOOT_MARKS				3			///< Number of boot timeline marks
+
+#define BOOT_RX_GOAL_TICKS		500			///< Goal from reset to BOOT_MARK_RX, 2 us ticks (1 ms)
+#define BOOT_PLL_UNLOCKED		0xFFFF		///< boot_pll_ms before the first switch to the PLL
+
+/// Warm start state (.noinit)
+typedef struct {
+	uint16_t		magic;					///< WARM_MAGIC
+	uint16_t		sum1;					///< Checksum of the state descriptors, first sum
+	uint16_t		sum2;					///< Checksum of the state descriptors, second sum
+	uint16_t		warm_starts;			///< Warm starts since the last cold start
+	uint16_t		cold_ticks;				///< Last cold start time, 2 us ticks
+	uint16_t		warm_ticks;				///< Last warm start time, 2 us ticks
+} warm_start_t;
+
+extern warm_start_t		warm_start;		///< Warm start state
+extern Bool				warm_boot;		///< This start is warm
+extern uint8_t			boot_reset_cause;	///< Reset cause of this start (RST.STATUS, cleared after reading)
+extern uint16_t			boot_timeline[BOOT_MARKS];	///< Boot timeline, 2 us ticks from reset
+extern uint16_t			boot_pll_ms;	///< First switch to the PLL, ms from the end of board_init()
+
+// Functions
+Bool		warm_start_check		(void);
+Bool		warm_start_reset		(void);
+Bool		warm_start_payloads		(void);
+void		warm_start_clock		(void);
+void		warm_start_done			(void);
+void		warm_start_seal			(void);
+void		boot_mark				(uint8_t mark);
+void		boot_pll_locked			(void);
+uint8_t		warm_start_telemetry	(uint8_t* dst);
+
+#endif /* WARM_START_H_ */
@@ -0,0 +1,446 @@
+/** \file
+ * arq.c
+ * \brief Selective repeat ARQ source file
+ *
+ */ 
+
+#include <string.h>
+#include "arq.h"
+
+#define ARQ_SLOT(window, seq)	(&(window)[(uint8_t)(seq) & (ARQ_WINDOW - 1)])		///< Window slot of a sequence number
+#define ARQ_IN_RANGE(seq, from, count)	((uint8_t)((seq) - (from)) < (uint8_t)(count))	///< seq in [from, from + count)
+
+/**
+ * Name         : arq_init
+ *
+ * Synopsis     : void arq_init (arq_t* arq)
+ *
+ * \param	arq		ARQ link end
+ *
+ * Description  : Clear both windows and the statistics, load the default configuration
+ * 
+ */
+void arq_init (arq_t* arq)
+{
+	memset(arq, 0, sizeof(arq_t));
+	
+	arq->rto =			ARQ_RTO_MS;
+	arq->nak_holdoff =	ARQ_NAK_HOLDOFF_MS;
+	arq->max_retries =	ARQ_MAX_RETRIES;
+}
+
+/**
+ * Name         : arq_tx_space
+ *
+ * Synopsis     : uint8_t arq_tx_space (arq_t* arq)
+ *
+ * \param	arq		ARQ link end
+ *
+ * \return			Number of frames arq_send() can take now
+ */
+uint8_t arq_tx_space (arq_t* arq)
+{
+	return ARQ_WINDOW - (uint8_t)(arq->tx_next - arq->tx_base);
+}
+
+/**
+ * Name         : arq_send
+ *
+ * Synopsis     : uint8_t arq_send (arq_t* arq, const uint8_t* data, uint16_t size, uint8_t flags)
+ *
+ * \param	arq		ARQ link end
+ * \param	data	Payload
+ * \param	size	Payload size, 1 to ARQ_MAX_PAYLOAD
+ * \param	flags	Data frame flags for the receiver, ARQ_FLAG_...
+ *
+ * Description  : Copy a payload into the transmit window. It is sent by arq_tx_poll().
+ * 
+ * \return			true if the payload was taken, false if the window is full or the payload empty or too big
+ */
+uint8_t arq_send (arq_t* arq, const uint8_t* data, uint16_t size, uint8_t flags)
+{
+	arq_slot_t* slot;
+	
+	// An empty payload would read as "not arrived yet" in the receiver's arq_deliver()
+	if (size == 0 || size > ARQ_MAX_PAYLOAD || arq_tx_space(arq) == 0)
+		return 0;
+	
+	slot = ARQ_SLOT(arq->tx, arq->tx_next);
+	memcpy(&slot->frame[ARQ_HEADER_SIZE], data, size);
+	slot->frame[0] =	ARQ_DATA | (flags & ~ARQ_TYPE_MASK);
+	slot->frame[1] =	arq->tx_next;
+	slot->size =		(uint8_t)size;
+	slot->check =		arq_check(0, data, size);
+	slot->retries =		0;
+	slot->state =		ARQ_SLOT_NEW;
+	
+	arq->tx_next++;
+	return 1;
+}
+
+/**
+ * Name         : arq_tx_acked
+ *
+ * Synopsis     : uint8_t arq_tx_acked (arq_t* arq, uint8_t seq)
+ *
+ * \param	arq		ARQ link end
+ * \param	seq		Sequence number of a frame sent in the last 128 frames
+ *
+ * Description  : Check if a frame has left the transmit window. That is an acknowledge
+ *				  unless the frame was given up - compare tx_given_up to tell.
+ * 
+ * \return			true if the frame is no longer in the transmit window
+ */
+uint8_t arq_tx_acked (arq_t* arq, uint8_t seq)
+{
+	if (!ARQ_IN_RANGE(seq, arq->tx_base, (uint8_t)(arq->tx_next - arq->tx_base)))
+		return 1;
+	
+	return ARQ_SLOT(arq->tx, seq)->state == ARQ_SLOT_FREE;
+}
+
+/**
+ * Name         : arq_tx_advance
+ *
+ * Synopsis     : static void arq_tx_advance (arq_t* arq)
+ *
+ * Description  : Slide the transmit window over the acknowledged frames
+ * 
+ */
+static void arq_tx_advance (arq_t* arq)
+{
+	while (arq->tx_base != arq->tx_next && ARQ_SLOT(arq->tx, arq->tx_base)->state == ARQ_SLOT_FREE)
+		arq->tx_base++;
+}
+
+/**
+ * Name         : arq_rx_advance
+ *
+ * Synopsis     : static void arq_rx_advance (arq_t* arq)
+ *
+ * Description  : Stop waiting for frames the sender gave up on (before rx_skip)
+ * 
+ */
+static void arq_rx_advance (arq_t* arq)
+{
+	while (arq->rx_next != arq->rx_skip && ARQ_IN_RANGE(arq->rx_skip, arq->rx_next, 128) &&
+		   ARQ_SLOT(arq->rx, arq->rx_next)->state == ARQ_SLOT_FREE)
+	{
+		arq->rx_next++;
+		arq->rx_lost++;
+	}
+}
+
+/**
+ * Name         : arq_build_status
+ *
+ * Synopsis     : static void arq_build_status (arq_t* arq)
+ *
+ * Description  : Build the status frame - first missing frame and the bitmap of the frames received after it
+ * 
+ */
+static void arq_build_status (arq_t* arq)
+{
+	uint8_t		expected;
+	uint16_t	bitmap = 0;
+	uint8_t		i;
+	
+	arq_rx_advance(arq);
+	
+	// Frames received but not delivered yet are acknowledged too
+	expected = arq->rx_next;
+	while (ARQ_IN_RANGE(expected, arq->rx_next, ARQ_WINDOW) && ARQ_SLOT(arq->rx, expected)->state != ARQ_SLOT_FREE)
+		expected++;
+	
+	for (i = 0; i < ARQ_WINDOW - 1; i++)
+	{
+		uint8_t seq = expected + 1 + i;
+		
+		if (ARQ_IN_RANGE(seq, arq->rx_next, ARQ_WINDOW) && ARQ_SLOT(arq->rx, seq)->state != ARQ_SLOT_FREE)
+			bitmap |= (1 << i);
+	}
+	
+	arq->status[0] =	ARQ_STATUS;
+	arq->status[1] =	expected;
+	arq->status[2] =	(uint8_t)(bitmap >> 8);
+	arq->status[3] =	(uint8_t)bitmap;
+}
+
+/**
+ * Name         : arq_tx_poll
+ *
+ * Synopsis     : uint16_t arq_tx_poll (arq_t* arq, uint16_t now, uint8_t** frame)
+ *
+ * \param	arq		ARQ link end
+ * \param	now		Time in ms
+ * \param	frame	Out: frame to transmit. ARQ_CRC_SPACE bytes after the frame can be written to
+ *
+ * Description  : Pick the next frame to transmit. Call when the radio transmitter is free.
+ * *			A pending status frame goes first
+ * *			Then the oldest frame that was NAKed (and not sent in the last nak_holdoff ms),
+ *				timed out, or not sent yet
+ * *			A frame that timed out max_retries times is given up
+ * 
+ * \return			Frame size, 0 if there is nothing to send
+ */
+uint16_t arq_tx_poll (arq_t* arq, uint16_t now, uint8_t** frame)
+{
+	uint8_t seq;
+	
+	if (arq->status_pending)
+	{
+		arq->status_pending = 0;
+		arq_build_status(arq);
+		*frame = arq->status;
+		return ARQ_STATUS_SIZE;
+	}
+	
+	for (seq = arq->tx_base; seq != arq->tx_next; seq++)
+	{
+		arq_slot_t*	slot = ARQ_SLOT(arq->tx, seq);
+		uint16_t	age = (uint16_t)(now - slot->sent_time);
+		
+		if (slot->state == ARQ_SLOT_FREE)
+			continue;
+		
+		if (slot->state != ARQ_SLOT_NEW)
+		{
+			if (!(age >= arq->rto || (slot->state == ARQ_SLOT_NAK && age >= arq->nak_holdoff)))
+				continue;
+			
+			if (slot->retries >= arq->max_retries)
+			{
+				slot->state = ARQ_SLOT_FREE;
+				arq->tx_given_up++;
+				continue;
+			}
+			slot->retries++;
+			arq->tx_retransmits++;
+		}
+		else
+		{
+			arq->tx_frames++;
+		}
+		
+		arq_tx_advance(arq);	// Frames given up above move the base
+		
+		slot->frame[2] =	arq->tx_base;
+		slot->state =		ARQ_SLOT_SENT;
+		slot->sent_time =	now;
+		*frame = slot->frame;
+		return ARQ_HEADER_SIZE + slot->size;
+	}
+	
+	arq_tx_advance(arq);
+	return 0;
+}
+
+/**
+ * Name         : arq_receive_status
+ *
+ * Synopsis     : static void arq_receive_status (arq_t* arq, uint8_t expected, uint16_t bitmap)
+ *
+ * Description  : Release the acknowledged frames and mark the NAKed ones for retransmission
+ * 
+ */
+static void arq_receive_status (arq_t* arq, uint8_t expected, uint16_t bitmap)
+{
+	uint8_t in_flight = arq->tx_next - arq->tx_base;
+	uint8_t seq;
+	uint8_t i;
+	
+	// Stale or bad status
+	if (!ARQ_IN_RANGE(expected, arq->tx_base, in_flight + 1))
+		return;
+	
+	// Cumulative acknowledge
+	for (seq = arq->tx_base; seq != expected; seq++)
+		ARQ_SLOT(arq->tx, seq)->state = ARQ_SLOT_FREE;
+	
+	// Selective acknowledge. Everything missing below the highest acknowledged frame is a NAK
+	for (i = 0; i < ARQ_WINDOW - 1; i++)
+	{
+		arq_slot_t* slot;
+		
+		seq = expected + 1 + i;
+		if (!ARQ_IN_RANGE(seq, arq->tx_base, in_flight))
+			continue;
+		
+		slot = ARQ_SLOT(arq->tx, seq);
+		if (bitmap & (1 << i))
+			slot->state = ARQ_SLOT_FREE;
+		else if ((bitmap >> (i + 1)) && slot->state == ARQ_SLOT_SENT)
+			slot->state = ARQ_SLOT_NAK;
+	}
+	
+	// The first missing frame
+	if (bitmap && ARQ_IN_RANGE(expected, arq->tx_base, in_flight) && ARQ_SLOT(arq->tx, expected)->state == ARQ_SLOT_SENT)
+		ARQ_SLOT(arq->tx, expected)->state = ARQ_SLOT_NAK;
+	
+	arq_tx_advance(arq);
+}
+
+/**
+ * Name         : arq_receive_data
+ *
+ * Synopsis     : static void arq_receive_data (arq_t* arq, uint8_t flags, uint8_t seq, uint8_t base, const uint8_t* payload, uint16_t size)
+ *
+ * Description  : Store a data frame in the receive window and schedule a status frame.
+ *				  An empty payload is not stored - it could never be delivered.
+ * 
+ */
+static void arq_receive_data (arq_t* arq, uint8_t flags, uint8_t seq, uint8_t base, const uint8_t* payload, uint16_t size)
+{
+	arq_slot_t* slot;
+	
+	arq->status_pending = 1;
+	
+	// The sender will not retransmit anything before its window base
+	if (ARQ_IN_RANGE(base, arq->rx_skip, 128))
+		arq->rx_skip = base;
+	arq_rx_advance(arq);
+	
+	slot = ARQ_SLOT(arq->rx, seq);
+	if (!ARQ_IN_RANGE(seq, arq->rx_next, ARQ_WINDOW) || slot->state != ARQ_SLOT_FREE || size == 0 || size > ARQ_MAX_PAYLOAD)
+	{
+		arq->rx_duplicates++;
+		return;
+	}
+	
+	memcpy(slot->frame, payload, size);
+	slot->size =	(uint8_t)size;
+	slot->check =	arq_check(0, payload, size);
+	slot->flags =	flags;
+	slot->state =	ARQ_SLOT_NEW;
+	arq->rx_frames++;
+}
+
+/**
+ * Name         : arq_receive
+ *
+ * Synopsis     : void arq_receive (arq_t* arq, uint16_t now, const uint8_t* frame, uint16_t size)
+ *
+ * \param	arq		ARQ link end
+ * \param	now		Time in ms
+ * \param	frame	Received frame (VCP decoded, CRC checked)
+ * \param	size	Frame size
+ *
+ * Description  : Process a frame received from the link
+ * 
+ */
+void arq_receive (arq_t* arq, uint16_t now, const uint8_t* frame, uint16_t size)
+{
+	uint8_t type;
+	
+	(void)now;
+	
+	if (size == 0)
+		return;
+	type = frame[0] & ARQ_TYPE_MASK;
+	
+	if (size >= ARQ_STATUS_SIZE && type == ARQ_STATUS)
+		arq_receive_status(arq, frame[1], ((uint16_t)frame[2] << 8) | frame[3]);
+	else if (size >= ARQ_HEADER_SIZE && type == ARQ_DATA)
+		arq_receive_data(arq, frame[0] & ~ARQ_TYPE_MASK, frame[1], frame[2], &frame[ARQ_HEADER_SIZE], size - ARQ_HEADER_SIZE);
+}
+
+/**
+ * Name         : arq_deliver
+ *
+ * Synopsis     : uint16_t arq_deliver (arq_t* arq, uint8_t** data, uint8_t* flags)
+ *
+ * \param	arq		ARQ link end
+ * \param	data	Out: next payload, in order. ARQ_CRC_SPACE bytes after the payload can be written to
+ * \param	flags	Out: data frame flags from the sender, ARQ_FLAG_... (can be NULL)
+ *
+ * Description  : Get the next received payload in sequence order. Call arq_deliver_done() when done with it.
+ * 
+ * \return			Payload size, 0 if the next payload has not arrived yet (payloads are never empty)
+ */
+uint16_t arq_deliver (arq_t* arq, uint8_t** data, uint8_t* flags)
+{
+	arq_slot_t* slot;
+	
+	arq_rx_advance(arq);
+	
+	slot = ARQ_SLOT(arq->rx, arq->rx_next);
+	if (slot->state == ARQ_SLOT_FREE)
+		return 0;
+	
+	*data = slot->frame;
+	if (flags)
+		*flags = slot->flags;
+	return slot->size;
+}
+
+/**
+ * Name         : arq_deliver_done
+ *
+ * Synopsis     : void arq_deliver_done (arq_t* arq)
+ *
+ * \param	arq		ARQ link end
+ *
+ * Description  : Release the payload from the last arq_deliver() and move to the next one
+ * 
+ */
+void arq_deliver_done (arq_t* arq)
+{
+	ARQ_SLOT(arq->rx, arq->rx_next)->state = ARQ_SLOT_FREE;
+	arq->rx_next++;
+}
+
+/**
+ * Name         : arq_check
+ *
+ * Synopsis     : uint32_t arq_check (uint32_t check, const uint8_t* data, uint16_t size)
+ *
+ * \param	check	Check of the bytes before data, 0 to start
+ * \param	data	Bytes to add
+ * \param	size	Number of bytes
+ *
+ * Description  : Running check of payload bytes - two 16 bit sums (Fletcher style), the second
+ *				  in the upper half. A few cycles a byte; bytes can be added as they are written.
+ * 
+ * \return			The check with data added
+ */
+uint32_t arq_check (uint32_t check, const uint8_t* data, uint16_t size)
+{
+	uint16_t s1 = (uint16_t)check, s2 = (uint16_t)(check >> 16);
+	
+	while (size--)
+	{
+		s1 += *data++;
+		s2 += s1;
+	}
+	
+	return ((uint32_t)s2 << 16) | s1;
+}
+
+/**
+ * Name         : arq_check_payloads
+ *
+ * Synopsis     : uint8_t arq_check_payloads (arq_t* arq)
+ *
+ * \param	arq		ARQ link end
+ *
+ * Description  : Check the payloads in both windows against the checks written with them
+ * 
+ * \return			true if every payload in use is intact
+ */
+uint8_t arq_check_payloads (arq_t* arq)
+{
+	uint8_t i;
+	
+	for (i = 0; i < ARQ_WINDOW; i++)
+	{
+		arq_slot_t* tx = &arq->tx[i];
+		arq_slot_t* rx = &arq->rx[i];
+		
+		if (tx->state != ARQ_SLOT_FREE && (tx->size > ARQ_MAX_PAYLOAD || arq_check(0, &tx->frame[ARQ_HEADER_SIZE], tx->size) != tx->check))
+			return 0;
+		if (rx->state != ARQ_SLOT_FREE && (rx->size > ARQ_MAX_PAYLOAD || arq_check(0, rx->frame, rx->size) != rx->check))
+			return 0;
+	}
+	
+	return 1;
+}
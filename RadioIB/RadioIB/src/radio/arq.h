@@ -0,0 +1,104 @@
+/** \file
+ * arq.h
+ * \brief Selective repeat ARQ header file
+ *
+ *	Link layer ARQ for the radio link. Every radio frame payload starts with an ARQ header:
+ *
+ * *	Data frame:		[ARQ_DATA | flags][sequence][window base][payload]
+ *		flags are passed through to the receiver untouched (ARQ_FLAG_...).
+ *		window base is the oldest frame the sender still retransmits - the receiver 
+ *		stops waiting for anything older.
+ * *	Status frame:	[ARQ_STATUS][expected][bitmap MSB][bitmap LSB]
+ *		Every frame before expected is acknowledged. Bit i of the bitmap acknowledges
+ *		frame expected + 1 + i. A missing frame below the highest acknowledged one is 
+ *		a NAK and is retransmitted without waiting for the timeout.
+ *
+ *	Sequence numbers are 8 bit. Time is passed in by the caller, in milliseconds - arq_sim
+ *	runs both ends of the link on a simulated clock.
+ *
+ *	Every payload in the windows has a check (arq_check()) written with it, so a window kept 
+ *	across a reset can be verified before it is used again (arq_check_payloads()).
+ */ 
+
+
+#ifndef ARQ_H_
+#define ARQ_H_
+
+#include <stdint.h>
+#include "../config/conf_radio_link.h"
+
+// Frame types
+#define ARQ_DATA				0x01		///< Data frame
+#define ARQ_STATUS				0x02		///< Status (ACK/NAK bitmap) frame
+#define ARQ_TYPE_MASK			0x0F		///< Frame type bits of the first header byte
+
+// Data frame flags
+#define ARQ_FLAG_COMPRESSED		0x80		///< Payload is LZSS compressed (radio/lzss.c)
+#define ARQ_FLAG_REFERENCE		0x40		///< Compressed against an earlier payload - the first payload byte is its sequence number
+
+#define ARQ_HEADER_SIZE			3			///< Data frame header size
+#define ARQ_STATUS_SIZE			4			///< Status frame size
+#define ARQ_CRC_SPACE			2			///< Spare bytes after every frame for the CRC added by Create_VCP_frame
+
+// Slot states
+#define ARQ_SLOT_FREE			0x00		///< Free or acknowledged
+#define ARQ_SLOT_NEW			0x01		///< Waiting for the first transmission / received, not delivered
+#define ARQ_SLOT_SENT			0x02		///< Sent, waiting for acknowledge
+#define ARQ_SLOT_NAK			0x03		///< Sent and reported missing by the receiver
+
+#if (ARQ_WINDOW & (ARQ_WINDOW - 1)) || ARQ_WINDOW < 2 || ARQ_WINDOW > 16
+	#error ARQ_WINDOW must be a power of 2 between 2 and 16
+#endif
+
+/// One frame in the transmit or receive window
+typedef struct {
+	uint8_t			frame[ARQ_HEADER_SIZE + ARQ_MAX_PAYLOAD + ARQ_CRC_SPACE];	///< ARQ header and payload
+	uint8_t			size;				///< Payload size
+	uint8_t			flags;				///< Data frame flags, ARQ_FLAG_...
+	uint8_t			state;				///< ARQ_SLOT_...
+	uint8_t			retries;			///< Retransmissions so far
+	uint16_t		sent_time;			///< Time of the last transmission
+	uint32_t		check;				///< arq_check() of the payload, written with it
+} arq_slot_t;
+
+/// ARQ link end
+typedef struct {
+	// Transmit window
+	arq_slot_t		tx[ARQ_WINDOW];		///< Frames in flight, index sequence % ARQ_WINDOW
+	uint8_t			tx_base;			///< Oldest unacknowledged sequence number
+	uint8_t			tx_next;			///< Sequence number of the next new frame
+	
+	// Receive window
+	arq_slot_t		rx[ARQ_WINDOW];		///< Received frames not delivered yet, index sequence % ARQ_WINDOW
+	uint8_t			rx_next;			///< Next sequence number to deliver
+	uint8_t			rx_skip;			///< Sender window base - frames before it will not come any more
+	uint8_t			status_pending;		///< A status frame should be sent
+	uint8_t			status[ARQ_STATUS_SIZE + ARQ_CRC_SPACE];	///< Status frame buffer
+	
+	// Configuration
+	uint16_t		rto;				///< Retransmit timeout, ms
+	uint16_t		nak_holdoff;		///< Min time between a transmission and a NAK retransmission, ms
+	uint8_t			max_retries;		///< Retransmissions before a frame is given up
+	
+	// Statistics
+	uint16_t		tx_frames;			///< Data frames sent, first transmissions
+	uint16_t		tx_retransmits;		///< Data frames retransmitted
+	uint16_t		tx_given_up;		///< Data frames given up after max_retries
+	uint16_t		rx_frames;			///< Data frames received
+	uint16_t		rx_duplicates;		///< Data frames received twice or out of the window
+	uint16_t		rx_lost;			///< Data frames given up by the sender, never received
+} arq_t;
+
+// Functions
+void		arq_init			(arq_t* arq);
+uint8_t		arq_tx_space		(arq_t* arq);
+uint8_t		arq_send			(arq_t* arq, const uint8_t* data, uint16_t size, uint8_t flags);
+uint8_t		arq_tx_acked		(arq_t* arq, uint8_t seq);
+uint16_t	arq_tx_poll			(arq_t* arq, uint16_t now, uint8_t** frame);
+void		arq_receive			(arq_t* arq, uint16_t now, const uint8_t* frame, uint16_t size);
+uint16_t	arq_deliver			(arq_t* arq, uint8_t** data, uint8_t* flags);
+void		arq_deliver_done	(arq_t* arq);
+uint32_t	arq_check			(uint32_t check, const uint8_t* data, uint16_t size);
+uint8_t		arq_check_payloads	(arq_t* arq);
+
+#endif /* ARQ_H_ */
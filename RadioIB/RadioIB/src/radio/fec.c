@@ -0,0 +1,187 @@
+/** \file
+ * fec.c
+ * \brief Forward error correction source file
+ *
+ */ 
+
+#include "fec.h"
+#include "../vcp/vcp_library.h"
+
+#ifdef MCU_PLATFORM
+	#include <avr/pgmspace.h>
+	#define FEC_FLASH				PROGMEM					///< Table in flash
+	#define FEC_READ(table, i)		pgm_read_byte(&(table)[i])
+#else
+	#define FEC_FLASH
+	#define FEC_READ(table, i)		((table)[i])
+#endif
+
+/// alpha^i for i = 0..509, so log sums need no modulo
+const uint8_t fec_exp[510] FEC_FLASH = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26,
+	0x4c, 0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0,
+	0x9d, 0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23,
+	0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1,
+	0x5f, 0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0,
+	0xfd, 0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2,
+	0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce,
+	0x81, 0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc,
+	0x85, 0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54,
+	0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73,
+	0xe6, 0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff,
+	0xe3, 0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41,
+	0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6,
+	0x51, 0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09,
+	0x12, 0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16,
+	0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e, 0x01,
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26, 0x4c,
+	0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d,
+	0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23, 0x46,
+	0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1, 0x5f,
+	0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd,
+	0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2, 0xd9,
+	0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce, 0x81,
+	0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85,
+	0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54, 0xa8,
+	0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73, 0xe6,
+	0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3,
+	0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41, 0x82,
+	0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6, 0x51,
+	0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12,
+	0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16, 0x2c,
+	0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e
+};
+
+/// log(x), log(0) = FEC_A0
+const uint8_t fec_log[256] FEC_FLASH = {
+	0xff, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1a, 0xc6, 0x03, 0xdf, 0x33, 0xee, 0x1b, 0x68, 0xc7, 0x4b,
+	0x04, 0x64, 0xe0, 0x0e, 0x34, 0x8d, 0xef, 0x81, 0x1c, 0xc1, 0x69, 0xf8, 0xc8, 0x08, 0x4c, 0x71,
+	0x05, 0x8a, 0x65, 0x2f, 0xe1, 0x24, 0x0f, 0x21, 0x35, 0x93, 0x8e, 0xda, 0xf0, 0x12, 0x82, 0x45,
+	0x1d, 0xb5, 0xc2, 0x7d, 0x6a, 0x27, 0xf9, 0xb9, 0xc9, 0x9a, 0x09, 0x78, 0x4d, 0xe4, 0x72, 0xa6,
+	0x06, 0xbf, 0x8b, 0x62, 0x66, 0xdd, 0x30, 0xfd, 0xe2, 0x98, 0x25, 0xb3, 0x10, 0x91, 0x22, 0x88,
+	0x36, 0xd0, 0x94, 0xce, 0x8f, 0x96, 0xdb, 0xbd, 0xf1, 0xd2, 0x13, 0x5c, 0x83, 0x38, 0x46, 0x40,
+	0x1e, 0x42, 0xb6, 0xa3, 0xc3, 0x48, 0x7e, 0x6e, 0x6b, 0x3a, 0x28, 0x54, 0xfa, 0x85, 0xba, 0x3d,
+	0xca, 0x5e, 0x9b, 0x9f, 0x0a, 0x15, 0x79, 0x2b, 0x4e, 0xd4, 0xe5, 0xac, 0x73, 0xf3, 0xa7, 0x57,
+	0x07, 0x70, 0xc0, 0xf7, 0x8c, 0x80, 0x63, 0x0d, 0x67, 0x4a, 0xde, 0xed, 0x31, 0xc5, 0xfe, 0x18,
+	0xe3, 0xa5, 0x99, 0x77, 0x26, 0xb8, 0xb4, 0x7c, 0x11, 0x44, 0x92, 0xd9, 0x23, 0x20, 0x89, 0x2e,
+	0x37, 0x3f, 0xd1, 0x5b, 0x95, 0xbc, 0xcf, 0xcd, 0x90, 0x87, 0x97, 0xb2, 0xdc, 0xfc, 0xbe, 0x61,
+	0xf2, 0x56, 0xd3, 0xab, 0x14, 0x2a, 0x5d, 0x9e, 0x84, 0x3c, 0x39, 0x53, 0x47, 0x6d, 0x41, 0xa2,
+	0x1f, 0x2d, 0x43, 0xd8, 0xb7, 0x7b, 0xa4, 0x76, 0xc4, 0x17, 0x49, 0xec, 0x7f, 0x0c, 0x6f, 0xf6,
+	0x6c, 0xa1, 0x3b, 0x52, 0x29, 0x9d, 0x55, 0xaa, 0xfb, 0x60, 0x86, 0xb1, 0xbb, 0xcc, 0x3e, 0x5a,
+	0xcb, 0x59, 0x5f, 0xb0, 0x9c, 0xa9, 0xa0, 0x51, 0x0b, 0xf5, 0x16, 0xeb, 0x7a, 0x75, 0x2c, 0xd7,
+	0x4f, 0xae, 0xd5, 0xe9, 0xe6, 0xe7, 0xad, 0xe8, 0x74, 0xd6, 0xf4, 0xea, 0xa8, 0x50, 0x58, 0xaf
+};
+
+/// Code generator polynomial, log form, lowest order first
+static const uint8_t fec_generator[FEC_PARITY + 1] FEC_FLASH = {
+	0x12, 0xfb, 0xd7, 0x1c, 0x50, 0x6b, 0xf8, 0x35, 0x54, 0xc2, 0x5b, 0x3b, 0xb0, 0x63, 0xcb, 0x89,
+	0x2b, 0x68, 0x89, 0x00, 0x2c, 0x95, 0x94, 0xda, 0x4b, 0x0b, 0xad, 0xfe, 0xc2, 0x6d, 0x08, 0x0b,
+	0x00
+};
+
+/// Data size of each block mode, smallest first
+const uint8_t fec_data_size[FEC_MODES] FEC_FLASH = {
+	16, 32, 64, 96, 128, 160, 192, FEC_MAX_DATA
+};
+
+/// Tag of each block mode - 16 bits or more apart, no FEND / FESC bytes
+const uint8_t fec_tags[FEC_MODES][FEC_TAG_SIZE] FEC_FLASH = {
+	{ 0x15, 0x0A, 0x6D, 0xBE },
+	{ 0xE4, 0x8D, 0x6A, 0x5A },
+	{ 0x39, 0xE4, 0x1E, 0x3A },
+	{ 0xF0, 0x59, 0x95, 0x1D },
+	{ 0x6C, 0x52, 0xB4, 0xE3 },
+	{ 0x36, 0xA6, 0xC7, 0x0D },
+	{ 0x0B, 0x39, 0x6A, 0xF1 },
+	{ 0xC2, 0x67, 0xF9, 0x81 }
+};
+
+/**
+ * Name         : fec_encode
+ *
+ * Synopsis     : void fec_encode (const uint8_t* data, uint8_t size, uint8_t* parity)
+ *
+ * \param	data	Block data
+ * \param	size	Block data size, up to FEC_MAX_DATA
+ * \param	parity	Out: FEC_PARITY parity bytes
+ *
+ * Description  : Systematic Reed-Solomon encoder (shift register division by the generator polynomial)
+ * 
+ */
+void fec_encode (const uint8_t* data, uint8_t size, uint8_t* parity)
+{
+	uint8_t i, j;
+	
+	memset(parity, 0, FEC_PARITY);
+	
+	for (i = 0; i < size; i++)
+	{
+		uint8_t feedback = FEC_READ(fec_log, data[i] ^ parity[0]);
+		
+		if (feedback != FEC_A0)
+		{
+			for (j = 1; j < FEC_PARITY; j++)
+				parity[j] ^= FEC_READ(fec_exp, feedback + FEC_READ(fec_generator, FEC_PARITY - j));
+		}
+		
+		memmove(parity, &parity[1], FEC_PARITY - 1);
+		parity[FEC_PARITY - 1] = (feedback != FEC_A0) ? FEC_READ(fec_exp, feedback + FEC_READ(fec_generator, 0)) : 0;
+	}
+}
+
+/**
+ * Name         : fec_tx_start
+ *
+ * Synopsis     : void fec_tx_start (fec_tx_t* tx, const uint8_t* data, uint16_t size)
+ *
+ * \param	tx		FEC transmit state
+ * \param	data	VCP frame. Must stay unchanged until fec_tx_next() returns 0
+ * \param	size	VCP frame size
+ *
+ * Description  : Start sending a VCP frame
+ * 
+ */
+void fec_tx_start (fec_tx_t* tx, const uint8_t* data, uint16_t size)
+{
+	tx->data =		data;
+	tx->remaining =	size;
+}
+
+/**
+ * Name         : fec_tx_next
+ *
+ * Synopsis     : uint16_t fec_tx_next (fec_tx_t* tx)
+ *
+ * \param	tx		FEC transmit state
+ *
+ * Description  : Build the next block of the frame in tx->block.
+ *				  Full size blocks first, the last one in the smallest mode it fits.
+ * 
+ * \return			Block size, 0 when the whole frame was sent
+ */
+uint16_t fec_tx_next (fec_tx_t* tx)
+{
+	uint8_t		chunk;
+	uint8_t		size;
+	uint8_t		mode = 0;
+	uint8_t		i;
+	
+	if (tx->remaining == 0)
+		return 0;
+	
+	chunk = (tx->remaining > FEC_MAX_DATA) ? FEC_MAX_DATA : (uint8_t)tx->remaining;
+	while (FEC_READ(fec_data_size, mode) < chunk)
+		mode++;
+	size = FEC_READ(fec_data_size, mode);
+	
+	for (i = 0; i < FEC_TAG_SIZE; i++)
+		tx->block[i] = FEC_READ(fec_tags[mode], i);
+	memcpy(&tx->block[FEC_TAG_SIZE], tx->data, chunk);
+	memset(&tx->block[FEC_TAG_SIZE + chunk], FEND, size - chunk);	// The VCP decoder skips the padding
+	fec_encode(&tx->block[FEC_TAG_SIZE], size, &tx->block[FEC_TAG_SIZE + size]);
+	
+	tx->data +=			chunk;
+	tx->remaining -=	chunk;
+	
+	return FEC_TAG_SIZE + size + FEC_PARITY;
+}
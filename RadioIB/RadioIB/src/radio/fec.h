@@ -0,0 +1,53 @@
+/** \file
+ * fec.h
+ * \brief Forward error correction header file
+ *
+ *	Reed-Solomon FEC for the radio downlink, added after the VCP encoder.
+ *	A VCP frame is sent as one or more FEC blocks:
+ *
+ * *	[tag][data][parity]
+ *		tag		FEC_TAG_SIZE bytes, picks one of FEC_MODES data sizes. The tags are far apart
+ *				(16 bits or more) so the receiver can find them with bit errors
+ *		data	up to FEC_MAX_DATA bytes of the VCP frame, padded with FEND to the mode data size
+ *		parity	FEC_PARITY bytes - RS(255,223) shortened to the block, corrects up to 16 bytes
+ *
+ *	The receiver searches for a tag, decodes the block and passes the data to its VCP decoder.
+ *	GF(256) tables are in flash. The ground side decoder is fec_decode, built from this file.
+ */ 
+
+
+#ifndef FEC_H_
+#define FEC_H_
+
+#include "../vcp/common.h"
+
+#define FEC_PARITY				32			///< Parity bytes per block
+#define FEC_MAX_DATA			223			///< Data bytes in a full size block
+#define FEC_TAG_SIZE			4			///< Block tag size
+#define FEC_MODES				8			///< Number of block data sizes
+#define FEC_MAX_BLOCK			(FEC_TAG_SIZE + FEC_MAX_DATA + FEC_PARITY)	///< Largest block on the air
+
+// GF(256) and code parameters, for the decoder
+#define FEC_GF_POLY				0x11D		///< Field generator polynomial
+#define FEC_FCR					1			///< First consecutive root of the code generator polynomial
+#define FEC_A0					255			///< log(0)
+
+/// FEC transmit state - one VCP frame, sent block by block
+typedef struct {
+	const uint8_t*	data;					///< Rest of the frame
+	uint16_t		remaining;				///< Bytes left to send
+	uint8_t			block[FEC_MAX_BLOCK];	///< Block being sent
+} fec_tx_t;
+
+// Tables (in flash on the MCU)
+extern const uint8_t	fec_exp[510];						///< alpha^i, twice over
+extern const uint8_t	fec_log[256];						///< log(x), log(0) = FEC_A0
+extern const uint8_t	fec_data_size[FEC_MODES];			///< Data size of each block mode
+extern const uint8_t	fec_tags[FEC_MODES][FEC_TAG_SIZE];	///< Tag of each block mode
+
+// Functions
+void		fec_encode			(const uint8_t* data, uint8_t size, uint8_t* parity);
+void		fec_tx_start		(fec_tx_t* tx, const uint8_t* data, uint16_t size);
+uint16_t	fec_tx_next			(fec_tx_t* tx);
+
+#endif /* FEC_H_ */
@@ -0,0 +1,197 @@
+/** \file
+ * lzss.c
+ * \brief LZSS frame compression source file
+ *
+ */ 
+
+#include <string.h>
+#include "lzss.h"
+
+#define LZSS_HASH(p)	((uint8_t)((p)[0] ^ ((p)[1] << 3) ^ ((p)[1] >> 5) ^ ((p)[2] << 1)))	///< Hash of the 3 bytes at p
+
+/**
+ * Name         : lzss_insert
+ *
+ * Synopsis     : static void lzss_insert (lzss_t* lz, uint8_t pos, uint16_t end)
+ *
+ * Description  : Add a window position to its hash chain
+ * 
+ */
+static void lzss_insert (lzss_t* lz, uint8_t pos, uint16_t end)
+{
+	uint8_t hash;
+	
+	if (pos + LZSS_MIN_MATCH > end)
+		return;
+	
+	hash =				LZSS_HASH(&lz->window[pos]);
+	lz->prev[pos] =		lz->head[hash];
+	lz->head[hash] =	pos;
+}
+
+/**
+ * Name         : lzss_compress
+ *
+ * Synopsis     : uint16_t lzss_compress (lzss_t* lz, const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size)
+ *
+ * \param	lz			Compressor state (work area, nothing is kept between frames)
+ * \param	dict		Dictionary - a payload the receiver already has, NULL for none
+ * \param	dict_size	Dictionary size, up to LZSS_MAX_INPUT bytes
+ * \param	src			Frame to compress, up to LZSS_MAX_INPUT bytes
+ * \param	size		Frame size
+ * \param	dst			Compressed frame
+ * \param	dst_size	Compressed frame buffer size
+ *
+ * Description  : Compress a frame. Gives up as soon as the output does not fit in dst_size,
+ *				  so pass size - 1 to only get frames that got smaller.
+ * 
+ * \return				Compressed size, 0 if it does not fit
+ */
+uint16_t lzss_compress (lzss_t* lz, const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size)
+{
+	uint16_t	out = 0;
+	uint16_t	control = 0;
+	uint16_t	end;
+	uint8_t		bit = 8;
+	uint8_t		pos;
+	
+	if (dict == NULL)
+		dict_size = 0;
+	if (size == 0 || size > LZSS_MAX_INPUT || dict_size > LZSS_MAX_INPUT)
+		return 0;
+	
+	memset(lz->head, LZSS_NONE, sizeof(lz->head));
+	memcpy(lz->window, dict, dict_size);
+	memcpy(&lz->window[dict_size], src, size);
+	end = dict_size + size;
+	
+	for (pos = 0; pos < dict_size; pos++)
+		lzss_insert(lz, pos, end);
+	
+	while (pos < end)
+	{
+		uint16_t	best_length = 0;
+		uint8_t		best_offset = 0;
+		
+		// New control byte every 8 tokens
+		if (bit == 8)
+		{
+			if (out >= dst_size)
+				return 0;
+			control =		out;
+			dst[out++] =	0;
+			bit =			0;
+		}
+		
+		// Longest match along the hash chain
+		if (pos + LZSS_MIN_MATCH <= end)
+		{
+			uint8_t		candidate = lz->head[LZSS_HASH(&lz->window[pos])];
+			uint8_t		chain = LZSS_MAX_CHAIN;
+			uint16_t	limit = end - pos;
+			
+			if (limit > LZSS_MAX_MATCH)
+				limit = LZSS_MAX_MATCH;
+			
+			while (candidate != LZSS_NONE && chain--)
+			{
+				uint16_t length = 0;
+				
+				while (length < limit && lz->window[candidate + length] == lz->window[pos + length])
+					length++;
+				
+				if (length > best_length)
+				{
+					best_length =	length;
+					best_offset =	pos - candidate;
+					if (length == limit)
+						break;
+				}
+				candidate = lz->prev[candidate];
+			}
+		}
+		
+		if (best_length >= LZSS_MIN_MATCH)
+		{
+			if (out + 2 > dst_size)
+				return 0;
+			dst[control] |=	(1 << bit);
+			dst[out++] =	best_offset - 1;
+			dst[out++] =	(uint8_t)(best_length - LZSS_MIN_MATCH);
+			
+			while (best_length--)
+				lzss_insert(lz, pos++, end);
+		}
+		else
+		{
+			if (out >= dst_size)
+				return 0;
+			dst[out++] = lz->window[pos];
+			lzss_insert(lz, pos++, end);
+		}
+		bit++;
+	}
+	
+	return out;
+}
+
+/**
+ * Name         : lzss_decompress
+ *
+ * Synopsis     : uint16_t lzss_decompress (const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size)
+ *
+ * \param	dict		Dictionary the frame was compressed against, NULL for none
+ * \param	dict_size	Dictionary size
+ * \param	src			Compressed frame
+ * \param	size		Compressed frame size
+ * \param	dst			Decompressed frame
+ * \param	dst_size	Decompressed frame buffer size
+ *
+ * Description  : Decompress a frame from lzss_compress()
+ * 
+ * \return				Decompressed size, 0 if the frame is corrupted or does not fit in dst_size
+ */
+uint16_t lzss_decompress (const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size)
+{
+	uint16_t	in = 0;
+	uint16_t	out = 0;
+	
+	if (dict == NULL)
+		dict_size = 0;
+	
+	while (in < size)
+	{
+		uint8_t control = src[in++];
+		uint8_t bit;
+		
+		for (bit = 0; bit < 8 && in < size; bit++)
+		{
+			if (control & (1 << bit))
+			{
+				uint16_t offset, length;
+				
+				if (in + 2 > size)
+					return 0;
+				offset =	src[in++] + 1;
+				length =	src[in++] + LZSS_MIN_MATCH;
+				if (offset > out + dict_size || out + length > dst_size)
+					return 0;
+				
+				// Byte by byte - a match may overlap its own output
+				while (length--)
+				{
+					dst[out] = (offset > out) ? dict[dict_size + out - offset] : dst[out - offset];
+					out++;
+				}
+			}
+			else
+			{
+				if (out >= dst_size)
+					return 0;
+				dst[out++] = src[in++];
+			}
+		}
+	}
+	
+	return out;
+}
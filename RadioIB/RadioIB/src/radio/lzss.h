@@ -0,0 +1,47 @@
+/** \file
+ * lzss.h
+ * \brief LZSS frame compression header file
+ *
+ *	Small window LZSS for radio frame payloads. A frame is compressed on its own or 
+ *	against a dictionary - an earlier payload the receiver is known to have - so a lost 
+ *	frame never breaks the frames after it. Compressed format:
+ *
+ * *	A control byte before every 8 tokens, bit 0 first. 0 = literal, 1 = match
+ * *	Literal:	[byte]
+ * *	Match:		[offset - 1][length - LZSS_MIN_MATCH]	copy length bytes from offset bytes back,
+ *				reaching back into the dictionary past the start of the frame
+ *
+ *	The compressor finds matches with a hash chain over the dictionary and the frame 
+ *	(lzss_t, about 256 + 4 x LZSS_MAX_INPUT bytes of RAM). The decompressor needs no RAM 
+ *	but its output. lzss_tool decompresses the ground side with it.
+ */ 
+
+
+#ifndef LZSS_H_
+#define LZSS_H_
+
+#include <stdint.h>
+#include "../config/conf_radio_link.h"
+
+#define LZSS_MIN_MATCH			3			///< Shortest match, shorter ones are sent as literals
+#define LZSS_MAX_MATCH			(LZSS_MIN_MATCH + 255)	///< Longest match
+#define LZSS_HASH_SIZE			256			///< Hash chain heads
+#define LZSS_NONE				0xFF		///< End of a hash chain
+#define LZSS_WINDOW				(2 * LZSS_MAX_INPUT)	///< Dictionary and frame
+
+#if LZSS_WINDOW > 255
+	#error LZSS_MAX_INPUT must be below 128 - hash chain positions are 8 bit
+#endif
+
+/// Compressor state
+typedef struct {
+	uint8_t		head[LZSS_HASH_SIZE];		///< Last position with each hash
+	uint8_t		prev[LZSS_WINDOW];			///< Previous position with the same hash
+	uint8_t		window[LZSS_WINDOW];		///< Dictionary followed by the frame
+} lzss_t;
+
+// Functions
+uint16_t	lzss_compress		(lzss_t* lz, const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size);
+uint16_t	lzss_decompress		(const uint8_t* dict, uint16_t dict_size, const uint8_t* src, uint16_t size, uint8_t* dst, uint16_t dst_size);
+
+#endif /* LZSS_H_ */
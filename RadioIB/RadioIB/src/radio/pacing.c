@@ -0,0 +1,107 @@
+/** \file
+ * pacing.c
+ * \brief Radio transmit pacing (token bucket) source file
+ *
+ */ 
+
+#include "pacing.h"
+
+/**
+ * Name         : pacing_init
+ *
+ * Synopsis     : void pacing_init (pacing_t* pacing, uint16_t rate, uint16_t burst, uint16_t now)
+ *
+ * \param	pacing	Token bucket
+ * \param	rate	Fill rate in bytes per second, PACING_OFF for no pacing
+ * \param	burst	Bucket size in bytes, at least 1
+ * \param	now		Milliseconds tick
+ *
+ * Description  : Set the rate and the bucket size and start with a full bucket.
+ *				  Also used to change them at run time - the counters are kept.
+ * 
+ */
+void pacing_init (pacing_t* pacing, uint16_t rate, uint16_t burst, uint16_t now)
+{
+	pacing->rate =		rate;
+	pacing->burst =		burst ? burst : 1;
+	pacing->tokens =	pacing->burst;
+	pacing->fraction =	0;
+	pacing->last_time =	now;
+	pacing->waiting =	0;
+}
+
+/**
+ * Name         : pacing_fill
+ *
+ * Synopsis     : static void pacing_fill (pacing_t* pacing, uint16_t now)
+ *
+ * Description  : Add the tokens for the time since the last fill
+ * 
+ */
+static void pacing_fill (pacing_t* pacing, uint16_t now)
+{
+	uint16_t	elapsed = now - pacing->last_time;
+	uint32_t	added;
+	
+	if (elapsed == 0)
+		return;
+	pacing->last_time = now;
+	
+	// A full bucket stays full - skip the division
+	if (pacing->tokens >= pacing->burst)
+		return;
+	
+	added =				(uint32_t)elapsed * pacing->rate + pacing->fraction;
+	pacing->fraction =	added % 1000;
+	added /=			1000;
+	
+	if (added >= (uint32_t)(pacing->burst - pacing->tokens))
+	{
+		pacing->tokens =	pacing->burst;
+		pacing->fraction =	0;
+	}
+	else
+		pacing->tokens += added;
+}
+
+/**
+ * Name         : pacing_take
+ *
+ * Synopsis     : uint8_t pacing_take (pacing_t* pacing, uint16_t now, uint16_t size)
+ *
+ * \param	pacing	Token bucket
+ * \param	now		Milliseconds tick
+ * \param	size	Transmission size in bytes
+ *
+ * Description  : Release a transmission if the bucket holds enough tokens for it, and take them.
+ *				  Call again with the same transmission until it is released.
+ * 
+ * \return			1 if the transmission may be sent now, 0 to hold it
+ */
+uint8_t pacing_take (pacing_t* pacing, uint16_t now, uint16_t size)
+{
+	if (pacing->rate == PACING_OFF)
+	{
+		pacing->bytes += size;
+		return 1;
+	}
+	
+	pacing_fill(pacing, now);
+	
+	// Larger than the bucket - send it on a full bucket
+	if (size > pacing->burst)
+		size = pacing->burst;
+	
+	if (pacing->tokens < size)
+	{
+		if (!pacing->waiting)
+			pacing->held++;
+		pacing->waiting = 1;
+		return 0;
+	}
+	
+	pacing->waiting =	0;
+	pacing->tokens -=	size;
+	pacing->bytes +=	size;
+	return 1;
+}
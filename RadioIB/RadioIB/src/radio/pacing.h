@@ -0,0 +1,38 @@
+/** \file
+ * pacing.h
+ * \brief Radio transmit pacing (token bucket) header file
+ *
+ *	The radio takes bytes from the UART faster than it sends them on the air, and drops
+ *	them when its buffer is full. A token bucket holds the transmissions to the radio
+ *	to its air rate:
+ *
+ * *	The bucket fills at rate bytes per second, up to burst bytes (the radio buffer size)
+ * *	A transmission is released when the bucket holds its size in bytes, which it takes
+ *		from the bucket. A transmission larger than the bucket waits for a full bucket
+ */ 
+
+
+#ifndef PACING_H_
+#define PACING_H_
+
+#include "../vcp/common.h"
+
+#define PACING_OFF				0			///< Rate that turns pacing off - every transmission is released
+
+/// Token bucket state
+typedef struct {
+	uint16_t		rate;					///< Fill rate in bytes per second, PACING_OFF for no pacing
+	uint16_t		burst;					///< Bucket size in bytes
+	uint16_t		tokens;					///< Bytes that may be sent now
+	uint16_t		fraction;				///< Part of a token, in 1/1000 byte
+	uint16_t		last_time;				///< Milliseconds tick of the last fill
+	uint8_t			waiting;				///< A transmission is held for tokens
+	uint16_t		held;					///< Transmissions held for tokens
+	uint32_t		bytes;					///< Bytes released
+} pacing_t;
+
+// Functions
+void		pacing_init			(pacing_t* pacing, uint16_t rate, uint16_t burst, uint16_t now);
+uint8_t		pacing_take			(pacing_t* pacing, uint16_t now, uint16_t size);
+
+#endif /* PACING_H_ */
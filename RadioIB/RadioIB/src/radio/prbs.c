@@ -0,0 +1,129 @@
+/** \file
+ * prbs.c
+ * \brief PRBS generator and checker source file
+ *
+ */ 
+
+#include "prbs.h"
+
+/**
+ * Name         : prbs_init
+ *
+ * Synopsis     : uint8_t prbs_init (prbs_t* prbs, uint8_t pattern)
+ *
+ * \param	prbs	Generator or checker
+ * \param	pattern	PRBS_9, PRBS_15 or PRBS_23
+ *
+ * Description  : Start the sequence with all ones, clear the counters. A checker starts hunting
+ * 
+ * \return			0 for an unknown pattern
+ */
+uint8_t prbs_init (prbs_t* prbs, uint8_t pattern)
+{
+	switch (pattern)
+	{
+		case PRBS_9:	prbs->tap = 4;		break;
+		case PRBS_15:	prbs->tap = 13;		break;
+		case PRBS_23:	prbs->tap = 17;		break;
+		default:		return 0;
+	}
+	prbs->length =			pattern;
+	prbs->mask =			((uint32_t)1 << pattern) - 1;
+	prbs->reg =				prbs->mask;
+	prbs->locked =			0;
+	prbs->count =			0;
+	prbs->window_errors =	0;
+	prbs->bits =			0;
+	prbs->errors =			0;
+	prbs->sync_losses =		0;
+	return 1;
+}
+
+/**
+ * Name         : prbs_bit
+ *
+ * Synopsis     : static uint8_t prbs_bit (const prbs_t* prbs)
+ *
+ * \return		The next bit of the sequence from the register
+ */
+static inline uint8_t prbs_bit (const prbs_t* prbs)
+{
+	return ((prbs->reg >> (prbs->length - 1)) ^ (prbs->reg >> prbs->tap)) & 1;
+}
+
+/**
+ * Name         : prbs_next
+ *
+ * Synopsis     : uint8_t prbs_next (prbs_t* prbs)
+ *
+ * \return		The next 8 bits of the sequence, the first in bit 0
+ */
+uint8_t prbs_next (prbs_t* prbs)
+{
+	uint8_t byte = 0;
+	uint8_t i, bit;
+	
+	for (i = 0; i < 8; i++)
+	{
+		bit =		prbs_bit(prbs);
+		prbs->reg =	((prbs->reg << 1) | bit) & prbs->mask;
+		byte |=		bit << i;
+	}
+	return byte;
+}
+
+/**
+ * Name         : prbs_check
+ *
+ * Synopsis     : void prbs_check (prbs_t* prbs, uint8_t byte)
+ *
+ * \param	prbs	Checker
+ * \param	byte	Received byte, the first bit in bit 0
+ *
+ * Description  : Hunt for the sequence in the received bits, or count the bit errors when locked
+ * 
+ */
+void prbs_check (prbs_t* prbs, uint8_t byte)
+{
+	uint8_t i, bit, expected;
+	
+	for (i = 0; i < 8; i++, byte >>= 1)
+	{
+		bit =		byte & 1;
+		expected =	prbs_bit(prbs);
+		
+		if (!prbs->locked)
+		{
+			// Load the received bit. An all zero register predicts zeros forever - not the sequence
+			prbs->reg = ((prbs->reg << 1) | bit) & prbs->mask;
+			if (bit != expected || prbs->reg == 0)
+				prbs->count = 0;
+			else if (++prbs->count >= PRBS_SYNC_BITS)
+			{
+				prbs->locked =			1;
+				prbs->count =			0;
+				prbs->window_errors =	0;
+			}
+			continue;
+		}
+		
+		// Locked - the register runs on its own
+		prbs->reg = ((prbs->reg << 1) | expected) & prbs->mask;
+		prbs->bits++;
+		if (bit != expected)
+		{
+			prbs->errors++;
+			prbs->window_errors++;
+		}
+		if (++prbs->count >= PRBS_LOSS_WINDOW)
+		{
+			if (prbs->window_errors > PRBS_LOSS_ERRORS)
+			{
+				prbs->locked = 0;
+				prbs->sync_losses++;
+			}
+			prbs->count =			0;
+			prbs->window_errors =	0;
+		}
+	}
+}
@@ -0,0 +1,47 @@
+/** \file
+ * prbs.h
+ * \brief PRBS generator and checker header file, for the bit error rate tester
+ *
+ *	PRBS-9 (x^9 + x^5 + 1), PRBS-15 (x^15 + x^14 + 1) and PRBS-23 (x^23 + x^18 + 1), 
+ *	ITU-T O.150 polynomials, 8 bits per byte LSB first - the order a UART sends them.
+ *
+ *	The checker hunts for the sequence by loading the received bits into its register until
+ *	PRBS_SYNC_BITS bits in a row are as predicted. Locked, the register runs on its own, so a
+ *	bit error counts once. More than PRBS_LOSS_ERRORS errors in PRBS_LOSS_WINDOW bits - a slip
+ *	or lost bytes - count a sync loss and start a new hunt. Bits are only counted while locked.
+ */ 
+
+
+#ifndef PRBS_H_
+#define PRBS_H_
+
+#include "../vcp/common.h"
+
+#define PRBS_9					9			///< Pattern, the register length
+#define PRBS_15					15
+#define PRBS_23					23
+
+#define PRBS_SYNC_BITS			64			///< Bits in a row as predicted to lock
+#define PRBS_LOSS_WINDOW		64			///< Bits in a sync loss window
+#define PRBS_LOSS_ERRORS		8			///< Errors in a window that lose the lock
+
+/// PRBS generator or checker
+typedef struct {
+	uint32_t		reg;					///< Shift register, newest bit in bit 0
+	uint32_t		mask;					///< Register bits
+	uint8_t			tap;					///< Second tap, bit number (the first is length - 1)
+	uint8_t			length;					///< Register length, PRBS_9...
+	uint8_t			locked;					///< Checker in sync
+	uint8_t			count;					///< Hunt - bits as predicted in a row. Locked - bits in the loss window
+	uint8_t			window_errors;			///< Errors in the loss window
+	uint32_t		bits;					///< Bits checked while locked
+	uint32_t		errors;					///< Bit errors while locked
+	uint16_t		sync_losses;			///< Locks lost
+} prbs_t;
+
+// Functions
+uint8_t		prbs_init			(prbs_t* prbs, uint8_t pattern);
+uint8_t		prbs_next			(prbs_t* prbs);
+void		prbs_check			(prbs_t* prbs, uint8_t byte);
+
+#endif /* PRBS_H_ */
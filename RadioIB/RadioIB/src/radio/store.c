@@ -0,0 +1,278 @@
+/** \file
+ * store.c
+ * \brief Store-and-forward downlink buffer source file
+ *
+ */ 
+
+#include "store.h"
+#include "arq.h"
+
+/**
+ * Name         : store_init
+ *
+ * Synopsis     : void store_init (store_t* st)
+ *
+ * Description  : Empty the store - all pages free, statistics cleared
+ * 
+ */
+void store_init (store_t* st)
+{
+	uint8_t i;
+	
+	for (i = 0; i < STORE_PAGES; i++)
+	{
+		st->used[i] =	0;
+		st->check[i] =	0;
+		st->read[i] =	0;
+		st->next[i] =	(i + 1 < STORE_PAGES) ? i + 1 : STORE_NO_PAGE;
+	}
+	st->free = 0;
+	
+	for (i = 0; i < STORE_CLASSES; i++)
+	{
+		st->head[i] =		STORE_NO_PAGE;
+		st->tail[i] =		STORE_NO_PAGE;
+		st->records[i] =	0;
+		st->dropped[i] =	0;
+	}
+	st->bytes_stored =	0;
+	st->bytes_sent =	0;
+}
+
+/**
+ * Name         : store_page_records
+ *
+ * Synopsis     : static uint16_t store_page_records (store_t* st, uint8_t page)
+ *
+ * Description  : Count the records of a page not sent yet
+ * 
+ */
+static uint16_t store_page_records (store_t* st, uint8_t page)
+{
+	uint16_t	offset = st->read[page];
+	uint16_t	count = 0;
+	
+	while (offset < st->used[page])
+	{
+		offset += STORE_RECORD_HEADER + st->page[page][offset];
+		count++;
+	}
+	
+	return count;
+}
+
+/**
+ * Name         : store_pop_page
+ *
+ * Synopsis     : static void store_pop_page (store_t* st, uint8_t data_class)
+ *
+ * Description  : Move the oldest page of a class to the free list
+ * 
+ */
+static void store_pop_page (store_t* st, uint8_t data_class)
+{
+	uint8_t page = st->head[data_class];
+	
+	st->head[data_class] = st->next[page];
+	if (st->head[data_class] == STORE_NO_PAGE)
+		st->tail[data_class] = STORE_NO_PAGE;
+	
+	st->used[page] =	0;
+	st->check[page] =	0;
+	st->read[page] =	0;
+	st->next[page] =	st->free;
+	st->free =			page;
+}
+
+/**
+ * Name         : store_new_page
+ *
+ * Synopsis     : static uint8_t store_new_page (store_t* st, uint8_t data_class)
+ *
+ * Description  : Add a page at the end of a class list. Without a free page, take the oldest page 
+ *				  of the lowest priority class, if it is not of higher priority than data_class.
+ * 
+ * \return			Page, STORE_NO_PAGE if there is no space for the class
+ */
+static uint8_t store_new_page (store_t* st, uint8_t data_class)
+{
+	uint8_t		page;
+	uint16_t	lost;
+	
+	if (st->free == STORE_NO_PAGE)
+	{
+		uint8_t victim = STORE_CLASSES - 1;
+		
+		while (st->head[victim] == STORE_NO_PAGE)
+			victim--;								// Some class has pages - the free list is empty
+		if (victim < data_class)
+			return STORE_NO_PAGE;
+		
+		lost =					store_page_records(st, st->head[victim]);
+		st->records[victim] -=	lost;
+		st->dropped[victim] +=	lost;
+		store_pop_page(st, victim);
+	}
+	
+	page =			st->free;
+	st->free =		st->next[page];
+	st->next[page] = STORE_NO_PAGE;
+	
+	if (st->tail[data_class] == STORE_NO_PAGE)
+		st->head[data_class] = page;
+	else
+		st->next[st->tail[data_class]] = page;
+	st->tail[data_class] = page;
+	
+	return page;
+}
+
+/**
+ * Name         : store_append
+ *
+ * Synopsis     : uint8_t store_append (store_t* st, uint8_t data_class, const uint8_t* data, uint8_t size)
+ *
+ * \param	st			Store
+ * \param	data_class	Data class, 0 (highest priority) to STORE_CLASSES - 1
+ * \param	data		Record data
+ * \param	size		Record size, 1 to STORE_PAGE_SIZE - STORE_RECORD_HEADER bytes
+ *
+ * Description  : Append a record to the store. A copy of up to one page - never waits.
+ * 
+ * \return				1 if stored, 0 if dropped
+ */
+uint8_t store_append (store_t* st, uint8_t data_class, const uint8_t* data, uint8_t size)
+{
+	uint8_t		page;
+	uint16_t	offset;
+	
+	if (data_class >= STORE_CLASSES)
+		data_class = STORE_CLASSES - 1;
+	
+	if (size == 0 || (uint16_t)size + STORE_RECORD_HEADER > STORE_PAGE_SIZE)
+	{
+		st->dropped[data_class]++;
+		return 0;
+	}
+	
+	page = st->tail[data_class];
+	if (page == STORE_NO_PAGE || st->used[page] + STORE_RECORD_HEADER + size > STORE_PAGE_SIZE)
+	{
+		page = store_new_page(st, data_class);
+		if (page == STORE_NO_PAGE)
+		{
+			st->dropped[data_class]++;
+			return 0;
+		}
+	}
+	
+	offset =					st->used[page];
+	st->page[page][offset] =	size;
+	memcpy(&st->page[page][offset + STORE_RECORD_HEADER], data, size);
+	st->used[page] =			offset + STORE_RECORD_HEADER + size;
+	st->check[page] =			arq_check(st->check[page], &st->page[page][offset], STORE_RECORD_HEADER + size);
+	
+	st->records[data_class]++;
+	st->bytes_stored += size;
+	return 1;
+}
+
+/**
+ * Name         : store_next
+ *
+ * Synopsis     : uint8_t store_next (store_t* st, uint8_t** data)
+ *
+ * \param	st		Store
+ * \param	data	Out: the record data, in place in the store until store_release()
+ *
+ * Description  : Find the oldest record of the highest priority class
+ * 
+ * \return			Record size, 0 if the store is empty
+ */
+uint8_t store_next (store_t* st, uint8_t** data)
+{
+	uint8_t data_class;
+	
+	for (data_class = 0; data_class < STORE_CLASSES; data_class++)
+	{
+		uint8_t page = st->head[data_class];
+		
+		if (page != STORE_NO_PAGE && st->read[page] < st->used[page])
+		{
+			*data = &st->page[page][st->read[page] + STORE_RECORD_HEADER];
+			return st->page[page][st->read[page]];
+		}
+	}
+	
+	return 0;
+}
+
+/**
+ * Name         : store_release
+ *
+ * Synopsis     : void store_release (store_t* st)
+ *
+ * Description  : Remove the record store_next() gave. Its page is freed once all its records are sent.
+ * 
+ */
+void store_release (store_t* st)
+{
+	uint8_t data_class;
+	
+	for (data_class = 0; data_class < STORE_CLASSES; data_class++)
+	{
+		uint8_t page = st->head[data_class];
+		
+		if (page != STORE_NO_PAGE && st->read[page] < st->used[page])
+		{
+			uint8_t size = st->page[page][st->read[page]];
+			
+			st->read[page] += STORE_RECORD_HEADER + size;
+			st->records[data_class]--;
+			st->bytes_sent += size;
+			
+			if (st->read[page] >= st->used[page])
+				store_pop_page(st, data_class);
+			return;
+		}
+	}
+}
+
+/**
+ * Name         : store_free_pages
+ *
+ * Synopsis     : uint8_t store_free_pages (store_t* st)
+ *
+ * \return			Number of free pages
+ */
+uint8_t store_free_pages (store_t* st)
+{
+	uint8_t page, count = 0;
+	
+	for (page = st->free; page != STORE_NO_PAGE; page = st->next[page])
+		count++;
+	
+	return count;
+}
+
+/**
+ * Name         : store_check_pages
+ *
+ * Synopsis     : uint8_t store_check_pages (store_t* st)
+ *
+ * Description  : Check the bytes written in every page against the page check
+ * 
+ * \return			true if every page is intact
+ */
+uint8_t store_check_pages (store_t* st)
+{
+	uint8_t page;
+	
+	for (page = 0; page < STORE_PAGES; page++)
+	{
+		if (st->used[page] > STORE_PAGE_SIZE || arq_check(0, st->page[page], st->used[page]) != st->check[page])
+			return 0;
+	}
+	
+	return 1;
+}
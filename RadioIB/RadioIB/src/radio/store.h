@@ -0,0 +1,53 @@
+/** \file
+ * store.h
+ * \brief Store-and-forward downlink buffer header file
+ *
+ *	Frames for the radio that come while there is no ground contact are kept here and 
+ *	sent on the next pass. Each data class has its own list of pages, class 0 first:
+ *
+ * *	Records [size][data] are appended to the last page of their class. A page is written
+ *		in order and not changed again until all its records are sent and it is free
+ * *	When the pages run out, the oldest page of the lowest priority class goes - never one of
+ *		a higher priority class than the new record, which is dropped instead
+ * *	store_next() gives the oldest record of the highest priority class, store_release() frees it
+ * *	Each page has a running check (arq_check()) of the bytes written to it, for 
+ *		store_check_pages() after a warm restart
+ */ 
+
+
+#ifndef STORE_H_
+#define STORE_H_
+
+#include "../vcp/common.h"
+#include "../config/conf_radio_link.h"
+
+#define STORE_RECORD_HEADER		1			///< Record size byte
+#define STORE_NO_PAGE			0xFF		///< End of a page list
+
+/// Store-and-forward buffer
+typedef struct {
+	uint8_t			page[STORE_PAGES][STORE_PAGE_SIZE];	///< Page data
+	uint16_t		used[STORE_PAGES];		///< Bytes written in each page
+	uint32_t		check[STORE_PAGES];		///< arq_check() of the bytes written in each page
+	uint16_t		read[STORE_PAGES];		///< Bytes of each page already sent
+	uint8_t			next[STORE_PAGES];		///< Next page of the same class, or of the free list
+	uint8_t			head[STORE_CLASSES];	///< Oldest page of each class
+	uint8_t			tail[STORE_CLASSES];	///< Page being written for each class
+	uint8_t			free;					///< Free page list
+	
+	// Statistics
+	uint16_t		records[STORE_CLASSES];	///< Records waiting, per class
+	uint16_t		dropped[STORE_CLASSES];	///< Records lost for lack of space, per class
+	uint32_t		bytes_stored;			///< Data bytes stored
+	uint32_t		bytes_sent;				///< Data bytes taken out by store_release()
+} store_t;
+
+// Functions
+void		store_init			(store_t* st);
+uint8_t		store_append		(store_t* st, uint8_t data_class, const uint8_t* data, uint8_t size);
+uint8_t		store_next			(store_t* st, uint8_t** data);
+void		store_release		(store_t* st);
+uint8_t		store_free_pages	(store_t* st);
+uint8_t		store_check_pages	(store_t* st);
+
+#endif /* STORE_H_ */
@@ -0,0 +1,206 @@
+/** \file
+ * bert.c
+ * \brief Bit error rate tester source file
+ *
+ */ 
+
+#include "bert.h"
+#include "radioib.h"
+#include "radio_control.h"
+#include "tasks.h"
+#include "../debug/dlog.h"
+
+bert_t			bert;				///< Bit error rate tester state
+
+/**
+ * Name         : bert_start
+ *
+ * Synopsis     : Bool bert_start (uint8_t action, peripheral_t* link, uint8_t pattern, uint16_t rate, uint16_t seconds)
+ *
+ * \param	action	BERT_START or BERT_LOOPBACK
+ * \param	link	&radio or &cdhib
+ * \param	pattern	PRBS_9, PRBS_15 or PRBS_23 (BERT_START)
+ * \param	rate	Bytes per second, 0 for the line rate (BERT_START)
+ * \param	seconds	Test length, 0 until BERT_STOP
+ *
+ * Description  : Arm a test on the link - it starts when the link transmitter is done
+ *				  (and on the CDHIB link, the responses waiting for it are sent)
+ * 
+ * \return			false for a bad pattern
+ */
+Bool bert_start (uint8_t action, peripheral_t* link, uint8_t pattern, uint16_t rate, uint16_t seconds)
+{
+	if (action == BERT_START && (!prbs_init(&bert.tx, pattern) || !prbs_init(&bert.rx, pattern)))
+		return false;
+	
+	bert.next_state =	(action == BERT_START) ? BERT_RUNNING : BERT_ECHO;
+	bert.link =			link;
+	bert.pattern =		(action == BERT_START) ? pattern : 0;
+	bert.remaining =	seconds;
+	bert.fill =			0;
+	bert.fill_size =	0;
+	bert.tx_bytes =		0;
+	bert.rx_bytes =		0;
+	if (action != BERT_START)
+		prbs_init(&bert.rx, PRBS_9);			// Clear the checker counters
+	
+	// A DMA block at a time, smaller below BERT_BLOCK bytes per second
+	pacing_init(&bert.pacing, rate ? rate : PACING_OFF, (rate && rate < BERT_BLOCK) ? rate : BERT_BLOCK, get_mticks());
+	bert.state =		BERT_ARMED;
+	return true;
+}
+
+/**
+ * Name         : bert_stop
+ *
+ * Synopsis     : void bert_stop (void)
+ *
+ * Description  : End the test, the link goes back to VCP frames. The results are kept
+ * 
+ */
+void bert_stop (void)
+{
+	peripheral_t* link = bert.link;
+	
+	if (bert.state == BERT_IDLE)
+		return;
+	
+	if (bert.state != BERT_ARMED)
+	{
+		// The link decoder may be inside a frame from before the test
+		vcpptr_init(&link->vcp_rx_msg, link->rx_data, link->rx_data_buffer_size);
+		link->VCP_rx_status = 0;
+		dlog_ww(DLOG_BERT_STOP, (bert.rx.errors > 0xFFFF) ? 0xFFFF : (uint16_t)bert.rx.errors, bert.rx.sync_losses);
+	}
+	bert.state = BERT_IDLE;
+}
+
+/**
+ * Name         : bert_owns
+ *
+ * Synopsis     : Bool bert_owns (peripheral_t* link)
+ *
+ * \return		true if a test runs on the link - its task leaves it to bert_update()
+ */
+Bool bert_owns (peripheral_t* link)
+{
+	return (bert.state == BERT_RUNNING || bert.state == BERT_ECHO) && bert.link == link;
+}
+
+/**
+ * Name         : bert_update
+ *
+ * Synopsis     : void bert_update (void)
+ *
+ * Description  : Run the test. Called on every scheduler pass.
+ * *			Armed - start when the link transmitter is idle
+ * *			Count down the seconds, stop at the end
+ * *			Check the received bytes (test), or collect them for the transmitter (loopback)
+ * *			When the DMA is idle send the next PRBS block the rate allows, or the bytes collected
+ * 
+ */
+void bert_update (void)
+{
+	peripheral_t*	link = bert.link;
+	uint16_t		now = get_mticks();
+	uint8_t			byte, i;
+	
+	if (bert.state == BERT_IDLE)
+		return;
+	
+	if (bert.state == BERT_ARMED)
+	{
+		if (!DMA_transmit_idle(link) || (link == &cdhib && !Queue_RingBuffer_IsEmpty(&cdhib_queue_ringbuff)))
+			return;
+		
+		bert.state =		bert.next_state;
+		bert.second_time =	now;
+		dlog_bbw(DLOG_BERT_START, link->VCP_address, bert.pattern, bert.pacing.rate);
+	}
+	
+	if (bert.remaining && (uint16_t)(now - bert.second_time) >= 1000)
+	{
+		bert.second_time += 1000;
+		if (--bert.remaining == 0)
+		{
+			bert_stop();
+			return;
+		}
+	}
+	
+	// Receive
+	while (!RingBuffer_IsEmpty(&link->rx_ringbuff))
+	{
+		byte = RingBuffer_Remove(&link->rx_ringbuff);
+		bert.rx_bytes++;
+		if (bert.state == BERT_RUNNING)
+			prbs_check(&bert.rx, byte);
+		else if (bert.fill_size < BERT_BLOCK)
+			bert.block[bert.fill][bert.fill_size++] = byte;
+	}
+	
+	// Transmit - straight to the UART, not counted as packets. The radio may be in a reset
+	if (!DMA_transmit_idle(link) || (link == &radio && !radio_control_ready()))
+		return;
+	
+	if (bert.state == BERT_RUNNING)
+	{
+		if (!pacing_take(&bert.pacing, now, bert.pacing.burst))
+			return;
+		for (i = 0; i < bert.pacing.burst; i++)
+			bert.block[bert.fill][i] = prbs_next(&bert.tx);
+		bert.fill_size = bert.pacing.burst;
+	}
+	
+	if (bert.fill_size)
+	{
+		hal_uart_send(link->USART, link->DMA_channel, bert.block[bert.fill], bert.fill_size);
+		bert.tx_bytes +=	bert.fill_size;
+		bert.fill ^=		1;
+		bert.fill_size =	0;
+	}
+}
+
+/**
+ * Name         : bert_telemetry
+ *
+ * Synopsis     : uint8_t bert_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least BERT_SIZE bytes
+ *
+ * Description  : Build the BERT packet (MSB first) - state, link VCP address, pattern, checker locked,
+ *				  seconds left, bytes sent, bytes received, bits checked, bit errors and sync losses.
+ *				  BER = bit errors / bits checked
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t bert_telemetry (uint8_t* dst)
+{
+	uint8_t		i = 0;
+	
+	dst[i++] = bert.state;
+	dst[i++] = bert.link ? bert.link->VCP_address : 0;
+	dst[i++] = bert.pattern;
+	dst[i++] = bert.rx.locked;
+	dst[i++] = MSB(bert.remaining);
+	dst[i++] = LSB(bert.remaining);
+	dst[i++] = MSB0W(bert.tx_bytes);
+	dst[i++] = MSB1W(bert.tx_bytes);
+	dst[i++] = MSB2W(bert.tx_bytes);
+	dst[i++] = MSB3W(bert.tx_bytes);
+	dst[i++] = MSB0W(bert.rx_bytes);
+	dst[i++] = MSB1W(bert.rx_bytes);
+	dst[i++] = MSB2W(bert.rx_bytes);
+	dst[i++] = MSB3W(bert.rx_bytes);
+	dst[i++] = MSB0W(bert.rx.bits);
+	dst[i++] = MSB1W(bert.rx.bits);
+	dst[i++] = MSB2W(bert.rx.bits);
+	dst[i++] = MSB3W(bert.rx.bits);
+	dst[i++] = MSB0W(bert.rx.errors);
+	dst[i++] = MSB1W(bert.rx.errors);
+	dst[i++] = MSB2W(bert.rx.errors);
+	dst[i++] = MSB3W(bert.rx.errors);
+	dst[i++] = MSB(bert.rx.sync_losses);
+	dst[i++] = LSB(bert.rx.sync_losses);
+	return i;
+}
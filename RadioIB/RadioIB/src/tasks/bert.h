@@ -0,0 +1,63 @@
+/** \file
+ * bert.h
+ * \brief Bit error rate tester header file
+ *
+ *	Measures the raw capacity and bit error rate of the radio or the CDHIB link with no test gear,
+ *	started by BERT_COMMAND. While a test runs the link carries no VCP traffic - its task only
+ *	calls bert_update():
+ *
+ * *	BERT_START - send a PRBS (radio/prbs.h) with DMA at a rate in bytes per second (0 - line rate)
+ *		and check the PRBS coming back: from the far end in loopback, or a wire loopback
+ * *	BERT_LOOPBACK - send every byte received on the link straight back, for the far end's test
+ *
+ *	A test on the CDHIB link stops the commands too, so it needs a duration. During a test on the
+ *	radio link the CDHIB frames for the radio are dropped. A test starts once the command
+ *	response has gone out. The results stay for BERT_STATUS after the test.
+ */ 
+
+
+#ifndef BERT_H_
+#define BERT_H_
+
+#include <asf.h>
+#include "../memory/memory.h"
+#include "../radio/prbs.h"
+#include "../radio/pacing.h"
+
+// BERT states
+#define BERT_IDLE				0		///< No test
+#define BERT_ARMED				1		///< Waiting for the link transmitter to finish
+#define BERT_RUNNING			2		///< PRBS test
+#define BERT_ECHO				3		///< Loopback
+
+#define BERT_BLOCK				64		///< Bytes per DMA transmission
+#define BERT_SIZE				24		///< Size in bytes of the BERT packet
+
+/// Bit error rate tester state
+typedef struct {
+	uint8_t			state;					///< BERT_IDLE...
+	uint8_t			next_state;				///< State after BERT_ARMED
+	peripheral_t*	link;					///< Link under test, NULL when idle
+	uint8_t			pattern;				///< PRBS_9...
+	uint16_t		remaining;				///< Seconds left, 0 - until BERT_STOP
+	uint16_t		second_time;			///< Time of the last second, ms
+	prbs_t			tx;						///< Generator
+	prbs_t			rx;						///< Checker
+	pacing_t		pacing;					///< Transmit rate
+	uint8_t			block[2][BERT_BLOCK];	///< Transmit blocks - one in the DMA, one being filled
+	uint8_t			fill;					///< Block being filled
+	uint8_t			fill_size;				///< Bytes in it
+	uint32_t		tx_bytes;				///< Bytes sent
+	uint32_t		rx_bytes;				///< Bytes received
+} bert_t;
+
+extern bert_t			bert;			///< Bit error rate tester state
+
+// Functions
+Bool		bert_start			(uint8_t action, peripheral_t* link, uint8_t pattern, uint16_t rate, uint16_t seconds);
+void		bert_stop			(void);
+Bool		bert_owns			(peripheral_t* link);
+void		bert_update			(void);
+uint8_t		bert_telemetry		(uint8_t* dst);
+
+#endif /* BERT_H_ */
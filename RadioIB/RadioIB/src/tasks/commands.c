@@ -0,0 +1,754 @@
+/** \file
+ * commands.c
+ * \brief Radio IB command dispatch source file
+ *
+ */ 
+
+#include "commands.h"
+#include "radioib.h"
+#include "../memory/memory.h"
+#include "../memory/ram_monitor.h"
+#include "../memory/stats_journal.h"
+#include "../memory/warm_start.h"
+#include "../debug/self_bench.h"
+#include "bert.h"
+#include "flow_control.h"
+#include "radio_control.h"
+#include "tasks.h"
+
+static command_job_t	command_jobs[COMMAND_JOBS];		///< Long running commands in progress
+static uint8_t			command_sequence;				///< Sequence number of the frame being executed
+static uint8_t			command_header;					///< Header of the command being executed
+
+
+/********************/
+/* Command handlers */
+/********************/
+
+/**
+ * Name         : command_noop
+ *
+ * Synopsis     : static uint8_t command_noop (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : No Op - respond with "ACK"
+ * 
+ */
+static uint8_t command_noop (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (*response_size < ACK_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	memcpy(response, ACK, ACK_SIZE);
+	*response_size = ACK_SIZE;
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_memory_telemetry
+ *
+ * Synopsis     : static uint8_t command_memory_telemetry (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the stack and buffer high-water marks
+ * 
+ */
+static uint8_t command_memory_telemetry (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (*response_size < RAM_TELEMETRY_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	*response_size = ram_monitor_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_radio_link_telemetry
+ *
+ * Synopsis     : static uint8_t command_radio_link_telemetry (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the radio link counters (MSB first)
+ * *			ARQ: frames sent, retransmitted, given up, received, duplicates, lost
+ * *			Compression: bytes in, bytes out, time spent compressing in timer ticks
+ *				(256 CPU cycles - cycles per byte = ticks * 256 / bytes in)
+ * *			FEC: bytes encoded, time spent encoding in timer ticks
+ * *			Frames compressed
+ * 
+ */
+static uint8_t command_radio_link_telemetry (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	uint16_t	counters[] = {	radio_arq.tx_frames, radio_arq.tx_retransmits, radio_arq.tx_given_up,
+								radio_arq.rx_frames, radio_arq.rx_duplicates, radio_arq.rx_lost };
+	uint32_t	compression[] = { radio_compression.bytes_in, radio_compression.bytes_out, radio_compression.timer_ticks,
+								radio_fec_bytes, radio_fec_ticks };
+	uint8_t		i, index = 0;
+	
+	if (*response_size < RADIO_LINK_TELEMETRY_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	for (i = 0; i < sizeof(counters) / sizeof(counters[0]); i++)
+	{
+		response[index++] = MSB(counters[i]);
+		response[index++] = LSB(counters[i]);
+	}
+	for (i = 0; i < sizeof(compression) / sizeof(compression[0]); i++)
+	{
+		response[index++] = MSB0W(compression[i]);
+		response[index++] = MSB1W(compression[i]);
+		response[index++] = MSB2W(compression[i]);
+		response[index++] = MSB3W(compression[i]);
+	}
+	response[index++] = MSB(radio_compression.frames);
+	response[index++] = LSB(radio_compression.frames);
+	
+	*response_size = index;
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_flow_credit
+ *
+ * Synopsis     : static uint8_t command_flow_credit (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the credit limit for frames to the radio, the frames accepted, the
+ *				  throttled flag and the throttle count (see flow_control.h). Also sent unsolicited by flow_control_update().
+ * 
+ */
+static uint8_t command_flow_credit (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (*response_size < FLOW_TELEMETRY_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	*response_size = flow_control_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_radio_pacing
+ *
+ * Synopsis     : static uint8_t command_radio_pacing (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Set the radio transmit token bucket - [rate][burst] in bytes (MSB first) and [mode] - 
+ *				  or only read it, with rate RADIO_PACING_KEEP.
+ *				  Respond with rate, burst, mode, tokens, transmissions held and bytes released (MSB first)
+ * 
+ */
+static uint8_t command_radio_pacing (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	uint16_t	rate =	(args[0] << 8) | args[1];
+	uint16_t	burst =	(args[2] << 8) | args[3];
+	uint8_t		mode =	args[4];
+	uint8_t		index = 0;
+	
+	if (*response_size < RADIO_PACING_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	if (rate != RADIO_PACING_KEEP)
+	{
+		if (burst == 0 || (mode & ~(RADIO_PACING_PD7 | RADIO_PACING_PD7_LOW)))
+			return COMMAND_BAD_ARG;
+		#ifdef DEBUG_CLOCK_OUT
+			// PD7 is the clock output (io_init)
+			if (mode & RADIO_PACING_PD7)
+				return COMMAND_BAD_ARG;
+		#endif
+		
+		pacing_init(&radio_pacing, rate, burst, get_mticks());
+		radio_pacing_mode = mode;
+	}
+	
+	response[index++] = MSB(radio_pacing.rate);
+	response[index++] = LSB(radio_pacing.rate);
+	response[index++] = MSB(radio_pacing.burst);
+	response[index++] = LSB(radio_pacing.burst);
+	response[index++] = radio_pacing_mode;
+	response[index++] = MSB(radio_pacing.tokens);
+	response[index++] = LSB(radio_pacing.tokens);
+	response[index++] = MSB(radio_pacing.held);
+	response[index++] = LSB(radio_pacing.held);
+	response[index++] = MSB0W(radio_pacing.bytes);
+	response[index++] = MSB1W(radio_pacing.bytes);
+	response[index++] = MSB2W(radio_pacing.bytes);
+	response[index++] = MSB3W(radio_pacing.bytes);
+	
+	*response_size = index;
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_radio_reset_poll
+ *
+ * Synopsis     : static uint8_t command_radio_reset_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Radio reset job - respond with the radio control packet once the radio has started
+ * 
+ */
+static uint8_t command_radio_reset_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+{
+	if (!radio_control_ready())
+		return COMMAND_PENDING;
+	
+	if (*response_size < RADIO_CONTROL_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	*response_size = radio_control_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_radio_control
+ *
+ * Synopsis     : static uint8_t command_radio_control (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Radio control pins - [action][configuration]
+ * *			RADIO_CONTROL_STATUS - respond with the radio control packet
+ * *			RADIO_CONTROL_CONFIGURE - drive the configuration pins now, respond with the radio control packet
+ * *			RADIO_CONTROL_RESET_RADIO - reset the radio with the configuration. The radio control packet
+ *				follows in its own response frame once the radio has started
+ * 
+ */
+static uint8_t command_radio_control (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	uint8_t action =	args[0];
+	uint8_t config =	args[1];
+	
+	if (action > RADIO_CONTROL_RESET_RADIO || (config & ~RADIO_CONFIG_MASK))
+		return COMMAND_BAD_ARG;
+	
+	if (action == RADIO_CONTROL_RESET_RADIO)
+	{
+		// One reset at a time - and a job for its response
+		if (!radio_control_ready() || command_defer(command_radio_reset_poll, config) == NULL)
+			return COMMAND_BUSY;
+		
+		radio_control_reset(config);
+		*response_size = 0;
+		return COMMAND_PENDING;
+	}
+	
+	if (*response_size < RADIO_CONTROL_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	if (action == RADIO_CONTROL_CONFIGURE)
+		radio_control_configure(config);
+	
+	*response_size = radio_control_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_radio_events
+ *
+ * Synopsis     : static uint8_t command_radio_events (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the edges lost and the oldest PD7 edges logged, as many as fit in the response.
+ *				  The ones that do not fit stay for the next read.
+ * 
+ */
+static uint8_t command_radio_events (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (*response_size < 1)
+		return COMMAND_NO_SPACE;
+	
+	response[0] =	radio_control.events_lost;
+	*response_size = 1 + radio_control_events(&response[1], *response_size - 1);
+	return COMMAND_OK;
+}
+
+#if RADIO_STORE
+/**
+ * Name         : command_store
+ *
+ * Synopsis     : static uint8_t command_store (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Store-and-forward - [action][argument (MSB first)], see STORE_STATUS...
+ *				  Respond with (MSB first) contact, data class, pass seconds left, free pages,
+ *				  records waiting and records dropped per class, bytes stored and bytes sent
+ * 
+ */
+static uint8_t command_store (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	uint8_t		action =	args[0];
+	uint16_t	argument =	(args[1] << 8) | args[2];
+	uint8_t		i, index = 0;
+	
+	if (*response_size < STORE_TELEMETRY_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	switch (action)
+	{
+		case STORE_STATUS:
+			break;
+			
+		case STORE_PASS_START:
+			radio_pass.contact =		true;
+			radio_pass.remaining =		argument;
+			radio_pass.second_time =	get_mticks();
+			radio_pass.passes++;
+			break;
+			
+		case STORE_PASS_END:
+			radio_pass.contact =		false;
+			break;
+			
+		case STORE_SET_CLASS:
+			if (argument >= STORE_CLASSES)
+				return COMMAND_BAD_ARG;
+			radio_pass.data_class =		argument;
+			break;
+			
+		case STORE_CLEAR:
+			store_init(&radio_store);
+			break;
+			
+		default:
+			return COMMAND_BAD_ARG;
+	}
+	
+	response[index++] = radio_pass.contact;
+	response[index++] = radio_pass.data_class;
+	response[index++] = MSB(radio_pass.remaining);
+	response[index++] = LSB(radio_pass.remaining);
+	response[index++] = store_free_pages(&radio_store);
+	for (i = 0; i < STORE_CLASSES; i++)
+	{
+		response[index++] = MSB(radio_store.records[i]);
+		response[index++] = LSB(radio_store.records[i]);
+	}
+	for (i = 0; i < STORE_CLASSES; i++)
+	{
+		response[index++] = MSB(radio_store.dropped[i]);
+		response[index++] = LSB(radio_store.dropped[i]);
+	}
+	response[index++] = MSB0W(radio_store.bytes_stored);
+	response[index++] = MSB1W(radio_store.bytes_stored);
+	response[index++] = MSB2W(radio_store.bytes_stored);
+	response[index++] = MSB3W(radio_store.bytes_stored);
+	response[index++] = MSB0W(radio_store.bytes_sent);
+	response[index++] = MSB1W(radio_store.bytes_sent);
+	response[index++] = MSB2W(radio_store.bytes_sent);
+	response[index++] = MSB3W(radio_store.bytes_sent);
+	
+	*response_size = index;
+	return COMMAND_OK;
+}
+#else
+/**
+ * Name         : command_store
+ *
+ * Synopsis     : static uint8_t command_store (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Store-and-forward is not built in (RADIO_STORE 0) - every action is rejected,
+ *				  the radio stays in contact
+ * 
+ */
+static uint8_t command_store (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	return COMMAND_BAD_ARG;
+}
+#endif
+
+/**
+ * Name         : command_stats_journal
+ *
+ * Synopsis     : static uint8_t command_stats_journal (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the persistent statistics (see stats_journal_telemetry()).
+ *				  Argument 1 also commits them to EEPROM now, in the background.
+ * 
+ */
+static uint8_t command_stats_journal (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (args[0] > 1)
+		return COMMAND_BAD_ARG;
+	
+	if (*response_size < STATS_JOURNAL_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	if (args[0])
+		stats_journal_commit();
+	
+	*response_size = stats_journal_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_warm_start
+ *
+ * Synopsis     : static uint8_t command_warm_start (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with the warm start packet - warm or cold start, reset cause, warm starts 
+ *				  and the cold and warm start times (see warm_start_telemetry())
+ * 
+ */
+static uint8_t command_warm_start (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (*response_size < WARM_START_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	*response_size = warm_start_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_self_bench_poll
+ *
+ * Synopsis     : static uint8_t command_self_bench_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Self-benchmark job - one timed run per scheduler pass, when the CDHIB and the radio 
+ *				  receive buffers are empty (or after SELF_BENCH_IDLE_WAIT_MS), then respond with the 
+ *				  self-benchmark packet
+ * 
+ */
+static uint8_t command_self_bench_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+{
+	if (job->state < SELF_BENCH_STEPS)
+	{
+		if ((!RingBuffer_IsEmpty(&cdhib.rx_ringbuff) || !RingBuffer_IsEmpty(&radio.rx_ringbuff)) &&
+			(uint16_t)(get_mticks() - job->start_time) < SELF_BENCH_IDLE_WAIT_MS)
+			return COMMAND_PENDING;
+		
+		self_bench_step(job->state++);
+		job->start_time = get_mticks();
+		return COMMAND_PENDING;
+	}
+	
+	if (*response_size < SELF_BENCH_SIZE)
+	{
+		self_bench_stop();
+		return COMMAND_NO_SPACE;
+	}
+	
+	*response_size = self_bench_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_self_bench
+ *
+ * Synopsis     : static uint8_t command_self_bench (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Time the VCP codec and the CRC on a reference buffer, in the background. The 
+ *				  self-benchmark packet follows in its own response frame (see self_bench_telemetry())
+ * 
+ */
+static uint8_t command_self_bench (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	command_job_t* job;
+	
+	if (!self_bench_start())
+		return COMMAND_BUSY;
+	
+	if ((job = command_defer(command_self_bench_poll, 0)) == NULL)
+	{
+		self_bench_stop();
+		return COMMAND_BUSY;
+	}
+	
+	*response_size = 0;
+	return COMMAND_PENDING;
+}
+
+/**
+ * Name         : command_bert
+ *
+ * Synopsis     : static uint8_t command_bert (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Bit error rate test - [action][link VCP address][pattern][rate][seconds] (MSB first),
+ *				  see BERT_STATUS... The link is the radio or the CDHIB, a CDHIB test needs [seconds].
+ *				  Respond with the BERT packet (see bert_telemetry())
+ * 
+ */
+static uint8_t command_bert (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	uint8_t			action =	args[0];
+	uint16_t		rate =		(args[3] << 8) | args[4];
+	uint16_t		seconds =	(args[5] << 8) | args[6];
+	peripheral_t*	link;
+	
+	if (*response_size < BERT_SIZE)
+		return COMMAND_NO_SPACE;
+	
+	switch (action)
+	{
+		case BERT_STATUS:
+			break;
+			
+		case BERT_START:
+		case BERT_LOOPBACK:
+			if (args[1] == radio.VCP_address)
+				link = &radio;
+			else if (args[1] == cdhib.VCP_address && seconds)
+				link = &cdhib;
+			else
+				return COMMAND_BAD_ARG;
+			
+			if (bert.state != BERT_IDLE)
+				return COMMAND_BUSY;
+			if (!bert_start(action, link, args[2], rate, seconds))
+				return COMMAND_BAD_ARG;
+			break;
+			
+		case BERT_STOP:
+			bert_stop();
+			break;
+			
+		default:
+			return COMMAND_BAD_ARG;
+	}
+	
+	*response_size = bert_telemetry(response);
+	return COMMAND_OK;
+}
+
+/**
+ * Name         : command_delayed_ack_poll
+ *
+ * Synopsis     : static uint8_t command_delayed_ack_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Delayed ACK job - respond with "ACK" once the delay is over
+ * 
+ */
+static uint8_t command_delayed_ack_poll (command_job_t* job, uint8_t* response, uint8_t* response_size)
+{
+	if ((uint16_t)(get_mticks() - job->start_time) < job->argument)
+		return COMMAND_PENDING;
+	
+	return command_noop(NULL, response, response_size);
+}
+
+/**
+ * Name         : command_delayed_ack
+ *
+ * Synopsis     : static uint8_t command_delayed_ack (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+ *
+ * Description  : Respond with "ACK" after [argument] milliseconds, in a separate response frame.
+ *				  Exercises the deferred response path from the ground.
+ * 
+ */
+static uint8_t command_delayed_ack (const uint8_t* args, uint8_t* response, uint8_t* response_size)
+{
+	if (command_defer(command_delayed_ack_poll, (args[0] << 8) | args[1]) == NULL)
+		return COMMAND_BUSY;
+	
+	*response_size = 0;
+	return COMMAND_PENDING;
+}
+
+
+/*****************/
+/* Command table */
+/*****************/
+
+/// Command table, indexed by the command header
+PROGMEM_DECLARE(command_entry_t, command_table[]) = {
+	//	Handler							Argument size
+	{	command_noop,					2	},		// NOOP_COMMAND
+	{	command_memory_telemetry,		2	},		// MEMORY_TELEMETRY_COMMAND
+	{	command_delayed_ack,			2	},		// DELAYED_ACK_COMMAND
+	{	command_radio_link_telemetry,	2	},		// RADIO_LINK_TELEMETRY_COMMAND
+	{	command_flow_credit,			0	},		// FLOW_CREDIT_COMMAND
+	{	command_radio_pacing,			5	},		// RADIO_PACING_COMMAND
+	{	command_radio_control,			2	},		// RADIO_CONTROL_COMMAND
+	{	command_radio_events,			0	},		// RADIO_EVENTS_COMMAND
+	{	command_store,					3	},		// STORE_COMMAND
+	{	command_stats_journal,			1	},		// STATS_JOURNAL_COMMAND
+	{	command_warm_start,				0	},		// WARM_START_COMMAND
+	{	command_self_bench,				0	},		// SELF_BENCH_COMMAND
+	{	command_bert,					7	},		// BERT_COMMAND
+};
+
+#define COMMAND_COUNT	(sizeof(command_table) / sizeof(command_table[0]))	///< Number of commands in the table
+
+
+/**
+ * Name         : command_execute_frame
+ *
+ * Synopsis     : uint16_t command_execute_frame (const uint8_t* frame, uint16_t frame_size, uint8_t* response, uint16_t response_buffer_size)
+ *
+ * \param	frame					Received command frame (VCP decoded), starting with the sequence number
+ * \param	frame_size				Command frame size
+ * \param	response				Response buffer
+ * \param	response_buffer_size	Response buffer size
+ *
+ * Description  : Execute all the commands in a command frame, in place.
+ * *			Copy the frame sequence number to the response
+ * *			Look up each command header in the command table to get its handler and argument size
+ * *			Append the response of each command to the response buffer
+ * *			An unknown command or a truncated command ends the frame - the size of what follows is unknown
+ * 
+ * \return							Response size
+ */
+uint16_t command_execute_frame (const uint8_t* frame, uint16_t frame_size, uint8_t* response, uint16_t response_buffer_size)
+{
+	uint16_t	frame_index = 0;
+	uint16_t	response_index = 0;
+	
+	if (frame_size == 0 || response_buffer_size == 0)
+		return 0;
+	
+	// Sequence number, for the response and for any command job started by this frame
+	command_sequence =				frame[frame_index++];
+	response[response_index++] =	command_sequence;
+	
+	while (frame_index < frame_size)
+	{
+		uint8_t		header =		frame[frame_index++];
+		uint8_t		status =		COMMAND_UNKNOWN;
+		uint8_t		data_size =		0;
+		uint16_t	space;
+		
+		// No room for even the response header - the rest of the frame is not executed
+		if (response_index + COMMAND_RESPONSE_HEADER_SIZE > response_buffer_size)
+			break;
+		
+		space = response_buffer_size - response_index - COMMAND_RESPONSE_HEADER_SIZE;
+		
+		if (header < COMMAND_COUNT)
+		{
+			command_handler_t	handler =		(command_handler_t)PROGMEM_READ_WORD(&command_table[header].handler);
+			uint8_t				argument_size =	PROGMEM_READ_BYTE(&command_table[header].argument_size);
+			
+			if (frame_index + argument_size > frame_size)
+			{
+				status = COMMAND_ARG_ERR;
+			}
+			else
+			{
+				data_size = (space > 0xFF) ? 0xFF : (uint8_t)space;
+				command_header = header;
+				status = handler(&frame[frame_index], &response[response_index + COMMAND_RESPONSE_HEADER_SIZE], &data_size);
+				if (status != COMMAND_OK)
+					data_size = 0;
+				frame_index += argument_size;
+			}
+		}
+		
+		response[response_index++] = header;
+		response[response_index++] = status;
+		response[response_index++] = data_size;
+		response_index += data_size;
+		
+		if (status == COMMAND_UNKNOWN || status == COMMAND_ARG_ERR)
+			break;
+	}
+	
+	return response_index;
+}
+
+/**
+ * Name         : command_defer
+ *
+ * Synopsis     : command_job_t* command_defer (command_poll_t poll, uint16_t argument)
+ *
+ * \param	poll		Poll function that finishes the command
+ * \param	argument	Command argument, saved in the job
+ *
+ * Description  : Start a command job for the command being executed. Called from a command handler,
+ *				  which then returns COMMAND_PENDING. The job remembers the frame sequence number and
+ *				  the command header for the deferred response.
+ * 
+ * \return				The job, NULL if all the jobs are in use
+ */
+command_job_t* command_defer (command_poll_t poll, uint16_t argument)
+{
+	uint8_t i;
+	
+	for (i = 0; i < COMMAND_JOBS; i++)
+	{
+		command_job_t* job = &command_jobs[i];
+		
+		if (job->poll == NULL)
+		{
+			job->sequence =		command_sequence;
+			job->header =		command_header;
+			job->state =		0;
+			job->argument =		argument;
+			job->start_time =	get_mticks();
+			job->poll =			poll;
+			return job;
+		}
+	}
+	
+	return NULL;
+}
+
+/**
+ * Name         : command_executor_poll
+ *
+ * Synopsis     : void command_executor_poll (void)
+ *
+ * Description  : Run all the command jobs once. Called on every scheduler pass.
+ * *			A job is only polled when a response buffer is free, so its result always has somewhere to go
+ * *			When a job is done post its response frame to the CDHIB transmit queue and free the job
+ * 
+ */
+void command_executor_poll (void)
+{
+	uint8_t i;
+	
+	for (i = 0; i < COMMAND_JOBS; i++)
+	{
+		command_job_t*	job = &command_jobs[i];
+		uint8ptr		response;
+		uint8_t			data_size;
+		uint8_t			status;
+		
+		if (job->poll == NULL)
+			continue;
+		
+		response = radioib_response_alloc();
+		if (response == NULL)
+			return;		// Try again on the next pass
+		
+		// Keep 2 bytes for the CRC that Create_VCP_frame appends to the response
+		data_size = RADIOIB_RESPONSE_BUFF_SIZE - 2 - 1 - COMMAND_RESPONSE_HEADER_SIZE;
+		status = job->poll(job, &response[1 + COMMAND_RESPONSE_HEADER_SIZE], &data_size);
+		if (status == COMMAND_PENDING)
+			continue;
+		if (status != COMMAND_OK)
+			data_size = 0;
+		
+		response[0] =	job->sequence;
+		response[1] =	job->header;
+		response[2] =	status;
+		response[3] =	data_size;
+		radioib_response_post(1 + COMMAND_RESPONSE_HEADER_SIZE + data_size);
+		
+		job->poll = NULL;
+	}
+}
+
+/**
+ * Name         : command_notify
+ *
+ * Synopsis     : Bool command_notify (uint8_t header, const uint8_t* data, uint8_t size)
+ *
+ * \param	header	Command header the notification is about
+ * \param	data	Response data
+ * \param	size	Response data size
+ *
+ * Description  : Post an unsolicited response frame to the CDHIB:
+ *				  [COMMAND_NOTIFY_SEQUENCE][header][COMMAND_OK][size][data]
+ * 
+ * \return			true if posted, false if no response buffer is free (try again later)
+ */
+Bool command_notify (uint8_t header, const uint8_t* data, uint8_t size)
+{
+	uint8ptr response;
+	
+	// Keep 2 bytes for the CRC that Create_VCP_frame appends to the response
+	if (1 + COMMAND_RESPONSE_HEADER_SIZE + size > RADIOIB_RESPONSE_BUFF_SIZE - 2)
+		return false;
+	
+	response = radioib_response_alloc();
+	if (response == NULL)
+		return false;
+	
+	response[0] =	COMMAND_NOTIFY_SEQUENCE;
+	response[1] =	header;
+	response[2] =	COMMAND_OK;
+	response[3] =	size;
+	memcpy(&response[1 + COMMAND_RESPONSE_HEADER_SIZE], data, size);
+	radioib_response_post(1 + COMMAND_RESPONSE_HEADER_SIZE + size);
+	
+	return true;
+}
@@ -0,0 +1,88 @@
+/** \file
+ * commands.h
+ * \brief Radio IB command dispatch header file
+ *
+ *	A command frame from the CDHIB holds a sequence number and one or more back-to-back commands:
+ *	[sequence] [Command header][argument bytes] [Command header][argument bytes] ...
+ *	The argument size of every command is taken from the command table.
+ *
+ *	All the responses go back in one response frame, with the same sequence number:
+ *	[sequence] [Command header][status][data size][data] [Command header][status][data size][data] ...
+ *
+ *	Long running commands return COMMAND_PENDING and continue in a command job (see command_defer()).
+ *	When the job is done its response goes back in its own frame, with the sequence number of 
+ *	the command frame that started it:
+ *	[sequence] [Command header][status][data size][data]
+ *
+ *	Unsolicited responses (command_notify()) use the COMMAND_NOTIFY_SEQUENCE sequence number.
+ */ 
+
+
+#ifndef COMMANDS_H_
+#define COMMANDS_H_
+
+#include <asf.h>
+
+// Command status codes
+#define COMMAND_OK					0x00		///< Command executed
+#define COMMAND_UNKNOWN				0x01		///< No such command. The rest of the frame is dropped
+#define COMMAND_ARG_ERR				0x02		///< Frame ended before the command arguments
+#define COMMAND_NO_SPACE			0x03		///< Response does not fit in the response buffer
+#define COMMAND_BAD_ARG				0x04		///< Argument out of range
+#define COMMAND_PENDING				0x05		///< Command started, the response will follow in its own frame
+#define COMMAND_BUSY				0x06		///< No free command job, try again later
+
+#define COMMAND_JOBS				4			///< Max number of long running commands in progress
+
+#define COMMAND_RESPONSE_HEADER_SIZE	3		///< Command header, status and data size
+#define COMMAND_NOTIFY_SEQUENCE		0xFF		///< Sequence number of unsolicited response frames - not to be used by the CDHIB
+
+/**
+ * Command handler.
+ *
+ * \param	args			Command arguments, in place in the received frame
+ * \param	response		Response data buffer
+ * \param	response_size	In: space in the response buffer. Out: response data size
+ *
+ * \return					Command status code
+ */
+typedef uint8_t (*command_handler_t)(const uint8_t* args, uint8_t* response, uint8_t* response_size);
+
+/// Command table entry
+typedef struct {
+	command_handler_t		handler;			///< Command handler
+	uint8_t					argument_size;		///< Size in bytes of the command arguments
+} command_entry_t;
+
+typedef struct command_job_s command_job_t;
+
+/**
+ * Command job poll function. Called by command_executor_poll() on every scheduler pass 
+ * until it returns a status other than COMMAND_PENDING. Must never wait, and must end on its
+ * own - a job is not woken by events or timed out, it checks its own condition and deadline.
+ *
+ * \param	job				The command job
+ * \param	response		Response data buffer
+ * \param	response_size	In: space in the response buffer. Out: response data size
+ *
+ * \return					COMMAND_PENDING, or the final command status
+ */
+typedef uint8_t (*command_poll_t)(command_job_t* job, uint8_t* response, uint8_t* response_size);
+
+/// Long running command in progress
+struct command_job_s {
+	command_poll_t			poll;				///< Poll function, NULL when the job is free
+	uint8_t					sequence;			///< Sequence number of the command frame that started the job
+	uint8_t					header;				///< Command header
+	uint8_t					state;				///< Job state, for the poll function
+	uint16_t				argument;			///< Command argument
+	uint16_t				start_time;			///< get_mticks() when the job started
+};
+
+// Functions
+uint16_t		command_execute_frame	(const uint8_t* frame, uint16_t frame_size, uint8_t* response, uint16_t response_buffer_size);
+command_job_t*	command_defer			(command_poll_t poll, uint16_t argument);
+void			command_executor_poll	(void);
+Bool			command_notify			(uint8_t header, const uint8_t* data, uint8_t size);
+
+#endif /* COMMANDS_H_ */
@@ -0,0 +1,144 @@
+/** \file
+ * flow_control.c
+ * \brief CDHIB to radio flow control source file
+ *
+ */ 
+
+#include "flow_control.h"
+#include "commands.h"
+#include "radioib.h"
+#include "tasks.h"
+#include "../memory/memory.h"
+
+flow_control_t		flow_control;			///< Flow control state
+
+/**
+ * Name         : flow_control_queued
+ *
+ * Synopsis     : static uint8_t flow_control_queued (void)
+ *
+ * Description  : Frames waiting for the radio - in the ARQ transmit window or for space in it
+ * 
+ */
+static uint8_t flow_control_queued (void)
+{
+#if RADIO_STORE
+	// Out of contact the frames go to the store - the ARQ window does not drain meanwhile
+	if (!radio_pass.contact)
+		return radio_data_pending ? 1 : 0;
+#endif
+	
+	return ARQ_WINDOW - arq_tx_space(&radio_arq) + (radio_data_pending ? 1 : 0);
+}
+
+/**
+ * Name         : flow_control_init
+ *
+ * Synopsis     : void flow_control_init (void)
+ *
+ * Description  : Start unthrottled, advertise the credits on the first update
+ * 
+ */
+void flow_control_init (void)
+{
+	flow_control.throttled =		false;
+	flow_control.notify_pending =	true;
+	flow_control.accepted =			0;
+	flow_control.limit =			0;
+	flow_control.throttle_count =	0;
+}
+
+/**
+ * Name         : flow_control_credits
+ *
+ * Synopsis     : uint8_t flow_control_credits (void)
+ *
+ * \return			Frames for the radio the CDHIB may send now, 0 while throttled
+ */
+uint8_t flow_control_credits (void)
+{
+	uint8_t queued = flow_control_queued();
+	
+	if (flow_control.throttled || queued >= ARQ_WINDOW)
+		return 0;
+	
+	return ARQ_WINDOW - queued;
+}
+
+/**
+ * Name         : flow_control_limit
+ *
+ * Synopsis     : uint8_t flow_control_limit (void)
+ *
+ * \return			Credit limit - frames for the radio accepted plus the credits, modulo 256
+ */
+uint8_t flow_control_limit (void)
+{
+	return flow_control.accepted + flow_control_credits();
+}
+
+/**
+ * Name         : flow_control_update
+ *
+ * Synopsis     : void flow_control_update (void)
+ *
+ * Description  : Throttle / release the CDHIB on the high / low-water marks and advertise the limit
+ *				  when it moved up. Called on every scheduler pass. An advertisement waits for a 
+ *				  free response buffer.
+ * 
+ */
+void flow_control_update (void)
+{
+	uint8_t		queued = flow_control_queued();
+	uint8_t		packet[FLOW_TELEMETRY_SIZE];
+	uint8_t		size;
+	
+	if (!flow_control.throttled && queued >= FLOW_HIGH_WATER)
+	{
+		flow_control.throttled =		true;
+		flow_control.notify_pending =	true;
+		flow_control.throttle_count++;
+	}
+	else if (flow_control.throttled && queued <= FLOW_LOW_WATER)
+	{
+		flow_control.throttled =		false;
+		flow_control.notify_pending =	true;
+	}
+	
+	// The CDHIB counts the frames it sends and reads the limit when it gets there - only a
+	// higher limit is news to it
+	if ((int8_t)(flow_control_limit() - flow_control.limit) > 0)
+		flow_control.notify_pending = true;
+	
+	if (!flow_control.notify_pending)
+		return;
+	
+	size = flow_control_telemetry(packet);
+	if (command_notify(FLOW_CREDIT_COMMAND, packet, size))
+		flow_control.notify_pending = false;
+}
+
+/**
+ * Name         : flow_control_telemetry
+ *
+ * Synopsis     : uint8_t flow_control_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least FLOW_TELEMETRY_SIZE bytes
+ *
+ * Description  : Build the flow control packet - credit limit, frames accepted, throttled flag, 
+ *				  throttle count (MSB first). The limit counts as advertised from here on
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t flow_control_telemetry (uint8_t* dst)
+{
+	uint8_t i = 0;
+	
+	dst[i++] = flow_control.limit = flow_control_limit();
+	dst[i++] = flow_control.accepted;
+	dst[i++] = flow_control.throttled;
+	dst[i++] = MSB(flow_control.throttle_count);
+	dst[i++] = LSB(flow_control.throttle_count);
+	
+	return i;
+}
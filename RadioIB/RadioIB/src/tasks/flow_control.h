@@ -0,0 +1,49 @@
+/** \file
+ * flow_control.h
+ * \brief CDHIB to radio flow control header file
+ *
+ *	Credit based flow control of the frames the CDHIB sends to the radio.
+ *	The Radio IB advertises a credit limit - frames for the radio accepted so far plus the 
+ *	frames it can take now, modulo 256 - in an unsolicited FLOW_CREDIT_COMMAND response 
+ *	(see command_notify()). The CDHIB counts the frames for the radio it has sent, modulo 256,
+ *	and may send while (int8_t)(limit - sent) > 0. Frames still on the line when the limit was
+ *	built are part of both counts, so a limit never gives out more room than there is.
+ *	Frames for the Radio IB itself are not counted.
+ *
+ * *	When the frames waiting for the radio reach FLOW_HIGH_WATER the limit stops at the frames
+ *		accepted
+ * *	When they are back at FLOW_LOW_WATER the limit is advertised again
+ * *	A limit that moved up is advertised too - nothing is sent while it stays. When the CDHIB 
+ *		reaches the limit (or lost an advertisement) it reads it with FLOW_CREDIT_COMMAND
+ * *	Both counts start at 0 with the Radio IB. After a Radio IB reset the CDHIB takes its 
+ *		count from the accepted frames in the packet. A frame lost on the line is not accepted
+ *		and its credit is lost until then
+ */ 
+
+
+#ifndef FLOW_CONTROL_H_
+#define FLOW_CONTROL_H_
+
+#include <asf.h>
+
+#define FLOW_TELEMETRY_SIZE			5		///< Size in bytes of the flow control packet
+
+/// Flow control state
+typedef struct {
+	Bool			throttled;				///< Above the high-water mark, no credits beyond the accepted frames
+	Bool			notify_pending;			///< Limit moved, not advertised yet
+	uint8_t			accepted;				///< Frames for the radio taken from the CDHIB, modulo 256
+	uint8_t			limit;					///< Credit limit last advertised
+	uint16_t		throttle_count;			///< Times the CDHIB was throttled
+} flow_control_t;
+
+extern flow_control_t		flow_control;	///< Flow control state
+
+// Functions
+void		flow_control_init		(void);
+uint8_t		flow_control_credits	(void);
+uint8_t		flow_control_limit		(void);
+void		flow_control_update		(void);
+uint8_t		flow_control_telemetry	(uint8_t* dst);
+
+#endif /* FLOW_CONTROL_H_ */
@@ -0,0 +1,289 @@
+/** \file
+ * radio_control.c
+ * \brief Radio control pins source file
+ *
+ */ 
+
+#include "radio_control.h"
+#include "tasks.h"
+#include "../config/conf_radio_link.h"
+#include "../memory/warm_start.h"
+
+radio_control_t		radio_control WARM_NOINIT;	///< Radio control state, configuration kept across warm restarts
+
+/**
+ * Name         : radio_reset_pin
+ *
+ * Synopsis     : static void radio_reset_pin (Bool assert)
+ *
+ * Description  : Drive the radio reset pin (PD4)
+ * 
+ */
+static void radio_reset_pin (Bool assert)
+{
+	Bool high = RADIO_RESET_ACTIVE_LOW ? !assert : assert;
+	
+	if (high)
+		hal_gpio_set(&PORTD, PIN4_bm);
+	else
+		hal_gpio_clear(&PORTD, PIN4_bm);
+}
+
+/**
+ * Name         : radio_control_capture_init
+ *
+ * Synopsis     : static void radio_control_capture_init (void)
+ *
+ * Description  : Start the PD7 edge capture
+ * 
+ */
+static void radio_control_capture_init (void)
+{
+	#ifndef DEBUG_CLOCK_OUT
+		// PD7 edges -> event channel 0 -> TCC0 capture A
+		hal_capture_init();
+	#endif
+}
+
+/**
+ * Name         : radio_control_init
+ *
+ * Synopsis     : void radio_control_init (void)
+ *
+ * Description  : Cold start - start the PD7 edge capture and reset the radio with the default 
+ *				  configuration. Call after timers_init().
+ * 
+ */
+void radio_control_init (void)
+{
+	memset(&radio_control, 0, sizeof(radio_control));
+	radio_control_capture_init();
+	radio_control_reset(RADIO_CONFIG_DEFAULT);
+}
+
+/**
+ * Name         : radio_control_resume
+ *
+ * Synopsis     : void radio_control_resume (void)
+ *
+ * Description  : Warm start - drive the pins as they were, without a radio reset (a reset in 
+ *				  progress is finished by releasing the pin), and start the PD7 edge capture.
+ *				  Call after timers_init(), before io_init() turns the pins to outputs.
+ * 
+ */
+void radio_control_resume (void)
+{
+	radio_control_configure(radio_control.config);
+	radio_reset_pin(false);
+	
+	radio_control.state =			RADIO_CONTROL_IDLE;
+	radio_control.event_in =		0;
+	radio_control.event_out =		0;
+	radio_control_capture_init();
+}
+
+/**
+ * Name         : radio_control_update
+ *
+ * Synopsis     : void radio_control_update (void)
+ *
+ * Description  : Run the reset state machine. Called on every scheduler pass, never waits.
+ * 
+ */
+void radio_control_update (void)
+{
+	uint16_t elapsed = get_mticks() - radio_control.state_time;
+	
+	switch (radio_control.state)
+	{
+		case RADIO_CONTROL_RESET:
+			if (elapsed >= RADIO_RESET_PULSE_MS)
+			{
+				radio_reset_pin(false);
+				radio_control.state =		RADIO_CONTROL_BOOT;
+				radio_control.state_time =	get_mticks();
+			}
+			break;
+			
+		case RADIO_CONTROL_BOOT:
+			if (elapsed >= RADIO_BOOT_MS)
+			{
+				radio_control.state = RADIO_CONTROL_IDLE;
+				radio_control.resets++;
+			}
+			break;
+			
+		default:
+			break;
+	}
+}
+
+/**
+ * Name         : radio_control_ready
+ *
+ * Synopsis     : Bool radio_control_ready (void)
+ *
+ * \return			true if the radio is running (not in a reset)
+ */
+Bool radio_control_ready (void)
+{
+	return radio_control.state == RADIO_CONTROL_IDLE;
+}
+
+/**
+ * Name         : radio_control_configure
+ *
+ * Synopsis     : void radio_control_configure (uint8_t config)
+ *
+ * \param	config	Configuration bits (RADIO_CONFIG_MASK)
+ *
+ * Description  : Drive the configuration pins (PD5, PD6) now. 
+ *				  A radio that reads them only at reset needs radio_control_reset() instead.
+ * 
+ */
+void radio_control_configure (uint8_t config)
+{
+	radio_control.config = config & RADIO_CONFIG_MASK;
+	
+	if (radio_control.config & 0x01)
+		hal_gpio_set(&PORTD, PIN5_bm);
+	else
+		hal_gpio_clear(&PORTD, PIN5_bm);
+	
+	if (radio_control.config & 0x02)
+		hal_gpio_set(&PORTD, PIN6_bm);
+	else
+		hal_gpio_clear(&PORTD, PIN6_bm);
+}
+
+/**
+ * Name         : radio_control_reset
+ *
+ * Synopsis     : Bool radio_control_reset (uint8_t config)
+ *
+ * \param	config	Configuration bits (RADIO_CONFIG_MASK) for the radio to start with
+ *
+ * Description  : Start a radio reset with a configuration. radio_control_update() completes it.
+ * 
+ * \return			true if started, false if a reset is already in progress
+ */
+Bool radio_control_reset (uint8_t config)
+{
+	if (!radio_control_ready())
+		return false;
+	
+	radio_control_configure(config);
+	radio_reset_pin(true);
+	radio_control.state =		RADIO_CONTROL_RESET;
+	radio_control.state_time =	get_mticks();
+	
+	return true;
+}
+
+/**
+ * Name         : radio_control_edge
+ *
+ * Synopsis     : void radio_control_edge (void)
+ *
+ * Description  : Log a PD7 edge with the time TCC0 captured it. Called by the TCC0 capture A interrupt.
+ * 
+ */
+void radio_control_edge (void)
+{
+	radio_event_t	event;
+	uint8_t			next;
+	
+	event.count =	hal_timer_capture();
+	event.ms =		mTicks;
+	event.level =	hal_gpio_read(&PORTD, PIN7_bm) ? 1 : 0;
+	
+	// Timer overflow not handled by its ISR yet - the edge is after it if the count wrapped before the capture
+	if (hal_timer_overflow() && event.count <= hal_timer_count())
+		event.ms++;
+	
+	radio_control.edges++;
+	radio_control.last_event = event;
+	
+	next = (radio_control.event_in + 1) & (RADIO_EVENT_LOG - 1);
+	if (next == radio_control.event_out)
+	{
+		radio_control.events_lost++;
+		return;
+	}
+	
+	radio_control.events[radio_control.event_in] =	event;
+	radio_control.event_in =						next;
+}
+
+/**
+ * Name         : radio_control_telemetry
+ *
+ * Synopsis     : uint8_t radio_control_telemetry (uint8_t* dst)
+ *
+ * \param	dst		Destination buffer, at least RADIO_CONTROL_SIZE bytes
+ *
+ * Description  : Build the radio control packet (MSB first) - state, configuration, PD7 level,
+ *				  resets, PD7 edges, edges lost, last edge time (ms, 8 us count) and level
+ * 
+ * \return			Packet size in bytes
+ */
+uint8_t radio_control_telemetry (uint8_t* dst)
+{
+	uint16_t		edges;
+	uint8_t			lost;
+	radio_event_t	last;
+	uint8_t			i = 0;
+	
+	HAL_CRITICAL
+	{
+		edges =	radio_control.edges;
+		lost =	radio_control.events_lost;
+		last =	radio_control.last_event;
+	}
+	
+	dst[i++] = radio_control.state;
+	dst[i++] = radio_control.config;
+	dst[i++] = hal_gpio_read(&PORTD, PIN7_bm) ? 1 : 0;
+	dst[i++] = MSB(radio_control.resets);
+	dst[i++] = LSB(radio_control.resets);
+	dst[i++] = MSB(edges);
+	dst[i++] = LSB(edges);
+	dst[i++] = lost;
+	dst[i++] = MSB(last.ms);
+	dst[i++] = LSB(last.ms);
+	dst[i++] = last.count;
+	dst[i++] = last.level;
+	
+	return i;
+}
+
+/**
+ * Name         : radio_control_events
+ *
+ * Synopsis     : uint8_t radio_control_events (uint8_t* dst, uint8_t size)
+ *
+ * \param	dst		Destination buffer
+ * \param	size	Destination buffer size
+ *
+ * Description  : Take the oldest PD7 edges from the log, as many as fit. 
+ *				  Each is RADIO_EVENT_SIZE bytes - time (ms MSB first, 8 us count) and level
+ * 
+ * \return			Bytes written
+ */
+uint8_t radio_control_events (uint8_t* dst, uint8_t size)
+{
+	uint8_t i = 0;
+	
+	while (radio_control.event_out != radio_control.event_in && i + RADIO_EVENT_SIZE <= size)
+	{
+		radio_event_t* event = &radio_control.events[radio_control.event_out];
+		
+		dst[i++] = MSB(event->ms);
+		dst[i++] = LSB(event->ms);
+		dst[i++] = event->count;
+		dst[i++] = event->level;
+		radio_control.event_out = (radio_control.event_out + 1) & (RADIO_EVENT_LOG - 1);
+	}
+	
+	return i;
+}
@@ -0,0 +1,69 @@
+/** \file
+ * radio_control.h
+ * \brief Radio control pins header file
+ *
+ *	Radio digital pins:
+ * *	PD4 - radio reset (output)
+ * *	PD5, PD6 - radio external configuration 1, 2 (outputs), bits 0, 1 of the configuration
+ * *	PD7 - radio external event (input)
+ *
+ *	A reset drives the configuration pins, holds the reset pin for RADIO_RESET_PULSE_MS and
+ *	waits RADIO_BOOT_MS for the radio to start. It runs from radio_control_update(), called
+ *	on every scheduler pass, so the CDHIB link keeps going meanwhile. Transmissions to the
+ *	radio are held until radio_control_ready().
+ *
+ *	PD7 edges are captured by TCC0 (through event channel 0) and kept with their time
+ *	in a small log, read with RADIO_EVENTS_COMMAND.
+ */ 
+
+
+#ifndef RADIO_CONTROL_H_
+#define RADIO_CONTROL_H_
+
+#include <asf.h>
+
+// Radio control states
+#define RADIO_CONTROL_IDLE			0		///< Radio running
+#define RADIO_CONTROL_RESET			1		///< Reset pin asserted
+#define RADIO_CONTROL_BOOT			2		///< Reset released, waiting for the radio to start
+
+#define RADIO_CONFIG_MASK			0x03	///< Configuration bits - bit 0 on PD5, bit 1 on PD6
+#define RADIO_EVENT_LOG				8		///< PD7 edges kept until read. Power of 2
+#define RADIO_EVENT_SIZE			4		///< Size in bytes of one PD7 edge in the events packet
+#define RADIO_CONTROL_SIZE			12		///< Size in bytes of the radio control packet
+
+/// PD7 edge
+typedef struct {
+	uint16_t		ms;						///< mTicks at the edge
+	uint8_t			count;					///< TCC0 count at the edge, in 8 us (256 CPU cycles)
+	uint8_t			level;					///< PD7 level after the edge
+} radio_event_t;
+
+/// Radio control state
+typedef struct {
+	uint8_t			state;					///< RADIO_CONTROL_IDLE...
+	uint8_t			config;					///< Configuration on PD5, PD6
+	uint16_t		state_time;				///< Time the state started, ms
+	uint16_t		resets;					///< Resets done
+	volatile uint16_t	edges;				///< PD7 edges seen
+	volatile uint8_t	events_lost;		///< PD7 edges not logged, log full
+	volatile uint8_t	event_in;			///< Next log entry to write (ISR)
+	uint8_t			event_out;				///< Next log entry to read
+	radio_event_t	events[RADIO_EVENT_LOG];	///< PD7 edge log
+	radio_event_t	last_event;				///< Last PD7 edge
+} radio_control_t;
+
+extern radio_control_t		radio_control;	///< Radio control state
+
+// Functions
+void		radio_control_init		(void);
+void		radio_control_resume	(void);
+void		radio_control_update	(void);
+Bool		radio_control_ready		(void);
+Bool		radio_control_reset		(uint8_t config);
+void		radio_control_configure	(uint8_t config);
+void		radio_control_edge		(void);
+uint8_t		radio_control_telemetry	(uint8_t* dst);
+uint8_t		radio_control_events	(uint8_t* dst, uint8_t size);
+
+#endif /* RADIO_CONTROL_H_ */
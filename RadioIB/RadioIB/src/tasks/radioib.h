@@ -1,29 +1,64 @@
-/** \file
- * radioib.h
- * \brief Radio IB header file
- *
- * Created: 3/5/2012
- *  Author: Liran
- */ 
-
-
-#ifndef RADIOIB_H_
-#define RADIOIB_H_
-
-#define RADIO_IB_COMMAND_PACKET_SIZE	3			///< Size in bytes of the command packet
-#define NOOP_COMMAND					0x00		///< No Op command code
-#define ACK_SIZE						3			///< Size in bytes of the Acknowledge packet
-
-/// Structure of the command packet
-typedef struct {
-	uint8_t				Command_Header;				///< 8 bit header of the command packet
-	uint16_t			Command_Argument; 			///< 16 bit argument of the command packet 
-} Command_Packet_t;	
-
-Command_Packet_t		Command_packet;
-
-Bool					Command_received;			///< Flag to indicate a command packet for the MCU is ready	
-uint8_t					ACK[ACK_SIZE];				///< Buffer to hold the Ack packet
-
-
+/** \file
+ * radioib.h
+ * \brief Radio IB header file
+ *
+ * Created: 3/5/2012
+ *  Author: Liran
+ */ 
+
+
+#ifndef RADIOIB_H_
+#define RADIOIB_H_
+
+#include <asf.h>
+#include "../vcp/common.h"
+
+// Command codes - index into the command table in commands.c
+#define NOOP_COMMAND					0x00		///< No Op command code
+#define MEMORY_TELEMETRY_COMMAND		0x01		///< Memory telemetry command code - stack and buffer high-water marks
+#define DELAYED_ACK_COMMAND				0x02		///< Delayed ACK command code - "ACK" after [argument] ms, in its own response frame
+#define RADIO_LINK_TELEMETRY_COMMAND	0x03		///< Radio link telemetry command code - ARQ and compression counters
+#define RADIO_LINK_TELEMETRY_SIZE		34			///< Size in bytes of the radio link telemetry packet
+#define FLOW_CREDIT_COMMAND				0x04		///< Flow control command code - receive credits for frames to the radio (see flow_control.h)
+#define RADIO_PACING_COMMAND			0x05		///< Radio pacing command code - set / read the radio transmit token bucket
+#define RADIO_PACING_SIZE				13			///< Size in bytes of the radio pacing packet
+#define RADIO_CONTROL_COMMAND			0x06		///< Radio control command code - [action][configuration], see radio_control.h
+#define RADIO_EVENTS_COMMAND			0x07		///< Radio events command code - PD7 edges logged since the last read
+#define STORE_COMMAND					0x08		///< Store-and-forward command code - [action][argument], ground passes and data class
+#define STORE_TELEMETRY_SIZE			(13 + 4 * STORE_CLASSES)	///< Size in bytes of the store-and-forward packet
+#define STATS_JOURNAL_COMMAND			0x09		///< Statistics journal command code - totals kept in EEPROM across resets, [1] to commit now
+#define WARM_START_COMMAND				0x0A		///< Warm start command code - reset cause, warm starts, cold and warm start times
+#define SELF_BENCH_COMMAND				0x0B		///< Self-benchmark command code - VCP codec and CRC cycles on this part, see self_bench.h
+#define BERT_COMMAND					0x0C		///< Bit error rate test command code - [action][VCP address][pattern][rate][seconds], see bert.h
+#define ACK_SIZE						3			///< Size in bytes of the Acknowledge packet
+
+// Radio pacing modes (RADIO_PACING_COMMAND)
+#define RADIO_PACING_KEEP				0xFFFF		///< Rate that leaves the pacing as it is - read only
+#define RADIO_PACING_PD7				0x01		///< Also hold transmissions until the radio external event pin (PD7) shows buffer ready
+#define RADIO_PACING_PD7_LOW			0x02		///< PD7 buffer ready is active low
+
+// Radio control actions (RADIO_CONTROL_COMMAND)
+#define RADIO_CONTROL_STATUS			0x00		///< Read the radio control state
+#define RADIO_CONTROL_CONFIGURE			0x01		///< Drive the configuration pins now
+#define RADIO_CONTROL_RESET_RADIO		0x02		///< Reset the radio with a configuration - responds when the radio has started
+
+// Store-and-forward actions (STORE_COMMAND)
+#define STORE_STATUS					0x00		///< Read the store-and-forward state
+#define STORE_PASS_START				0x01		///< Ground contact for [argument] seconds (0 - until STORE_PASS_END). The store is dumped
+#define STORE_PASS_END					0x02		///< Out of contact - frames for the radio are stored
+#define STORE_SET_CLASS					0x03		///< Data class [argument] for the next frames stored (0 - highest priority)
+#define STORE_CLEAR						0x04		///< Drop all the stored frames
+
+// Bit error rate test actions (BERT_COMMAND)
+#define BERT_STATUS						0x00		///< Read the test state and results
+#define BERT_START						0x01		///< Send and check [pattern] at [rate] bytes per second (0 - line rate) for [seconds] (0 - until BERT_STOP)
+#define BERT_LOOPBACK					0x02		///< Send back every byte received on the link for [seconds] (0 - until BERT_STOP)
+#define BERT_STOP						0x03		///< End the test
+
+uint8ptr				Command_frame;				///< Received command frame, in place in the CDHIB receive buffer
+uint16_t				Command_frame_size;			///< Received command frame size
+Bool					Command_received;			///< Flag to indicate a command frame for the MCU is ready	
+uint8_t					ACK[ACK_SIZE];				///< Buffer to hold the Ack packet
+
+
 #endif /* RADIOIB_H_ */
\ No newline at end of file
@@ -1,163 +1,621 @@
-/** \file
- * tasks.c
- * \brief Tasks source file
- *
- *  Author: Liran
- */ 
-
-#include <asf.h>
-#include "tasks.h"
-
-#ifdef DEBUG
-
-
-#endif
-
-
-/*********/
-/* Tasks */
-/*********/
-
-#ifdef DEBUG
-/**
- * Name         : debug_task
- *
- * Synopsis     : void debug_task	(void)
- *
- * Description  : Task for debug only. Runs when DEBUG is defined in conf_board.h
- * 
- */
-void debug_task	(void)
-{
-		
-	for(;;)
-	{
-		// test external and internal osc
-		
-		if (xosc_recovey)
-			switch_to_ext_osc ();
-		
-		if (OSC.STATUS & OSC_XOSCRDY_bm)
-			PORTA.OUTCLR =	PIN1_bm;
-		else
-			PORTA.OUTSET =	PIN1_bm;
-			
-		if (OSC.STATUS & OSC_RC32MRDY_bm)
-			PORTA.OUTCLR =	PIN2_bm;
-		else
-			PORTA.OUTSET =	PIN2_bm;
-			
-	}
-}
-#endif // DEBUG
-
-/**
- * Name         : cdhib_uart_task
- *
- * Synopsis     : void cdhib_uart_task	(void)
- *
- * Description  : CDHIB Task
- * *			Read the CDHIB USART receive buffer
- * *			Check for received CDHIB data determine the destination
- * *			Check the CDHIB transmit queue, and transmit data to the CDHIB if available
- * 
- */
-void cdhib_uart_task	(void)
-{
-	read_VCP_receive_buff(&cdhib);
-	
-	if (cdhib.rx_data_ready)										// New data from CDHIB ready
-	{  
-		cdhib.rx_data_ready =	false;
-		
-		// Check the destination for the new data
-		if (cdhib.rx_data_destination == radioib.VCP_address)
-		{
-			// Data for radio
-		}
-		else if (cdhib.rx_data_destination == radioib.VCP_address)
-		{
-			// Command for radio IB
-			memcpy(&Command_packet, cdhib.rx_data, RADIO_IB_COMMAND_PACKET_SIZE);
-			Command_received = true;		
-		}
-		else
-		{
-			// Bad address
-		}
-	}
-	
-	// Check transmit queue and transmit to CDHIB 
-	if (!Queue_RingBuffer_IsEmpty(&cdhib_queue_ringbuff))				// There's something in the queue
-	{
-		uint8 source_vcp_address = Queue_RingBuffer_Remove(&cdhib_queue_ringbuff); // what's the source for this data?
-		
-		// Check the source of the new data
-		if (source_vcp_address == radio.VCP_address)
-		{
-			VCP_DMA_transmit(&radio, &cdhib);	// build VCP frame and transmit with DMA 
-		}		
-		else if (source_vcp_address == radioib.VCP_address)
-		{
-			VCP_DMA_transmit(&radioib, &cdhib);	// build VCP frame and transmit with DMA 
-		}
-		else
-		{
-			// Bad address
-		}
-	}	
-		
-}
-
-/**
- * Name         : radio_uart_task
- *
- * Synopsis     : void radio_uart_task	(void)
- *
- * Description  : Radio Task
- * 
- */
-void radio_uart_task	(void)
-{
-
-}
-
-/**
- * Name         : radio_ib_task
- *
- * Synopsis     : void radio_ib_task	(void)
- *
- * Description  : Radio IB (Local) Task
- * *			If internal oscillator is used as clock source - try to switch to external oscillator
- * *			Check for new command from CDHIB and execute
- * 
- */
-void radio_ib_task	(void)
-{
-
-	// In case internal oscillator is in use - try to switch to external oscillator
-	if (xosc_recovey)
-		switch_to_ext_osc ();
-		
-	if (Command_received)
-	{
-		Command_received = false;	
-		// parse command...
-		switch(Command_packet.Command_Header)
-		{
-			case NOOP_COMMAND:
-				// ACK back to cdhib
-				cdhib.rx_data =			ACK;
-				cdhib.rx_byte_count =	ACK_SIZE;
-				Queue_RingBuffer_Insert(&cdhib_queue_ringbuff, radioib.VCP_address);	// Insert to cdhib transmit queue
-				break;
-			case 1:
-				break;
-			case 2:
-				break;
-			default:
-				break;
-		}
-
-	}		
+/** \file
+ * tasks.c
+ * \brief Tasks source file
+ *
+ *  Author: Liran
+ */ 
+
+#include <asf.h>
+#include "tasks.h"
+#include "../debug/dlog.h"
+#include "../memory/ram_monitor.h"
+#include "../memory/stats_journal.h"
+#include "../memory/warm_start.h"
+#include "bert.h"
+#include "commands.h"
+#include "flow_control.h"
+#include "radio_control.h"
+
+#ifdef DEBUG
+
+
+#endif
+
+
+/**************/
+/* Radio link */
+/**************/
+
+#if RADIO_COMPRESSION
+/**
+ * Name         : radio_reference_update
+ *
+ * Synopsis     : static uint8ptr radio_reference_update (void)
+ *
+ * Description  : Track the reference payload. It can be used once the ARQ has it acknowledged,
+ *				  and is dropped if any frame was given up meanwhile (it may have been that one).
+ * 
+ * \return			The reference payload, NULL if there is none the ground is known to have
+ */
+static uint8ptr radio_reference_update (void)
+{
+	radio_reference_t* ref = &radio_reference;
+	
+	if (ref->state == RADIO_REFERENCE_WAIT)
+	{
+		if (radio_arq.tx_given_up != ref->given_up)
+			ref->state = RADIO_REFERENCE_NONE;
+		else if (arq_tx_acked(&radio_arq, ref->seq))
+			ref->state = RADIO_REFERENCE_READY;
+	}
+	
+	return (ref->state == RADIO_REFERENCE_READY) ? ref->data : NULL;
+}
+#endif
+
+/**
+ * Name         : radio_link_send
+ *
+ * Synopsis     : static void radio_link_send (uint8ptr data, uint16_t size)
+ *
+ * Description  : Copy a payload for the radio into the ARQ transmit window, LZSS compressed
+ *				  when RADIO_COMPRESSION is set and the payload gets smaller.
+ *				  The caller checks arq_tx_space() first.
+ * *			Compressed against the reference payload when the ground has it - 
+ *				consecutive telemetry frames are much alike
+ * *			Every RADIO_REFERENCE_INTERVAL frames (or when there is none) the payload
+ *				becomes the next reference
+ * 
+ */
+static void radio_link_send (uint8ptr data, uint16_t size)
+{
+#if RADIO_COMPRESSION
+	radio_reference_t*	ref = &radio_reference;
+	uint8_t				seq = radio_arq.tx_next;
+	uint8ptr			dict = radio_reference_update();
+	uint16_t			start = get_timer_ticks();
+	uint16_t			compressed_size;
+	uint8_t				flags = ARQ_FLAG_COMPRESSED;
+	
+	// The reference byte leaves size - 2 for the tokens - nothing to win below 3 bytes
+	if (dict && size > 2)
+	{
+		// [reference sequence number][compressed payload]
+		radio_lzss_buff[0] = ref->seq;
+		compressed_size = lzss_compress(&radio_lzss, dict, ref->size, data, size, &radio_lzss_buff[1], size - 2);
+		if (compressed_size)
+			compressed_size++;
+		flags |= ARQ_FLAG_REFERENCE;
+		ref->uses++;
+	}
+	else
+	{
+		compressed_size = lzss_compress(&radio_lzss, NULL, 0, data, size, radio_lzss_buff, size - 1);
+	}
+	
+	radio_compression.timer_ticks += (uint16_t)(get_timer_ticks() - start);
+	radio_compression.bytes_in += size;
+	
+	if (compressed_size)
+	{
+		radio_compression.bytes_out += compressed_size;
+		radio_compression.frames++;
+		arq_send(&radio_arq, radio_lzss_buff, compressed_size, flags);
+	}
+	else
+	{
+		radio_compression.bytes_out += size;
+		arq_send(&radio_arq, data, size, 0);
+	}
+	
+	// Next reference
+	if (ref->state == RADIO_REFERENCE_NONE || (ref->state == RADIO_REFERENCE_READY && ref->uses >= RADIO_REFERENCE_INTERVAL))
+	{
+		memcpy(ref->data, data, size);
+		ref->size =		size;
+		ref->check =	arq_check(0, data, size);
+		ref->seq =		seq;
+		ref->uses =		0;
+		ref->given_up =	radio_arq.tx_given_up;
+		ref->state =	RADIO_REFERENCE_WAIT;
+	}
+#else
+	arq_send(&radio_arq, data, size, 0);
+#endif
+}
+
+#if RADIO_STORE
+/**
+ * Name         : radio_pass_update
+ *
+ * Synopsis     : static void radio_pass_update (uint16_t now)
+ *
+ * Description  : Count down the seconds of a timed ground pass, and end it
+ * 
+ */
+static void radio_pass_update (uint16_t now)
+{
+	if (!radio_pass.contact || radio_pass.remaining == 0)
+		return;
+	
+	if ((uint16_t)(now - radio_pass.second_time) >= 1000)
+	{
+		radio_pass.second_time += 1000;
+		if (--radio_pass.remaining == 0)
+			radio_pass.contact = false;
+	}
+}
+
+/**
+ * Name         : radio_store_forward
+ *
+ * Synopsis     : static void radio_store_forward (void)
+ *
+ * Description  : Move the CDHIB frame for the radio to the store while out of contact.
+ *				  In contact, give the oldest stored frame of the highest priority class to the ARQ 
+ *				  when it has space and no CDHIB frame is waiting - new frames go first.
+ * 
+ */
+static void radio_store_forward (void)
+{
+	uint8ptr	data;
+	uint8_t		size;
+	
+	if (!radio_pass.contact)
+	{
+		if (radio_data_pending)
+		{
+			store_append(&radio_store, radio_pass.data_class, cdhib.rx_data, cdhib.rx_byte_count);
+			radio_data_pending = false;
+		}
+		return;
+	}
+	
+	if (!radio_data_pending && arq_tx_space(&radio_arq))
+	{
+		size = store_next(&radio_store, &data);
+		if (size)
+		{
+			radio_link_send(data, size);
+			store_release(&radio_store);
+		}
+	}
+}
+#endif
+
+static uint8ptr	radio_tx_block;			///< Transmission to the radio held for pacing tokens
+static uint16_t	radio_tx_size;			///< Its size, 0 when none
+
+/**
+ * Name         : radio_tx_allowed
+ *
+ * Synopsis     : static Bool radio_tx_allowed (void)
+ *
+ * \return			true if the radio is not in a reset and in contact (RADIO_STORE)
+ */
+static Bool radio_tx_allowed (void)
+{
+#if RADIO_STORE
+	if (!radio_pass.contact)
+		return false;
+#endif
+	return radio_control_ready();
+}
+
+/**
+ * Name         : radio_buffer_ready
+ *
+ * Synopsis     : static Bool radio_buffer_ready (void)
+ *
+ * Description  : Check the radio may transmit, and the radio buffer ready signal on the 
+ *				  external event pin (PD7) if pacing uses it
+ * 
+ * \return			true if the radio can take the next transmission
+ */
+static Bool radio_buffer_ready (void)
+{
+	// Radio in a reset, or nobody listening
+	if (!radio_tx_allowed())
+		return false;
+	
+	if (!(radio_pacing_mode & RADIO_PACING_PD7))
+		return true;
+	
+	if (radio_pacing_mode & RADIO_PACING_PD7_LOW)
+		return !hal_gpio_read(&PORTD, PIN7_bm);
+	
+	return hal_gpio_read(&PORTD, PIN7_bm) != 0;
+}
+
+/**
+ * Name         : radio_link_transmit
+ *
+ * Synopsis     : static void radio_link_transmit (uint16_t now)
+ *
+ * Description  : Transmit the next ARQ frame (status, retransmission or new data) in a VCP frame.
+ *				  With RADIO_FEC the VCP frame goes out as FEC blocks, one per call.
+ *				  A transmission is held until the radio pacing token bucket has its size in bytes
+ *				  (and the radio shows buffer ready on PD7, with RADIO_PACING_PD7).
+ *				  No ARQ frame is polled while the radio may not transmit - a status frame built
+ *				  out of contact or during a radio reset would be stale when it goes out.
+ *				  Call when the radio DMA is idle.
+ * 
+ */
+static void radio_link_transmit (uint16_t now)
+{
+	uint8ptr	frame;
+	uint16_t	frame_size;
+	
+	if (radio_tx_size == 0)
+	{
+#if RADIO_FEC
+		uint16_t	start = get_timer_ticks();
+		uint16_t	block_size = fec_tx_next(&radio_fec);	// Next block of the frame being sent
+		
+		if (block_size == 0)
+		{
+			if (!radio_tx_allowed())
+				return;
+			frame_size = arq_tx_poll(&radio_arq, now, &frame);
+			if (frame_size == 0 || VCP_frame_buffer(radioib.VCP_address, frame, frame_size, &radio) != VCP_TERM)
+				return;
+			
+			start = get_timer_ticks();
+			fec_tx_start(&radio_fec, radio.tx_data, radio.tx_byte_count);
+			block_size = fec_tx_next(&radio_fec);
+			radio_fec_bytes += radio.tx_byte_count;
+		}
+		radio_fec_ticks += (uint16_t)(get_timer_ticks() - start);
+		
+		radio_tx_block =	radio_fec.block;
+		radio_tx_size =		block_size;
+#else
+		if (!radio_tx_allowed())
+			return;
+		frame_size = arq_tx_poll(&radio_arq, now, &frame);
+		if (frame_size == 0 || VCP_frame_buffer(radioib.VCP_address, frame, frame_size, &radio) != VCP_TERM)	// build VCP frame
+			return;
+		
+		radio_tx_block =	radio.tx_data;
+		radio_tx_size =		radio.tx_byte_count;
+#endif
+	}
+	
+	// Keep the radio buffer from overflowing - hold the transmission until the radio can take it
+	if (!radio_buffer_ready() || !pacing_take(&radio_pacing, now, radio_tx_size))
+		return;
+	
+	DMA_transmit_block(&radio, radio_tx_block, radio_tx_size);
+	radio_tx_size = 0;
+}
+
+/**
+ * Name         : radio_link_deliver
+ *
+ * Synopsis     : static void radio_link_deliver (void)
+ *
+ * Description  : Transmit the next in-order ARQ payload from the ground to the CDHIB,
+ *				  decompressing it if the ground sent it compressed. The Radio IB keeps no 
+ *				  earlier payloads, so frames compressed against one are dropped.
+ * 
+ */
+static void radio_link_deliver (void)
+{
+	uint8ptr	data;
+	uint8_t		flags;
+	uint16_t	size = arq_deliver(&radio_arq, &data, &flags);
+	
+	if (size == 0)
+		return;
+	
+	if (flags & ARQ_FLAG_COMPRESSED)
+	{
+		uint16_t compressed_size = size;
+		
+		size = (flags & ARQ_FLAG_REFERENCE) ? 0 : lzss_decompress(NULL, 0, data, compressed_size, radio_lzss_buff, LZSS_MAX_INPUT);
+		data = radio_lzss_buff;
+		if (size == 0)
+			dlog_w(DLOG_LZSS_ERR, compressed_size);
+	}
+	
+	if (size)
+		VCP_DMA_transmit_buffer(radio.VCP_address, data, size, &cdhib);	// build VCP frame and transmit with DMA 
+	arq_deliver_done(&radio_arq);
+}
+
+
+/*********/
+/* Tasks */
+/*********/
+
+#ifdef DEBUG
+/**
+ * Name         : debug_task
+ *
+ * Synopsis     : void debug_task	(void)
+ *
+ * Description  : Task for debug only. Runs when DEBUG is defined in conf_board.h
+ * 
+ */
+void debug_task	(void)
+{
+		
+	for(;;)
+	{
+		// test external and internal osc
+		
+		if (xosc_recovey)
+			switch_to_ext_osc ();
+		
+		if (OSC.STATUS & OSC_XOSCRDY_bm)
+			PORTA.OUTCLR =	PIN1_bm;
+		else
+			PORTA.OUTSET =	PIN1_bm;
+			
+		if (OSC.STATUS & OSC_RC32MRDY_bm)
+			PORTA.OUTCLR =	PIN2_bm;
+		else
+			PORTA.OUTSET =	PIN2_bm;
+		
+		// drain the debug log
+		dlog_flush ();
+		
+		// stack low-water scan
+		ram_monitor_update ();
+			
+	}
+}
+#endif // DEBUG
+
+/**
+ * Name         : cdhib_uart_task
+ *
+ * Synopsis     : void cdhib_uart_task	(void)
+ *
+ * Description  : CDHIB Task
+ * *			Read the CDHIB USART receive buffer
+ * *			Check for received CDHIB data determine the destination
+ * *			Check the CDHIB transmit queue, and transmit data to the CDHIB if available
+ *				Nothing while a bit error rate test runs on the link (see bert.h)
+ * 
+ */
+void cdhib_uart_task	(void)
+{
+	if (bert_owns(&cdhib))
+		return;
+	
+	// Command frames and frames for the radio are used in place - 
+	// don't overwrite them before radio_ib_task / the ARQ are done with them
+	if (!Command_received && !radio_data_pending)
+		read_VCP_receive_buff(&cdhib);
+	
+	if (cdhib.rx_data_ready)										// New data from CDHIB ready
+	{  
+		cdhib.rx_data_ready =	false;
+		
+		// Check the destination for the new data
+		if (cdhib.rx_data_destination == radio.VCP_address)
+		{
+			// Data for radio - radio_uart_task copies it into the ARQ transmit window.
+			// The CDHIB spent a credit on it, also if it is dropped here
+			flow_control.accepted++;
+			if (cdhib.rx_byte_count > 0 && cdhib.rx_byte_count <= ARQ_MAX_PAYLOAD)
+			{
+				radio_data_pending =	true;
+				radio_downlink_bytes +=	cdhib.rx_byte_count;
+			}
+			else
+				dlog_w(DLOG_RADIO_DROP, cdhib.rx_byte_count);
+		}
+		else if (cdhib.rx_data_destination == radioib.VCP_address)
+		{
+			// Command frame for radio IB - executed in place by radio_ib_task, 
+			// which runs before this task reads the next frame into cdhib.rx_data
+			Command_frame =			cdhib.rx_data;
+			Command_frame_size =	cdhib.rx_byte_count;
+			Command_received =		true;		
+		}
+		else
+		{
+			// Bad address
+		}
+	}
+	
+	// Check transmit queue and transmit to CDHIB, once the last transmission is done
+	if (!Queue_RingBuffer_IsEmpty(&cdhib_queue_ringbuff) && DMA_transmit_idle(&cdhib))	// There's something in the queue
+	{
+		uint8 source_vcp_address = Queue_RingBuffer_Remove(&cdhib_queue_ringbuff); // what's the source for this data?
+		
+		// Check the source of the new data
+		if (source_vcp_address == radio.VCP_address)
+		{
+			// next in-order payload from the radio ARQ
+			radio_link_deliver();
+			radio_delivery_queued = false;
+		}		
+		else if (source_vcp_address == radioib.VCP_address)
+		{
+			if (radioib_response_next())		// oldest Radio IB response
+			{
+				VCP_DMA_transmit(&radioib, &cdhib);	// build VCP frame and transmit with DMA 
+				radioib_response_release();
+			}
+		}
+		else
+		{
+			// Bad address
+		}
+	}	
+	
+	// Advertise receive credits to the CDHIB when the radio queue fills or drains
+	flow_control_update();
+}
+
+/**
+ * Name         : radio_uart_task
+ *
+ * Synopsis     : void radio_uart_task	(void)
+ *
+ * Description  : Radio Task
+ * *			Run the radio reset / configuration state machine - only that while a bit error rate test 
+ *				runs on the link (see bert.h), and drop the CDHIB frames for the radio meanwhile
+ * *			Read the Radio USART receive buffer and pass received frames to the ARQ
+ * *			Queue the next in-order payload from the ground for the CDHIB
+ * *			Out of contact, move a CDHIB frame for the radio to the store. In contact, send the stored frames
+ * *			Move a CDHIB frame for the radio into the ARQ transmit window, compressed
+ * *			When the Radio DMA is free, transmit the next ARQ frame (status, retransmission or new data)
+ *				or the next FEC block, paced to the radio air rate
+ * 
+ */
+void radio_uart_task	(void)
+{
+	uint16_t	now = get_mticks();
+	uint8ptr	frame;
+	
+	// Reset / configuration state machine - the rest of the task keeps running
+	radio_control_update();
+	
+	if (bert_owns(&radio))
+	{
+		// A frame left pending would stop cdhib_uart_task reading, and BERT_STOP with it
+		if (radio_data_pending)
+		{
+			dlog_w(DLOG_BERT_DROP, cdhib.rx_byte_count);
+			radio_data_pending = false;
+		}
+		return;
+	}
+	
+	read_VCP_receive_buff(&radio);
+	
+	if (radio.rx_data_ready)										// New frame from the radio
+	{
+		radio.rx_data_ready = false;
+		arq_receive(&radio_arq, now, radio.rx_data, radio.rx_byte_count);
+	}
+	
+	// One radio token in the CDHIB queue at a time, cdhib_uart_task delivers the payload
+	if (!radio_delivery_queued && arq_deliver(&radio_arq, &frame, NULL) && !Queue_RingBuffer_IsFull(&cdhib_queue_ringbuff))
+	{
+		radio_delivery_queued = true;
+		Queue_RingBuffer_Insert(&cdhib_queue_ringbuff, radio.VCP_address);
+	}
+	
+#if RADIO_STORE
+	// Out of contact - store the CDHIB frame. In contact - dump the store
+	radio_pass_update(now);
+	radio_store_forward();
+#endif
+	
+	// CDHIB frame waiting for space in the ARQ window
+	if (radio_data_pending && arq_tx_space(&radio_arq))
+	{
+		radio_link_send(cdhib.rx_data, cdhib.rx_byte_count);
+		radio_data_pending = false;
+	}
+	
+	// Transmit to radio, once the last transmission is done
+	if (DMA_transmit_idle(&radio))
+		radio_link_transmit(now);
+}
+
+/**
+ * Name         : radio_ib_task
+ *
+ * Synopsis     : void radio_ib_task	(void)
+ *
+ * Description  : Radio IB (Local) Task
+ * *			If internal oscillator is used as clock source - try to switch to external oscillator
+ * *			Poll the long running commands in progress, queue their responses when done
+ * *			Check for new command frame from CDHIB, execute all its commands and queue one response
+ * *			Run the bit error rate test
+ * 
+ */
+void radio_ib_task	(void)
+{
+
+	// In case internal oscillator is in use - try to switch to external oscillator
+	if (xosc_recovey)
+		switch_to_ext_osc ();
+		
+	// Run the long running commands in progress
+	command_executor_poll();
+		
+	if (Command_received)
+	{
+		uint8ptr	response = radioib_response_alloc();
+		uint16_t	response_size;
+		
+		// No free response buffer - keep the frame and try again on the next pass. 
+		// The BERT below still runs
+		if (response != NULL)
+		{
+			Command_received = false;
+			
+			// Execute all the commands in the frame, one response frame for all of them.
+			// Keep 2 bytes for the CRC that Create_VCP_frame appends to the response
+			response_size = command_execute_frame(Command_frame, Command_frame_size, response, RADIOIB_RESPONSE_BUFF_SIZE - 2);
+			if (response_size)
+				radioib_response_post(response_size);
+		}
+	}
+	
+	// Every pass, also while responses back up
+	bert_update();
+}
+
+/**
+ * Name         : debug_log_task
+ *
+ * Synopsis     : void debug_log_task	(void)
+ *
+ * Description  : Debug log Task
+ * *			Drain the binary debug log to the debug USART with DMA, if the channel is free
+ * 
+ */
+void debug_log_task	(void)
+{
+	dlog_flush ();
+}
+
+/**
+ * Name         : ram_monitor_task
+ *
+ * Synopsis     : void ram_monitor_task	(void)
+ *
+ * Description  : RAM monitor Task
+ * *			Continue the scan for the stack low-water mark, a few bytes per call
+ * 
+ */
+void ram_monitor_task	(void)
+{
+	ram_monitor_update ();
+}
+
+/**
+ * Name         : stats_journal_task
+ *
+ * Synopsis     : void stats_journal_task	(void)
+ *
+ * Description  : Statistics journal Task
+ * *			Merge the link counters into the persistent totals, commit them to EEPROM in the background
+ * 
+ */
+void stats_journal_task	(void)
+{
+	stats_journal_update ();
+}
+
+/**
+ * Name         : warm_start_task
+ *
+ * Synopsis     : void warm_start_task	(void)
+ *
+ * Description  : Warm start Task
+ * *			Checksum the radio link state at the end of the scheduler pass, for a warm restart
+ * 
+ */
+void warm_start_task	(void)
+{
+	warm_start_seal ();
 }
\ No newline at end of file
@@ -1,25 +1,65 @@
-/** \file
- * tasks.h
- * \brief Tasks header file
- *
- *  Author: Liran
- */ 
-
-#ifndef TASKS_H_
-#define TASKS_H_
-
-#include <asf.h>
-#include "../config/conf_board.h"
-#include "../memory/memory.h"
-
-volatile extern Bool	xosc_recovey;		///< Flag for attempt to recover from external oscillator failure
-
-
-void cdhib_uart_task				(void);
-void radio_uart_task				(void);
-void radio_ib_task					(void);
-#ifdef DEBUG
-void debug_task						(void);
-#endif
-
+/** \file
+ * tasks.h
+ * \brief Tasks header file
+ *
+ *  Author: Liran
+ */ 
+
+#ifndef TASKS_H_
+#define TASKS_H_
+
+#include <asf.h>
+#include "../hal/hal.h"
+#include "../config/conf_board.h"
+#include "../memory/memory.h"
+
+extern volatile Bool		xosc_recovey;		///< Flag for attempt to recover from external oscillator failure
+extern volatile uint16_t	mTicks;			///< Free running milliseconds tick
+
+
+/// Read the milliseconds tick. Use (uint16_t)(get_mticks() - start) for intervals up to 65 seconds
+static inline uint16_t get_mticks(void)
+{
+	uint16_t ticks;
+	
+	HAL_CRITICAL
+	{
+		ticks = mTicks;
+	}
+	
+	return ticks;
+}
+
+/// Read the timer in ticks of 256 CPU cycles (TCC0 count + mTicks). Use (uint16_t)(get_timer_ticks() - start) for intervals up to 0.5 seconds
+static inline uint16_t get_timer_ticks(void)
+{
+	uint16_t ms, count;
+	
+	HAL_CRITICAL
+	{
+		count =	hal_timer_count();
+		ms =	mTicks;
+		// Overflow not handled by the ISR yet
+		if (hal_timer_overflow())
+		{
+			count =	hal_timer_count();
+			ms++;
+		}
+	}
+	
+	return ms * hal_timer_period() + count;
+}
+
+
+void cdhib_uart_task				(void);
+void radio_uart_task				(void);
+void radio_ib_task					(void);
+void debug_log_task					(void);
+void ram_monitor_task				(void);
+void stats_journal_task				(void);
+void warm_start_task				(void);
+#ifdef DEBUG
+void debug_task						(void);
+#endif
+
 #endif /* TASKS_H_ */
\ No newline at end of file
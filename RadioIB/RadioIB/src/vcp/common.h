@@ -1,7 +1,7 @@
 /** \file
  * common.h
- * \brief Common header file
- *
+ * \brief Common header file
+ *
  *  Created on: Jun 14, 2010
  *      Author: Ned Bingham
  */
@@ -9,12 +9,12 @@
 #ifndef common_h
 #define common_h
 
-// Defined for the CRC functions
+// Defined for the CRC functions. Host builds define COMP_PLATFORM on the command line
+#ifndef COMP_PLATFORM
 #define MCU_PLATFORM
-//#define COMP_PLATFORM
+#endif
 
-// for debugging purposes
-#include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 
 // Define common types for portability reasons
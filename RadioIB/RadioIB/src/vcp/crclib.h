@@ -1,7 +1,7 @@
 /** \file
  * crclib.h
- * \brief CRC Library header file
- *
+ * \brief CRC Library header file
+ *
  *  Created on: Jun 14, 2010
  *      Author: Ned Bingham
  */
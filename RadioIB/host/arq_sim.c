@@ -0,0 +1,255 @@
+/** \file
+ * arq_sim.c
+ * \brief Radio link ARQ goodput simulation
+ *
+ *	Runs the firmware ARQ (radio/arq.c) and VCP codec (vcp/vcp_library.c) on both ends
+ *	of a simulated full duplex radio link with random bit errors, and compares the 
+ *	goodput with plain VCP frames sent back-to-back without ARQ.
+ *	Plain goodput counts every frame that got through, with gaps where frames were lost;
+ *	ARQ goodput is in order and has gaps only where a frame was given up after ARQ_MAX_RETRIES.
+ *
+ *	Usage: arq_sim [-r air rate bps] [-l one way latency ms] [-t seconds] [-s seed] [BER ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "vcp_library.h"
+#include "arq.h"
+
+#define SIM_ADDRESS			VCP_RADIOIB_1			///< VCP address of the simulated link frames
+#define SIM_FRAME_BUFF		1024					///< Encoded frame buffer size
+#define SIM_IN_FLIGHT		64						///< Max frames on the air per direction
+
+/// Frame on the air
+typedef struct {
+	long		arrival;							///< Arrival time, ms
+	uint16_t	size;								///< Encoded size
+	uint8_t		bytes[SIM_FRAME_BUFF];				///< Encoded VCP frame, with bit errors
+} sim_frame_t;
+
+/// One direction of the link
+typedef struct {
+	sim_frame_t	air[SIM_IN_FLIGHT];					///< Frames on the air, in arrival order
+	int			count;								///< Number of frames on the air
+	long		busy_until;							///< Transmitter busy until, ms
+} sim_channel_t;
+
+static double	air_rate =	9600;					///< Air rate, bits per second
+static long		latency =	20;						///< One way latency, ms
+static long		duration =	600;					///< Simulated time, s
+static double	ber;								///< Bit error rate of the current run
+
+/**
+ * Name         : channel_send
+ *
+ * Synopsis     : static void channel_send (sim_channel_t *ch, long now, uint8_t *frame, uint16_t size)
+ *
+ * Description  : VCP encode a frame, add bit errors and put it on the air
+ */
+static void channel_send (sim_channel_t *ch, long now, uint8_t *frame, uint16_t size)
+{
+	sim_frame_t *	f;
+	uint16_t		encoded = SIM_FRAME_BUFF;
+	long			air_time;
+
+	if (ch->count == SIM_IN_FLIGHT)
+		return;
+	f = &ch->air[ch->count];
+
+	if (Create_VCP_frame(f->bytes, &encoded, SIM_ADDRESS, frame, size) != VCP_TERM)
+		return;
+
+	for (uint16_t i = 0; i < encoded; i++)
+		for (int bit = 0; bit < 8; bit++)
+			if (drand48() < ber)
+				f->bytes[i] ^= (1 << bit);
+
+	air_time = (long)(encoded * 8 * 1000.0 / air_rate + 0.999);
+	ch->busy_until =	now + air_time;
+	f->arrival =		ch->busy_until + latency;
+	f->size =			encoded;
+	ch->count++;
+}
+
+/**
+ * Name         : channel_receive
+ *
+ * Synopsis     : static int channel_receive (sim_channel_t *ch, long now, uint8_t *dst, uint16_t dst_size)
+ *
+ * Description  : Decode the next frame that arrived by now
+ *
+ * \return		Decoded size, 0 if the frame was corrupted, -1 if nothing arrived by now
+ */
+static int channel_receive (sim_channel_t *ch, long now, uint8_t *dst, uint16_t dst_size)
+{
+	vcp_ptrbuffer	vcp;
+	uint8_t			status = VCP_IDLE;
+
+	if (ch->count == 0 || ch->air[0].arrival > now)
+		return -1;
+
+	vcpptr_init(&vcp, dst, dst_size);
+	for (uint16_t i = 0; i < ch->air[0].size && status != VCP_TERM; i++)
+	{
+		status = Receive_VCP_byte(&vcp, ch->air[0].bytes[i]);
+		if (status >= VCP_OVR_ERR && status <= VCP_ESC_ERR)
+			break;
+	}
+
+	ch->count--;
+	memmove(&ch->air[0], &ch->air[1], ch->count * sizeof(sim_frame_t));
+
+	return (status == VCP_TERM) ? vcp.index : 0;
+}
+
+/**
+ * Name         : run_arq
+ *
+ * Synopsis     : static double run_arq (arq_t *sat, arq_t *ground, long *out_of_order)
+ *
+ * Description  : Saturated downlink through the ARQ, status frames on the uplink.
+ *				  Checks that the payloads come out complete and in order.
+ *
+ * \return		Goodput, payload bits per second
+ */
+static double run_arq (arq_t *sat, arq_t *ground, long *out_of_order)
+{
+	sim_channel_t	down, up;
+	uint8_t			payload[ARQ_MAX_PAYLOAD];
+	uint8_t			rx[SIM_FRAME_BUFF];
+	uint32_t		sent_counter = 0, expected_counter = 0;
+	double			delivered = 0;
+
+	memset(&down, 0, sizeof(down));
+	memset(&up, 0, sizeof(up));
+	arq_init(sat);
+	arq_init(ground);
+	*out_of_order = 0;
+
+	for (long now = 0; now < duration * 1000; now++)
+	{
+		uint8_t *	frame;
+		uint16_t	size;
+		int			n;
+
+		// Keep the satellite window full
+		while (arq_tx_space(sat))
+		{
+			memset(payload, 0xA5, sizeof(payload));
+			memcpy(payload, &sent_counter, sizeof(sent_counter));
+			arq_send(sat, payload, sizeof(payload), 0);
+			sent_counter++;
+		}
+
+		if (down.busy_until <= now && (size = arq_tx_poll(sat, (uint16_t)now, &frame)))
+			channel_send(&down, now, frame, size);
+		if (up.busy_until <= now && (size = arq_tx_poll(ground, (uint16_t)now, &frame)))
+			channel_send(&up, now, frame, size);
+
+		while ((n = channel_receive(&down, now, rx, sizeof(rx))) >= 0)
+			if (n > 0)
+				arq_receive(ground, (uint16_t)now, rx, n);
+		while ((n = channel_receive(&up, now, rx, sizeof(rx))) >= 0)
+			if (n > 0)
+				arq_receive(sat, (uint16_t)now, rx, n);
+
+		while ((size = arq_deliver(ground, &frame, NULL)))
+		{
+			uint32_t counter;
+			memcpy(&counter, frame, sizeof(counter));
+			if (counter != expected_counter)
+				(*out_of_order)++;
+			expected_counter = counter + 1;
+			delivered += size;
+			arq_deliver_done(ground);
+		}
+	}
+
+	return delivered * 8 / duration;
+}
+
+/**
+ * Name         : run_plain
+ *
+ * Synopsis     : static double run_plain (void)
+ *
+ * Description  : Saturated downlink of plain VCP frames with the same payload, no ARQ
+ *
+ * \return		Goodput, payload bits per second
+ */
+static double run_plain (void)
+{
+	sim_channel_t	down;
+	uint8_t			payload[ARQ_HEADER_SIZE + ARQ_MAX_PAYLOAD + ARQ_CRC_SPACE];
+	uint8_t			rx[SIM_FRAME_BUFF];
+	double			delivered = 0;
+
+	memset(&down, 0, sizeof(down));
+	memset(payload, 0xA5, sizeof(payload));
+
+	for (long now = 0; now < duration * 1000; now++)
+	{
+		int n;
+
+		if (down.busy_until <= now)
+			channel_send(&down, now, payload, ARQ_MAX_PAYLOAD);
+		while ((n = channel_receive(&down, now, rx, sizeof(rx))) >= 0)
+			delivered += n;
+	}
+
+	return delivered * 8 / duration;
+}
+
+int main (int argc, char **argv)
+{
+	static arq_t	sat, ground;
+	const char *	default_ber[] = { "0", "1e-5", "1e-4", "3e-4", "1e-3" };
+	const char **	bers = default_ber;
+	int				nbers = 5;
+	long			seed = 1;
+	int				opt;
+
+	while ((opt = getopt(argc, argv, "r:l:t:s:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'r':	air_rate =	atof(optarg);	break;
+			case 'l':	latency =	atol(optarg);	break;
+			case 't':	duration =	atol(optarg);	break;
+			case 's':	seed =		atol(optarg);	break;
+			default:
+				fprintf(stderr, "usage: %s [-r air rate bps] [-l latency ms] [-t seconds] [-s seed] [BER ...]\n", argv[0]);
+				return 1;
+		}
+	}
+	if (optind < argc)
+	{
+		bers =	(const char **)&argv[optind];
+		nbers =	argc - optind;
+	}
+
+	printf("# air rate %.0f bps, latency %ld ms, %ld s, window %d, payload %d, rto %d ms\n",
+		   air_rate, latency, duration, ARQ_WINDOW, ARQ_MAX_PAYLOAD, ARQ_RTO_MS);
+	printf("%-8s %12s %12s %10s %10s %10s %8s\n",
+		   "ber", "plain_bps", "arq_bps", "arq/plain", "retx", "given_up", "gaps");
+
+	for (int i = 0; i < nbers; i++)
+	{
+		double	plain, arq;
+		long	out_of_order;
+
+		ber = atof(bers[i]);
+		srand48(seed);
+		plain =	run_plain();
+		srand48(seed);
+		arq =	run_arq(&sat, &ground, &out_of_order);
+
+		printf("%-8s %12.0f %12.0f %9.2fx %10u %10u %8ld\n", bers[i], plain, arq,
+			   plain > 0 ? arq / plain : 0, sat.tx_retransmits, sat.tx_given_up, out_of_order);
+	}
+
+	return 0;
+}
@@ -0,0 +1,243 @@
+/** \file
+ * bridge_posix.c
+ * \brief Radio IB bridge as a Linux process - board bring-up for the POSIX HAL
+ *
+ *	See bridge_posix.h.
+ */
+
+#include <time.h>
+#include <asf.h>
+
+#include "bridge_posix.h"
+#include "config/conf_board.h"
+#include "config/conf_usart_serial.h"
+#include "memory/memory.h"
+#include "memory/ram_monitor.h"
+#include "memory/stats_journal.h"
+#include "memory/warm_start.h"
+#include "debug/dlog.h"
+#include "debug/rx_capture.h"
+#include "debug/self_bench.h"
+#include "scheduler/scheduler.h"
+#include "tasks/flow_control.h"
+#include "tasks/radio_control.h"
+
+volatile uint16_t	mSeconds;							///< mSeconds counter
+volatile uint16_t	mTicks;								///< Free running milliseconds tick
+volatile Bool		xosc_recovey;						///< Always false - no external oscillator
+
+static FILE *		capture_file;						///< bridge_posix_capture(), NULL when not capturing
+static int64_t		capture_ticks;						///< Time of the last capture record, in capture ticks
+
+/**
+ * Name         : capture_byte
+ *
+ * Synopsis     : static void capture_byte (uint8_t link, uint8_t byte)
+ *
+ * \param	link	VCP address of the receiving peripheral
+ * \param	byte	Received byte
+ *
+ * Description  : Write a capture record, time from CLOCK_MONOTONIC. The interrupt thread reads
+ *				  the UARTs in chunks, so the bytes of a chunk share the time of the chunk
+ */
+static void capture_byte (uint8_t link, uint8_t byte)
+{
+	struct timespec	now;
+	int64_t			ticks, delta;
+
+	if (!capture_file)
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ticks = ((int64_t)now.tv_sec * 1000000000 + now.tv_nsec) / RX_CAPTURE_TICK_NS;
+	delta = capture_ticks ? ticks - capture_ticks : 0;
+	capture_ticks = ticks;
+
+	for (; delta > 0xFFFF; delta -= 0xFFFF)
+	{
+		fputc(RX_CAPTURE_TIME, capture_file);	fputc(0, capture_file);
+		fputc(0xFF, capture_file);				fputc(0xFF, capture_file);
+	}
+	fputc(link, capture_file);					fputc(byte, capture_file);
+	fputc(delta & 0xFF, capture_file);			fputc(delta >> 8, capture_file);
+}
+
+/******************************************/
+/* Interrupt handlers, as in isr.c        */
+/******************************************/
+
+/// Timer 1KHz interrupt handler
+static void tick_vector (void)
+{
+	mSeconds++;
+	mTicks++;
+
+	if (capture_file && !(mTicks % 100))
+		fflush(capture_file);							// Keep the capture on disk when the process is killed
+
+	if (mSeconds >= 999)
+		mSeconds = 0;
+}
+
+/// Radio external event (PD7) edge
+static void capture_vector (void)
+{
+	radio_control_edge();
+}
+
+/// Radio USART Receive interrupt handler
+static void radio_rx_vector (void)
+{
+	capture_byte(radio.VCP_address, hal_uart_read(&RADIO_UART));
+	peripheral_receive(&radio);
+}
+
+/// CDHIB USART Receive interrupt handler
+static void cdhib_rx_vector (void)
+{
+	capture_byte(cdhib.VCP_address, hal_uart_read(&CDHIB_UART));
+	peripheral_receive(&cdhib);
+}
+
+/**
+ * Name         : bridge_posix_init
+ *
+ * Synopsis     : void bridge_posix_init (int radio_fd, int cdhib_fd, int debug_fd, uint32_t baudrate)
+ *
+ * \param	radio_fd	Radio UART file descriptor (pseudo-terminal or socketpair), -1 for none
+ * \param	cdhib_fd	CDHIB UART file descriptor, -1 for none
+ * \param	debug_fd	Debug log UART file descriptor (transmit only), -1 to drop the log
+ * \param	baudrate	Receive rate limit of the radio and CDHIB UARTs, 0 for none (host speed)
+ *
+ * Description  : board_init() for the host - the same phases, without the clock, the warm start
+ *				  and the EEPROM journal. The interrupts start with bridge_posix_run().
+ */
+void bridge_posix_init (int radio_fd, int cdhib_fd, int debug_fd, uint32_t baudrate)
+{
+	xosc_recovey = false;
+
+	hal_posix_uart_attach(&RADIO_UART, radio_fd, radio_rx_vector, baudrate);
+	hal_posix_uart_attach(&CDHIB_UART, cdhib_fd, cdhib_rx_vector, baudrate);
+	hal_posix_uart_attach(&DEBUG_UART, debug_fd, NULL, 0);
+
+	// Phase 1 - receive path
+	memory_init();
+
+	// Phase 2 - everything else
+	radio_link_init();
+	dma_init();
+	dlog_init();
+	flow_control_init();
+	radio_control_init();
+
+	dlog_b(DLOG_BOOT, 0);
+}
+
+/**
+ * Name         : bridge_posix_capture
+ *
+ * Synopsis     : void bridge_posix_capture (FILE *file)
+ *
+ * \param	file	Capture file, open for writing. NULL to stop
+ *
+ * Description  : Record the bytes received from the radio and the CDHIB (rx_capture.h)
+ */
+void bridge_posix_capture (FILE *file)
+{
+	static const uint8_t	header[RX_CAPTURE_HEADER_SIZE] =
+		{ 'R', 'X', 'C', 'P', RX_CAPTURE_VERSION, 0, RX_CAPTURE_TICK_NS & 0xFF, RX_CAPTURE_TICK_NS >> 8 };
+
+	HAL_CRITICAL
+	{
+		if (file)
+			fwrite(header, 1, sizeof(header), file);
+		capture_ticks =	0;
+		capture_file =	file;
+	}
+}
+
+/**
+ * Name         : bridge_posix_start
+ *
+ * Synopsis     : void bridge_posix_start (void)
+ *
+ * Description  : Start the interrupts. For programs that run the scheduler themselves (scheduler_pass())
+ */
+void bridge_posix_start (void)
+{
+	hal_posix_start(tick_vector, capture_vector);
+}
+
+/**
+ * Name         : bridge_posix_run
+ *
+ * Synopsis     : void bridge_posix_run (void)
+ *
+ * Description  : Start the interrupts and run the firmware scheduler, never returns
+ */
+void bridge_posix_run (void)
+{
+	bridge_posix_start();
+	scheduler();
+}
+
+/******************************************/
+/* Stand-ins for the XMEGA only services  */
+/******************************************/
+
+void switch_to_ext_osc (void)
+{
+	xosc_recovey = false;
+}
+
+void ram_monitor_update (void)
+{
+}
+
+uint8_t ram_monitor_telemetry (uint8_t *dst)
+{
+	memset(dst, 0, RAM_TELEMETRY_SIZE);
+	return RAM_TELEMETRY_SIZE;
+}
+
+void stats_journal_update (void)
+{
+}
+
+void stats_journal_commit (void)
+{
+}
+
+uint8_t stats_journal_telemetry (uint8_t *dst)
+{
+	memset(dst, 0, STATS_JOURNAL_SIZE);
+	return STATS_JOURNAL_SIZE;
+}
+
+void warm_start_seal (void)
+{
+}
+
+uint8_t warm_start_telemetry (uint8_t *dst)
+{
+	memset(dst, 0, WARM_START_SIZE);
+	return WARM_START_SIZE;
+}
+
+Bool self_bench_start (void)
+{
+	return true;
+}
+
+void self_bench_step (uint8_t step)
+{
+}
+
+void self_bench_stop (void)
+{
+}
+
+uint8_t self_bench_telemetry (uint8_t *dst)
+{
+	memset(dst, 0, SELF_BENCH_SIZE);
+	return SELF_BENCH_SIZE;
+}
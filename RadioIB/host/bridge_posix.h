@@ -0,0 +1,28 @@
+/** \file
+ * bridge_posix.h
+ * \brief Radio IB bridge as a Linux process - board bring-up for the POSIX HAL
+ *
+ *	The firmware scheduler, tasks, commands, memory, radio link and VCP code, built with
+ *	HAL_POSIX (see ../RadioIB/src/hal/hal_posix.h). This file stands in for init.c and isr.c.
+ *
+ *	Not modelled on the host - the stand-ins report zeros:
+ * *	RAM monitor (no stack paint), warm start (always cold), EEPROM statistics journal,
+ *		self-benchmark (no cycle timer)
+ * *	Clock - there is no external oscillator, the PLL switch is a no-op
+ *
+ *	bridge_posix_capture() records the received bytes in the capture format of
+ *	../RadioIB/src/debug/rx_capture.h, for host/rx_replay.
+ */
+
+#ifndef BRIDGE_POSIX_H_
+#define BRIDGE_POSIX_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+void	bridge_posix_init		(int radio_fd, int cdhib_fd, int debug_fd, uint32_t baudrate);
+void	bridge_posix_capture	(FILE *file);
+void	bridge_posix_start		(void);
+void	bridge_posix_run		(void);
+
+#endif /* BRIDGE_POSIX_H_ */
@@ -0,0 +1,317 @@
+/** \file
+ * crc16_host.c
+ * \brief Bulk VCP CRC for the host tools
+ *
+ *	See crc16_host.h. The tables and the folding constants are built from append_crc16() on the
+ *	first call.
+ *
+ *	Folding works on the message as a polynomial, bit 0 of the first byte the highest power
+ *	(reflected). A 128-bit block X followed by 128 more bits is X * x^128 + next; X * x^128 is
+ *	replaced by a value with the same remainder mod P - the 64-bit halves of X carry-less
+ *	multiplied by x^192 mod P and x^128 mod P. The CRC of the whole message is then the table CRC
+ *	of the last 16 folded bytes. A carry-less multiply of reflected values comes out one bit up
+ *	(multiplied by x), so the constants are x^(n - 1) mod P.
+ */
+
+#include "crc16_host.h"
+#include "crclib.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define CRC16_HOST_X86
+#endif
+
+#define CRC16_POLY			0x11021		///< P, x^16 + x^12 + x^5 + 1 - 0x8408 reflected
+
+static uint16_t		crc_table[8][256];		///< Slice-by-8 tables, [0] is the crclib.c table
+static uint64_t		fold_512[2];			///< x^(512 + 63), x^(512 - 1) mod P, reflected
+static uint64_t		fold_128[2];			///< x^(128 + 63), x^(128 - 1) mod P, reflected
+static int			crc_ready;				///< Tables and constants built
+
+static const char *	engine_names[CRC16_HOST_ENGINES] = { "auto", "table", "slice8", "clmul" };
+
+/**
+ * Name         : fold_constant
+ *
+ * Synopsis     : static uint64_t fold_constant (unsigned n)
+ *
+ * \return			x^n mod P, reflected in 64 bits - x^d in bit 63 - d
+ */
+static uint64_t fold_constant (unsigned n)
+{
+	uint32_t	r = 1;
+	uint64_t	k = 0;
+
+	while (n--)
+	{
+		r <<= 1;
+		if (r & 0x10000)
+			r ^= CRC16_POLY;
+	}
+	for (int d = 0; d < 16; d++)
+		if (r & (1u << d))
+			k |= (uint64_t)1 << (63 - d);
+	return k;
+}
+
+/**
+ * Name         : crc_init
+ *
+ * Synopsis     : static void crc_init (void)
+ *
+ * Description  : Build the tables - crc_table[k][x] is the CRC of x followed by k zero bytes -
+ *				  and the folding constants
+ */
+static void crc_init (void)
+{
+	if (crc_ready)
+		return;
+
+	for (int x = 0; x < 256; x++)
+	{
+		uint16	crc = CRC16_INIT_VALUE;
+
+		append_crc16((uint8)x, &crc);
+		crc_table[0][x] = crc;
+	}
+	for (int k = 1; k < 8; k++)
+		for (int x = 0; x < 256; x++)
+			crc_table[k][x] = (crc_table[k - 1][x] >> 8) ^ crc_table[0][crc_table[k - 1][x] & 0xFF];
+
+	fold_512[0] = fold_constant(512 + 63);
+	fold_512[1] = fold_constant(512 - 1);
+	fold_128[0] = fold_constant(128 + 63);
+	fold_128[1] = fold_constant(128 - 1);
+	crc_ready = 1;
+}
+
+
+/*****************/
+/* Engines       */
+/*****************/
+
+/**
+ * Name         : crc_table_bytes
+ *
+ * Synopsis     : static uint16_t crc_table_bytes (uint16_t crc, const uint8_t *data, size_t size)
+ *
+ * Description  : A byte at a time - the crc16() loop of crclib.c
+ */
+static uint16_t crc_table_bytes (uint16_t crc, const uint8_t *data, size_t size)
+{
+	while (size--)
+		crc = (crc >> 8) ^ crc_table[0][(crc ^ *data++) & 0xFF];
+	return crc;
+}
+
+/**
+ * Name         : crc_slice8
+ *
+ * Synopsis     : static uint16_t crc_slice8 (uint16_t crc, const uint8_t *data, size_t size)
+ *
+ * Description  : 8 bytes at a time. The CRC goes into the first 2 bytes, the other 6 only
+ *				  need the table for their distance to the end of the step
+ */
+static uint16_t crc_slice8 (uint16_t crc, const uint8_t *data, size_t size)
+{
+	for (; size >= 8; size -= 8, data += 8)
+	{
+		uint16_t	x = crc ^ (data[0] | (data[1] << 8));
+
+		crc =	crc_table[7][x & 0xFF] ^ crc_table[6][x >> 8] ^
+				crc_table[5][data[2]] ^ crc_table[4][data[3]] ^ crc_table[3][data[4]] ^
+				crc_table[2][data[5]] ^ crc_table[1][data[6]] ^ crc_table[0][data[7]];
+	}
+	return crc_table_bytes(crc, data, size);
+}
+
+#ifdef CRC16_HOST_X86
+
+/**
+ * Name         : fold
+ *
+ * Synopsis     : static inline __m128i fold (__m128i x, __m128i k, __m128i next)
+ *
+ * \param	k		Low qword - constant for the first (low) half of x, high qword - for the second half
+ *
+ * \return			x moved on by the fold distance, added to next
+ */
+__attribute__((target("sse2,pclmul")))
+static inline __m128i fold (__m128i x, __m128i k, __m128i next)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), next);
+}
+
+/**
+ * Name         : crc_clmul
+ *
+ * Synopsis     : static uint16_t crc_clmul (uint16_t crc, const uint8_t *data, size_t size)
+ *
+ * Description  : Fold 4 blocks of 16 bytes at a time down to one block, then a block at a time.
+ *				  The table CRC of the folded block, and the last bytes by slice8
+ */
+__attribute__((target("sse2,pclmul")))
+static uint16_t crc_clmul (uint16_t crc, const uint8_t *data, size_t size)
+{
+	const __m128i	k512 = _mm_set_epi64x((long long)fold_512[1], (long long)fold_512[0]);
+	const __m128i	k128 = _mm_set_epi64x((long long)fold_128[1], (long long)fold_128[0]);
+	__m128i			x0, x1, x2, x3;
+	uint8_t			block[16];
+
+	if (size < 64)
+		return crc_slice8(crc, data, size);
+
+	// The CRC so far goes into the first 2 bytes
+	x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)data), _mm_cvtsi32_si128(crc));
+	x1 = _mm_loadu_si128((const __m128i *)(data + 16));
+	x2 = _mm_loadu_si128((const __m128i *)(data + 32));
+	x3 = _mm_loadu_si128((const __m128i *)(data + 48));
+	data += 64;
+	size -= 64;
+
+	for (; size >= 64; size -= 64, data += 64)
+	{
+		x0 = fold(x0, k512, _mm_loadu_si128((const __m128i *)data));
+		x1 = fold(x1, k512, _mm_loadu_si128((const __m128i *)(data + 16)));
+		x2 = fold(x2, k512, _mm_loadu_si128((const __m128i *)(data + 32)));
+		x3 = fold(x3, k512, _mm_loadu_si128((const __m128i *)(data + 48)));
+	}
+
+	x0 = fold(x0, k128, x1);
+	x0 = fold(x0, k128, x2);
+	x0 = fold(x0, k128, x3);
+	for (; size >= 16; size -= 16, data += 16)
+		x0 = fold(x0, k128, _mm_loadu_si128((const __m128i *)data));
+
+	_mm_storeu_si128((__m128i *)block, x0);
+	return crc_slice8(crc_slice8(CRC16_INIT_VALUE, block, sizeof(block)), data, size);
+}
+
+#endif
+
+
+/*****************/
+/* Interface     */
+/*****************/
+
+/**
+ * Name         : crc16_host_engine
+ *
+ * Synopsis     : uint8_t crc16_host_engine (uint8_t engine)
+ *
+ * \param	engine	CRC16_HOST_AUTO, CRC16_HOST_TABLE...
+ *
+ * \return			The engine that runs - the fastest one for CRC16_HOST_AUTO, 0 if this CPU does not have it
+ */
+uint8_t crc16_host_engine (uint8_t engine)
+{
+	switch (engine)
+	{
+		case CRC16_HOST_AUTO:
+			return crc16_host_engine(CRC16_HOST_CLMUL) ? CRC16_HOST_CLMUL : CRC16_HOST_SLICE8;
+		case CRC16_HOST_TABLE:
+		case CRC16_HOST_SLICE8:
+			return engine;
+#ifdef CRC16_HOST_X86
+		case CRC16_HOST_CLMUL:
+			return (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse2")) ? engine : 0;
+#endif
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Name         : crc16_host_engine_name
+ *
+ * Synopsis     : const char *crc16_host_engine_name (uint8_t engine)
+ *
+ * \return			Engine name, "auto", "table"... NULL past the last engine
+ */
+const char *crc16_host_engine_name (uint8_t engine)
+{
+	return (engine < CRC16_HOST_ENGINES) ? engine_names[engine] : NULL;
+}
+
+/**
+ * Name         : crc16_host
+ *
+ * Synopsis     : uint16_t crc16_host (uint8_t engine, uint16_t crc, const uint8_t *data, size_t size)
+ *
+ * \param	engine	CRC16_HOST_AUTO, CRC16_HOST_TABLE... - slice8 if this CPU does not have it
+ * \param	crc		CRC so far, CRC16_INIT_VALUE to start
+ *
+ * \return			The CRC after data, as append_crc16() a byte at a time
+ */
+uint16_t crc16_host (uint8_t engine, uint16_t crc, const uint8_t *data, size_t size)
+{
+	static uint8_t	auto_engine;
+
+	crc_init();
+	if (engine == CRC16_HOST_AUTO)
+	{
+		if (!auto_engine)
+			auto_engine = crc16_host_engine(CRC16_HOST_AUTO);
+		engine = auto_engine;
+	}
+
+	switch (engine)
+	{
+		case CRC16_HOST_TABLE:
+			return crc_table_bytes(crc, data, size);
+#ifdef CRC16_HOST_X86
+		case CRC16_HOST_CLMUL:
+			if (crc16_host_engine(CRC16_HOST_CLMUL))
+				return crc_clmul(crc, data, size);
+			return crc_slice8(crc, data, size);
+#endif
+		default:
+			return crc_slice8(crc, data, size);
+	}
+}
+
+/**
+ * Name         : multiply_mod
+ *
+ * Synopsis     : static uint16_t multiply_mod (uint16_t a, uint16_t b)
+ *
+ * \return			a * b mod P, reflected - x^0 in bit 15
+ */
+static uint16_t multiply_mod (uint16_t a, uint16_t b)
+{
+	uint16_t	product = 0;
+
+	for (uint16_t m = 0x8000; m; m >>= 1)
+	{
+		if (a & m)
+			product ^= b;
+		b = (b & 1) ? (b >> 1) ^ 0x8408 : b >> 1;		// b * x
+	}
+	return product;
+}
+
+/**
+ * Name         : crc16_host_combine
+ *
+ * Synopsis     : uint16_t crc16_host_combine (uint16_t crc_a, uint16_t crc_b, uint64_t size_b)
+ *
+ * \param	crc_a	CRC of the first part, from any starting value
+ * \param	crc_b	CRC of the second part, from CRC16_INIT_VALUE
+ * \param	size_b	Size of the second part in bytes
+ *
+ * Description  : crc_a moved on by size_b zero bytes - crc_a * x^(8 size_b) mod P, by squaring
+ *
+ * \return			The CRC of both parts, as if the second part was run from crc_a
+ */
+uint16_t crc16_host_combine (uint16_t crc_a, uint16_t crc_b, uint64_t size_b)
+{
+	uint16_t	power = 0x0080;		// x^8, a byte
+
+	for (; size_b; size_b >>= 1)
+	{
+		if (size_b & 1)
+			crc_a = multiply_mod(power, crc_a);
+		power = multiply_mod(power, power);
+	}
+	return crc_a ^ crc_b;
+}
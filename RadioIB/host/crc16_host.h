@@ -0,0 +1,35 @@
+/** \file
+ * crc16_host.h
+ * \brief Bulk VCP CRC for the host tools
+ *
+ *	The VCP CRC of crclib.c (CCITT, reflected polynomial 0x8408, append_crc16()) for large
+ *	buffers, with the same results:
+ * *	table -		the crclib.c table, a byte per step
+ * *	slice8 -	8 tables, 8 bytes per step
+ * *	clmul -		carry-less multiply (x86 PCLMULQDQ) folding of 64 bytes per step, on the CPUs
+ *				that have it. Short buffers and the last bytes go to slice8
+ *	The CRC has no final XOR, so the CRC of a buffer is the CRC of its parts, moved on by the
+ *	sizes that follow them - crc16_host_combine(). Parts can be checked by different threads.
+ */
+
+
+#ifndef CRC16_HOST_H_
+#define CRC16_HOST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Engines
+#define CRC16_HOST_AUTO		0		///< The fastest engine this CPU has
+#define CRC16_HOST_TABLE	1		///< A byte at a time, as crclib.c
+#define CRC16_HOST_SLICE8	2		///< 8 bytes at a time
+#define CRC16_HOST_CLMUL	3		///< 64 bytes at a time, x86 with PCLMULQDQ
+#define CRC16_HOST_ENGINES	4
+
+// Functions
+uint8_t		crc16_host_engine		(uint8_t engine);
+const char *crc16_host_engine_name	(uint8_t engine);
+uint16_t	crc16_host				(uint8_t engine, uint16_t crc, const uint8_t *data, size_t size);
+uint16_t	crc16_host_combine		(uint16_t crc_a, uint16_t crc_b, uint64_t size_b);
+
+#endif /* CRC16_HOST_H_ */
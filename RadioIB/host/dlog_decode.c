@@ -0,0 +1,256 @@
+/** \file
+ * dlog_decode.c
+ * \brief Host decoder for the Radio IB binary debug log
+ *
+ *	Reads the raw byte stream of the debug USART (file, serial device or stdin)
+ *	and prints one formatted line per log record.
+ *	The message table is compiled in from the firmware dlog_ids.h.
+ *
+ *	Usage: dlog_decode [-x rx capture] [log file or serial device]
+ *		-x	write the DLOG_RX_CAPTURE records to a capture file for rx_replay (rx_capture.h)
+ *			instead of printing them. The log has 16 bit tick times - gaps of more than
+ *			0.5 s come out shorter
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rx_capture.h"
+
+#define DLOG_SYNC		0xA5		///< Must match dlog.h
+#define DLOG_MAX_ARGS	8			///< Max arguments per message
+
+/// Message table entry
+typedef struct {
+	const char *	name;			///< Id name
+	const char *	args;			///< Argument layout
+	const char *	format;			///< printf format
+} dlog_msg_t;
+
+static const dlog_msg_t dlog_table[] = {
+	#define DLOG_MSG(id, args, format)	{ #id, args, format },
+	#include "dlog_ids.h"
+	#undef DLOG_MSG
+};
+
+#define DLOG_ID_COUNT	(sizeof(dlog_table) / sizeof(dlog_table[0]))
+
+/// Message ids, as in dlog.h
+enum {
+	#define DLOG_MSG(id, args, format)	id,
+	#include "dlog_ids.h"
+	#undef DLOG_MSG
+};
+
+static FILE *		capture;				///< -x capture file, NULL for none
+static int			capture_started;		///< A capture record was written
+static uint16_t		capture_ticks;			///< Tick time of the last capture record
+
+/**
+ * Name         : capture_write
+ *
+ * Synopsis     : static void capture_write (uint8_t link, uint8_t byte, uint16_t delta)
+ *
+ * Description  : Write one capture record
+ */
+static void capture_write (uint8_t link, uint8_t byte, uint16_t delta)
+{
+	uint8_t	record[RX_CAPTURE_RECORD_SIZE] = { link, byte, delta & 0xFF, delta >> 8 };
+
+	fwrite(record, 1, sizeof(record), capture);
+}
+
+/**
+ * Name         : capture_record
+ *
+ * Synopsis     : static int capture_record (int id, const uint32_t *values)
+ *
+ * \param	id		Message id
+ * \param	values	Decoded argument values
+ *
+ * Description  : Turn DLOG_RX_CAPTURE and DLOG_RX_CAPTURE_LOST into capture records
+ *
+ * \return			1 if the record went to the capture file, 0 to print it
+ */
+static int capture_record (int id, const uint32_t *values)
+{
+	uint16_t	ticks;
+
+	if (!capture)
+		return 0;
+	switch (id)
+	{
+		case DLOG_RX_CAPTURE:
+			ticks = (uint16_t)values[2];
+			capture_write((uint8_t)values[0], (uint8_t)values[1], capture_started ? (uint16_t)(ticks - capture_ticks) : 0);
+			capture_ticks =		ticks;
+			capture_started =	1;
+			return 1;
+		case DLOG_RX_CAPTURE_LOST:
+			capture_write(RX_CAPTURE_LOST, (uint8_t)values[0], 0);
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Name         : arg_size
+ *
+ * Synopsis     : static int arg_size (char type)
+ *
+ * \param	type	Argument layout character
+ *
+ * Description  : Size in bytes of one argument
+ *
+ * \return			Size in bytes, 0 for an unknown layout character
+ */
+static int arg_size (char type)
+{
+	switch (type)
+	{
+		case 'b':	return 1;
+		case 'w':	return 2;
+		case 'd':	return 4;
+		default:	return 0;
+	}
+}
+
+/**
+ * Name         : print_record
+ *
+ * Synopsis     : static void print_record (FILE *out, const dlog_msg_t *msg, const uint32_t *values)
+ *
+ * \param	out		Output stream
+ * \param	msg		Message table entry
+ * \param	values	Decoded argument values
+ *
+ * Description  : Expand the format string one conversion at a time, so any printf
+ *				  integer conversion can be used in dlog_ids.h
+ */
+static void print_record (FILE *out, const dlog_msg_t *msg, const uint32_t *values)
+{
+	const char *	p = msg->format;
+	char			spec[16];
+	int				arg = 0;
+
+	fprintf(out, "%-20s ", msg->name);
+	while (*p)
+	{
+		if (*p != '%')
+		{
+			fputc(*p++, out);
+			continue;
+		}
+		if (p[1] == '%')
+		{
+			fputc('%', out);
+			p += 2;
+			continue;
+		}
+
+		// Copy the conversion spec up to and including the conversion character
+		size_t n = 0;
+		do
+		{
+			spec[n++] = *p++;
+		} while (*p && n < sizeof(spec) - 1 && !strchr("diouxXc", p[-1]));
+		spec[n] = '\0';
+
+		if (arg < DLOG_MAX_ARGS)
+			fprintf(out, spec, (unsigned int)values[arg++]);
+	}
+	fputc('\n', out);
+}
+
+int main (int argc, char **argv)
+{
+	FILE *		in = stdin;
+	uint32_t	values[DLOG_MAX_ARGS];
+	unsigned	resync = 0;
+	int			c;
+
+	while ((c = getopt(argc, argv, "x:")) != -1)
+	{
+		switch (c)
+		{
+			case 'x':
+				if ((capture = fopen(optarg, "wb")) == NULL)
+				{
+					perror(optarg);
+					return 1;
+				}
+				break;
+			default:
+				fprintf(stderr, "usage: %s [-x rx capture] [log file or serial device]\n", argv[0]);
+				return 2;
+		}
+	}
+	if (capture)
+	{
+		static const uint8_t	header[RX_CAPTURE_HEADER_SIZE] =
+			{ 'R', 'X', 'C', 'P', RX_CAPTURE_VERSION, 0, RX_CAPTURE_TICK_NS & 0xFF, RX_CAPTURE_TICK_NS >> 8 };
+		fwrite(header, 1, sizeof(header), capture);
+	}
+
+	if (optind < argc && (in = fopen(argv[optind], "rb")) == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	while ((c = fgetc(in)) != EOF)
+	{
+		if (c != DLOG_SYNC)
+		{
+			resync++;
+			continue;
+		}
+
+		int id = fgetc(in);
+		if (id == EOF)
+			break;
+		if ((unsigned)id >= DLOG_ID_COUNT)
+		{
+			resync++;
+			continue;
+		}
+
+		const dlog_msg_t *	msg = &dlog_table[id];
+		int					nargs = 0;
+		int					ok = 1;
+
+		// Arguments are little endian, layout from the table
+		for (const char *a = msg->args; *a && nargs < DLOG_MAX_ARGS && ok; a++)
+		{
+			uint32_t value = 0;
+			for (int i = 0; i < arg_size(*a); i++)
+			{
+				if ((c = fgetc(in)) == EOF)
+				{
+					ok = 0;
+					break;
+				}
+				value |= (uint32_t)c << (8 * i);
+			}
+			values[nargs++] = value;
+		}
+		if (!ok)
+			break;
+
+		if (capture_record(id, values))
+			continue;
+		print_record(stdout, msg, values);
+		fflush(stdout);
+	}
+
+	if (capture)
+		fclose(capture);
+
+	if (resync)
+		fprintf(stderr, "dlog_decode: skipped %u bytes while looking for sync\n", resync);
+
+	return 0;
+}
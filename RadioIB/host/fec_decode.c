@@ -0,0 +1,401 @@
+/** \file
+ * fec_decode.c
+ * \brief Host decoder and benchmark for the radio downlink FEC
+ *
+ *	Decode mode reads the raw byte stream received from the radio (file, serial device
+ *	or stdin), finds the FEC block tags, corrects the blocks (Reed-Solomon, radio/fec.h)
+ *	and writes the block data - the VCP byte stream - to stdout. Pipe it into lzss_tool.
+ *
+ *	Benchmark mode (-b) encodes random frames with the firmware encoder, adds random bit
+ *	errors and prints the frame error rate without and with FEC, and the encoder and
+ *	decoder speed.
+ *
+ *	Usage: fec_decode [capture file or serial device] > stream
+ *	       fec_decode -b [-f frame size] [-n frames] [BER ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fec.h"
+
+#define NN				255				///< Full codeword size
+#define TAG_TOLERANCE	3				///< Bit errors allowed in a tag
+
+static uint8_t	syndrome_mul[FEC_PARITY][256];	///< x * alpha^(FCR + i), for the syndromes
+
+/**
+ * Name         : gf_mul_init
+ *
+ * Synopsis     : static void gf_mul_init (void)
+ *
+ * Description  : Build the syndrome multiplication tables
+ */
+static void gf_mul_init (void)
+{
+	for (int i = 0; i < FEC_PARITY; i++)
+		for (int x = 1; x < 256; x++)
+			syndrome_mul[i][x] = fec_exp[(fec_log[x] + FEC_FCR + i) % NN];
+}
+
+/**
+ * Name         : rs_decode
+ *
+ * Synopsis     : static int rs_decode (uint8_t *block, int n)
+ *
+ * \param	block	Codeword - data then FEC_PARITY parity bytes, corrected in place
+ * \param	n		Codeword size
+ *
+ * Description  : Reed-Solomon decoder. Syndromes, Berlekamp-Massey, Chien search, Forney.
+ *				  Error free blocks (almost all of them) only cost the syndromes.
+ *
+ * \return			Number of corrected bytes, -1 if the block can not be corrected
+ */
+static int rs_decode (uint8_t *block, int n)
+{
+	uint8_t	s[FEC_PARITY];
+	int		lambda[FEC_PARITY + 1], b[FEC_PARITY + 1], t[FEC_PARITY + 1], omega[FEC_PARITY + 1];
+	int		root[FEC_PARITY], loc[FEC_PARITY], reg[FEC_PARITY + 1];
+	int		pad = NN - n;
+	int		syn_error = 0, el = 0, deg_lambda = 0, deg_omega, count = 0;
+	int		i, j, r, k;
+
+	// Syndromes, Horner's rule
+	memset(s, 0, sizeof(s));
+	for (j = 0; j < n; j++)
+		for (i = 0; i < FEC_PARITY; i++)
+			s[i] = syndrome_mul[i][s[i]] ^ block[j];
+
+	for (i = 0; i < FEC_PARITY; i++)
+		syn_error |= s[i];
+	if (!syn_error)
+		return 0;
+
+	// Berlekamp-Massey, polynomials in log form where noted
+	memset(lambda, 0, sizeof(lambda));
+	lambda[0] = 1;
+	for (i = 0; i <= FEC_PARITY; i++)
+		b[i] = fec_log[lambda[i]];
+
+	for (r = 1; r <= FEC_PARITY; r++)
+	{
+		int discr = 0;
+
+		for (i = 0; i < r; i++)
+			if (lambda[i] && s[r - i - 1])
+				discr ^= fec_exp[(fec_log[lambda[i]] + fec_log[s[r - i - 1]]) % NN];
+		discr = fec_log[discr];
+
+		if (discr == FEC_A0)
+		{
+			memmove(&b[1], b, FEC_PARITY * sizeof(b[0]));
+			b[0] = FEC_A0;
+			continue;
+		}
+
+		t[0] = lambda[0];
+		for (i = 0; i < FEC_PARITY; i++)
+			t[i + 1] = (b[i] != FEC_A0) ? lambda[i + 1] ^ fec_exp[(discr + b[i]) % NN] : lambda[i + 1];
+
+		if (2 * el <= r - 1)
+		{
+			el = r - el;
+			for (i = 0; i <= FEC_PARITY; i++)
+				b[i] = lambda[i] ? (fec_log[lambda[i]] - discr + NN) % NN : FEC_A0;
+		}
+		else
+		{
+			memmove(&b[1], b, FEC_PARITY * sizeof(b[0]));
+			b[0] = FEC_A0;
+		}
+		memcpy(lambda, t, sizeof(lambda));
+	}
+
+	for (i = 0; i <= FEC_PARITY; i++)
+	{
+		lambda[i] = fec_log[lambda[i]];
+		if (lambda[i] != FEC_A0)
+			deg_lambda = i;
+	}
+	if (deg_lambda == 0 || deg_lambda > FEC_PARITY / 2)
+		return -1;
+
+	// Chien search for the roots of the error locator
+	memcpy(&reg[1], &lambda[1], FEC_PARITY * sizeof(reg[0]));
+	for (i = 1, k = 0; i <= NN; i++, k = (k + 1) % NN)
+	{
+		int q = 1;
+
+		for (j = deg_lambda; j > 0; j--)
+		{
+			if (reg[j] != FEC_A0)
+			{
+				reg[j] = (reg[j] + j) % NN;
+				q ^= fec_exp[reg[j]];
+			}
+		}
+		if (q != 0)
+			continue;
+
+		root[count] =	i;
+		loc[count] =	k;
+		if (++count == deg_lambda)
+			break;
+	}
+	if (count != deg_lambda)
+		return -1;
+
+	// Error evaluator omega = s * lambda mod x^FEC_PARITY, log form
+	deg_omega = deg_lambda - 1;
+	for (i = 0; i <= deg_omega; i++)
+	{
+		int tmp = 0;
+
+		for (j = i; j >= 0; j--)
+			if (s[i - j] && lambda[j] != FEC_A0)
+				tmp ^= fec_exp[(fec_log[s[i - j]] + lambda[j]) % NN];
+		omega[i] = fec_log[tmp];
+	}
+
+	// Forney - error values
+	for (j = count - 1; j >= 0; j--)
+	{
+		int num1 = 0, num2, den = 0;
+
+		for (i = deg_omega; i >= 0; i--)
+			if (omega[i] != FEC_A0)
+				num1 ^= fec_exp[(omega[i] + i * root[j]) % NN];
+		num2 = fec_exp[(root[j] * (FEC_FCR - 1) + NN) % NN];
+
+		for (i = ((deg_lambda < FEC_PARITY - 1) ? deg_lambda : FEC_PARITY - 1) & ~1; i >= 0; i -= 2)
+			if (lambda[i + 1] != FEC_A0)
+				den ^= fec_exp[(lambda[i + 1] + i * root[j]) % NN];
+
+		if (den == 0 || loc[j] < pad)
+			return -1;		// Error in the shortened (zero) part - not a real codeword
+		if (num1)
+			block[loc[j] - pad] ^= fec_exp[(fec_log[num1] + fec_log[num2] + NN - fec_log[den]) % NN];
+	}
+
+	return count;
+}
+
+/**
+ * Name         : match_tag
+ *
+ * Synopsis     : static int match_tag (const uint8_t *p)
+ *
+ * Description  : Find the block mode of a tag, allowing TAG_TOLERANCE bit errors
+ *
+ * \return			Block mode, -1 if p is not a tag
+ */
+static int match_tag (const uint8_t *p)
+{
+	for (int mode = 0; mode < FEC_MODES; mode++)
+	{
+		int distance = 0;
+
+		for (int i = 0; i < FEC_TAG_SIZE; i++)
+			distance += __builtin_popcount(p[i] ^ fec_tags[mode][i]);
+		if (distance <= TAG_TOLERANCE)
+			return mode;
+	}
+	return -1;
+}
+
+/**
+ * Name         : decode
+ *
+ * Synopsis     : static int decode (FILE *in)
+ *
+ * Description  : Find and decode the FEC blocks in a radio capture, write the data to stdout
+ *
+ * \return		Exit code
+ */
+static int decode (FILE *in)
+{
+	static uint8_t	buff[1 << 16];
+	size_t			have = 0, pos = 0, n;
+	long			blocks = 0, corrected = 0, failed = 0, skipped = 0;
+
+	while ((n = fread(&buff[have], 1, sizeof(buff) - have, in)) > 0 || pos + FEC_TAG_SIZE <= have)
+	{
+		have += n;
+
+		while (pos + FEC_TAG_SIZE <= have)
+		{
+			int mode = match_tag(&buff[pos]);
+			int size;
+
+			if (mode < 0)
+			{
+				pos++;
+				skipped++;
+				continue;
+			}
+
+			size = fec_data_size[mode] + FEC_PARITY;
+			if (pos + FEC_TAG_SIZE + size > have)
+			{
+				if (n > 0)
+					break;			// Read more
+				pos = have;			// Truncated block at the end of the capture
+				failed++;
+				break;
+			}
+
+			blocks++;
+			int result = rs_decode(&buff[pos + FEC_TAG_SIZE], size);
+			if (result < 0)
+			{
+				failed++;
+				pos++;				// Maybe a false tag - keep looking
+				continue;
+			}
+			corrected += result;
+			fwrite(&buff[pos + FEC_TAG_SIZE], 1, fec_data_size[mode], stdout);
+			pos += FEC_TAG_SIZE + size;
+		}
+
+		memmove(buff, &buff[pos], have - pos);
+		have -= pos;
+		pos = 0;
+		if (n == 0)
+			break;
+	}
+
+	fprintf(stderr, "%ld blocks, %ld bytes corrected, %ld failed, %ld bytes outside blocks\n",
+			blocks, corrected, failed, skipped);
+	return 0;
+}
+
+/**
+ * Name         : benchmark
+ *
+ * Synopsis     : static void benchmark (double ber, int frame_size, long frames)
+ *
+ * Description  : Frame error rate over a random bit error channel, without and with FEC
+ */
+static void benchmark (double ber, int frame_size, long frames)
+{
+	static fec_tx_t	tx;
+	static uint8_t	frame[4096], air[8192];
+	long			raw_errors = 0, fec_errors = 0, air_bytes = 0;
+	double			encode_s = 0, decode_s = 0;
+	struct timespec	t0, t1;
+
+	for (long f = 0; f < frames; f++)
+	{
+		size_t	air_size = 0, out = 0;
+		int		raw_error = 0, fec_error = 0;
+		uint16_t size;
+
+		for (int i = 0; i < frame_size; i++)
+			frame[i] = (uint8_t)lrand48();
+
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		fec_tx_start(&tx, frame, frame_size);
+		while ((size = fec_tx_next(&tx)))
+		{
+			memcpy(&air[air_size], tx.block, size);
+			air_size += size;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		encode_s += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+		air_bytes += air_size;
+
+		// Channel - the plain frame sees the same error rate over its own size
+		for (int i = 0; i < frame_size * 8; i++)
+			if (drand48() < ber)
+				raw_error = 1;
+		for (size_t i = 0; i < air_size * 8; i++)
+			if (drand48() < ber)
+				air[i / 8] ^= 1 << (i % 8);
+
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (size_t pos = 0; pos < air_size && !fec_error; )
+		{
+			int mode = match_tag(&air[pos]);
+			int csize;
+
+			if (mode < 0)
+			{
+				fec_error = 1;
+				break;
+			}
+			csize = fec_data_size[mode] + FEC_PARITY;
+			if (rs_decode(&air[pos + FEC_TAG_SIZE], csize) < 0)
+				fec_error = 1;
+			else if (memcmp(&air[pos + FEC_TAG_SIZE], &frame[out], (frame_size - out < (size_t)fec_data_size[mode]) ? frame_size - out : fec_data_size[mode]))
+				fec_error = 1;		// Miscorrected
+			out += fec_data_size[mode];
+			pos += FEC_TAG_SIZE + csize;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		decode_s += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+		raw_errors += raw_error;
+		fec_errors += fec_error;
+	}
+
+	printf("%-8g %10.2e %10.2e %9.2f %10.1f %10.1f\n", ber,
+		   (double)raw_errors / frames, (double)fec_errors / frames,
+		   (double)air_bytes / ((double)frame_size * frames),
+		   encode_s * 1e9 / ((double)frame_size * frames), 
+		   (double)air_bytes / decode_s / 1e6);
+}
+
+int main (int argc, char **argv)
+{
+	const char *	default_ber[] = { "1e-4", "1e-3", "3e-3", "1e-2" };
+	int				bench = 0, frame_size = 130, opt;
+	long			frames = 20000;
+	FILE *			in = stdin;
+
+	while ((opt = getopt(argc, argv, "bf:n:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':	bench = 1;					break;
+			case 'f':	frame_size = atoi(optarg);	break;
+			case 'n':	frames = atol(optarg);		break;
+			default:
+				fprintf(stderr, "usage: %s [capture] > stream\n       %s -b [-f frame size] [-n frames] [BER ...]\n", argv[0], argv[0]);
+				return 1;
+		}
+	}
+
+	gf_mul_init();
+
+	if (bench)
+	{
+		if (frame_size < 1 || frame_size > 4096)
+		{
+			fprintf(stderr, "frame size must be 1 to 4096\n");
+			return 1;
+		}
+		srand48(1);
+		printf("# %d byte frames, %ld frames per BER\n", frame_size, frames);
+		printf("%-8s %10s %10s %9s %10s %10s\n", "ber", "fer_plain", "fer_fec", "overhead", "enc_ns/B", "dec_MB/s");
+		if (optind < argc)
+			for (int i = optind; i < argc; i++)
+				benchmark(atof(argv[i]), frame_size, frames);
+		else
+			for (int i = 0; i < 4; i++)
+				benchmark(atof(default_ber[i]), frame_size, frames);
+		return 0;
+	}
+
+	if (optind < argc && (in = fopen(argv[optind], "rb")) == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+	decode(in);
+	if (in != stdin)
+		fclose(in);
+	return 0;
+}
@@ -0,0 +1,568 @@
+/** \file
+ * frame_archive.c
+ * \brief Converts captures to an indexed frame archive, and queries it by time and address
+ *
+ *	Write mode (-w) decodes captures with Receive_VCP_byte() and appends the frames - good ones
+ *	and ones with CRC errors - to an archive (vcp_archive.h), in segments of -n frames with an
+ *	index entry every -x frames. A capture is either a receive capture (rx_capture.h, from
+ *	radioib_posix -w or dlog_decode -x) - every link decoded on its own, with the captured
+ *	times - or a plain VCP byte stream (a pass archive), timed by the line rate -b. -T is the
+ *	time of the start of the capture in s (e.g. UNIX time), 0 by default.
+ *
+ *	Query mode prints the frames of an address (-a) from -s to -e s, one line per frame: time,
+ *	address and payload in hex, `!` after the address for a CRC error. -r prints the payloads
+ *	only, -q counts only; CRC errors are left out unless -c. The count, the frames looked at and
+ *	the query time are printed on stderr.
+ *
+ *	Info mode (-i) prints the segments and the frames per address.
+ *
+ *	Test mode (-t) writes random frames to a temporary archive - several appends, frames out of
+ *	time order, a segment cut short - and checks random queries against a scan of all the
+ *	frames. Any difference is printed and the exit code is 1.
+ *
+ *	Usage: frame_archive -w archive [-T start s] [-b baud] [-n segment frames] [-x stride] [-f frame buffer] capture...
+ *	       frame_archive [-a address] [-s from s] [-e to s] [-c] [-q | -r] archive
+ *	       frame_archive -i archive
+ *	       frame_archive -t [-n queries]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "vcp_archive.h"
+#include "rx_capture.h"
+
+#define ARCHIVE_FRAME_BUFF	4096			///< Default frame buffer size
+#define ARCHIVE_LINKS		256				///< Decoders per capture, by link byte
+#define TEST_FRAMES			20000			///< Frames in the test archive
+
+/// Converter options and counts
+typedef struct {
+	uint64_t		start_ns;				///< Time of the start of a capture
+	uint32_t		baud;					///< Line rate of plain streams
+	uint16_t		frame_buff;				///< Frame buffer size
+	uint64_t		lost;					///< Receive errors without a frame
+} convert_t;
+
+/// Link decoder
+typedef struct {
+	vcp_ptrbuffer	vcp;
+	uint8_t *		frame;
+} decoder_t;
+
+/**
+ * Name         : seconds
+ *
+ * Synopsis     : static double seconds (void)
+ *
+ * \return			Monotonic time, s
+ */
+static double seconds (void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * Name         : parse_seconds
+ *
+ * Synopsis     : static uint64_t parse_seconds (const char *s)
+ *
+ * \return			Time in s as ns, 0 for a negative time
+ */
+static uint64_t parse_seconds (const char *s)
+{
+	double	t = atof(s);
+
+	return (t > 0) ? (uint64_t)(t * 1e9 + 0.5) : 0;
+}
+
+
+/*****************/
+/* Write mode    */
+/*****************/
+
+/**
+ * Name         : decode_byte
+ *
+ * Synopsis     : static int decode_byte (vcp_archive_writer_t *w, convert_t *cv, decoder_t *d, uint8_t link, uint8_t byte, uint64_t time_ns)
+ *
+ * Description  : Receive_VCP_byte() a byte, starting over after a frame or an error and feeding
+ *				  it the FEND that ended the frame again, as vcp_split -t does. A frame goes to the
+ *				  archive with the CRC it came with; one too short for a CRC is only counted
+ *
+ * \return			0, -1 on a write error
+ */
+static int decode_byte (vcp_archive_writer_t *w, convert_t *cv, decoder_t *d, uint8_t link, uint8_t byte, uint64_t time_ns)
+{
+	uint16_t	index = d->vcp.index;
+	uint8_t		status = Receive_VCP_byte(&d->vcp, byte);
+	int			ret = 0;
+
+	if (status == VCP_IDLE || status == VCP_ADDRESS || status == VCP_RECEIVING || status == VCP_ESC)
+		return 0;
+
+	if ((status == VCP_TERM || status == VCP_CRC_ERR) && index >= 2)
+		ret = vcp_archive_add(w, time_ns, link, d->vcp.address, status,
+							  (d->frame[d->vcp.index] << 8) | d->frame[d->vcp.index + 1], d->frame, d->vcp.index);
+	else
+	{
+		vcp_archive_lost(w);
+		cv->lost++;
+	}
+
+	vcpptr_init(&d->vcp, d->frame, cv->frame_buff);
+	if (byte == FEND)
+		Receive_VCP_byte(&d->vcp, FEND);
+	return ret;
+}
+
+/**
+ * Name         : convert
+ *
+ * Synopsis     : static int convert (vcp_archive_writer_t *w, convert_t *cv, const char *path)
+ *
+ * Description  : Append the frames of a capture - a receive capture, or a plain VCP stream
+ *
+ * \return			0, 1 on error (printed)
+ */
+static int convert (vcp_archive_writer_t *w, convert_t *cv, const char *path)
+{
+	static decoder_t	decoders[ARCHIVE_LINKS];
+	const uint8_t *		data;
+	struct stat			st;
+	int					fd, ret = 0;
+
+	if ((fd = open(path, O_RDONLY)) < 0 || fstat(fd, &st) < 0)
+	{
+		perror(path);
+		return 1;
+	}
+	if (st.st_size == 0)
+	{
+		close(fd);
+		return 0;
+	}
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+	{
+		perror(path);
+		return 1;
+	}
+	madvise((void *)data, st.st_size, MADV_SEQUENTIAL);
+
+	for (int l = 0; l < ARCHIVE_LINKS; l++)
+	{
+		if (decoders[l].frame == NULL)
+			decoders[l].frame = malloc(cv->frame_buff);
+		vcpptr_init(&decoders[l].vcp, decoders[l].frame, cv->frame_buff);
+	}
+
+	if (st.st_size >= RX_CAPTURE_HEADER_SIZE && !memcmp(data, "RXCP", 4) && data[4] == RX_CAPTURE_VERSION)
+	{
+		// Receive capture - a decoder per link, the captured times
+		uint32_t	tick_ns = data[6] | (data[7] << 8);
+		uint64_t	ticks = 0;
+
+		for (off_t i = RX_CAPTURE_HEADER_SIZE; i + RX_CAPTURE_RECORD_SIZE <= st.st_size && !ret; i += RX_CAPTURE_RECORD_SIZE)
+		{
+			const uint8_t *	r = data + i;
+
+			ticks += r[2] | (r[3] << 8);
+			if (r[0] == RX_CAPTURE_TIME)
+				continue;
+			if (r[0] == RX_CAPTURE_LOST)
+			{
+				// A hole - the frames being received are lost
+				for (int l = 0; l < ARCHIVE_LINKS; l++)
+					vcpptr_init(&decoders[l].vcp, decoders[l].frame, cv->frame_buff);
+				continue;
+			}
+			ret = decode_byte(w, cv, &decoders[r[0]], r[0], r[1], cv->start_ns + ticks * tick_ns);
+		}
+	}
+	else
+	{
+		// Plain stream - the time at the end of every byte at 10 bits per byte
+		double	byte_ns = 10e9 / cv->baud;
+
+		for (off_t i = 0; i < st.st_size && !ret; i++)
+			ret = decode_byte(w, cv, &decoders[0], 0, data[i], cv->start_ns + (uint64_t)((i + 1) * byte_ns));
+	}
+
+	munmap((void *)data, st.st_size);
+	if (ret)
+		perror("archive write");
+	return ret ? 1 : 0;
+}
+
+
+/*****************/
+/* Query mode    */
+/*****************/
+
+/**
+ * Name         : print_frame
+ *
+ * Synopsis     : static void print_frame (const vcp_archive_frame_t *frame)
+ *
+ * Description  : time address[!] payload, in hex
+ */
+static void print_frame (const vcp_archive_frame_t *frame)
+{
+	static const char	hex[] = "0123456789abcdef";
+	static char			line[2 * 65536 + 2];
+	const uint8_t *		payload = VCP_ARCHIVE_PAYLOAD(frame);
+	char *				c = line;
+
+	for (uint32_t i = 0; i < frame->size; i++)
+	{
+		*c++ = hex[payload[i] >> 4];
+		*c++ = hex[payload[i] & 0xF];
+	}
+	*c++ = '\n';
+	printf("%llu.%09llu %02x%s ", (unsigned long long)(frame->time_ns / 1000000000), (unsigned long long)(frame->time_ns % 1000000000),
+		   frame->address, (frame->status == VCP_TERM) ? "" : "!");
+	fwrite(line, 1, c - line, stdout);
+}
+
+/**
+ * Name         : query
+ *
+ * Synopsis     : static int query (const char *path, int address, uint64_t from_ns, uint64_t to_ns, int crc_errors, int mode)
+ *
+ * \param	mode	0 - lines, 'r' - payloads, 'q' - count only
+ *
+ * \return			0, 1 on error (printed)
+ */
+static int query (const char *path, int address, uint64_t from_ns, uint64_t to_ns, int crc_errors, int mode)
+{
+	vcp_archive_t				a;
+	vcp_archive_query_t			q;
+	const vcp_archive_frame_t *	frame;
+	uint64_t					count = 0;
+	double						t0 = seconds(), t;
+
+	if (vcp_archive_open(&a, path))
+	{
+		perror(path);
+		return 1;
+	}
+
+	vcp_archive_query(&q, &a, from_ns, to_ns, address);
+	while ((frame = vcp_archive_next(&q)) != NULL)
+	{
+		if (frame->status != VCP_TERM && !crc_errors)
+			continue;
+		count++;
+		if (mode == 'r')
+			fwrite(VCP_ARCHIVE_PAYLOAD(frame), 1, frame->size, stdout);
+		else if (mode != 'q')
+			print_frame(frame);
+	}
+	t = seconds() - t0;
+
+	fprintf(stderr, "%llu frames, %llu of %llu looked at, %.3f ms\n", (unsigned long long)count,
+			(unsigned long long)q.visited, (unsigned long long)a.frames, t * 1e3);
+	vcp_archive_unmap(&a);
+	return 0;
+}
+
+/**
+ * Name         : info
+ *
+ * Synopsis     : static int info (const char *path)
+ *
+ * \return			0, 1 on error (printed)
+ */
+static int info (const char *path)
+{
+	vcp_archive_t				a;
+	vcp_archive_query_t			q;
+	const vcp_archive_frame_t *	frame;
+	uint64_t					frames[256] = { 0 }, errors[256] = { 0 };
+
+	if (vcp_archive_open(&a, path))
+	{
+		perror(path);
+		return 1;
+	}
+
+	printf("%-8s %10s %10s %8s %20s %20s\n", "segment", "frames", "bytes", "crc_err", "first_s", "last_s");
+	for (uint32_t i = 0; i < a.count; i++)
+	{
+		const vcp_archive_segment_t *	s = a.segments[i];
+
+		printf("%-8u %10u %10llu %8u %20.6f %20.6f\n", i, s->frames, (unsigned long long)s->size, s->crc_errors,
+			   s->first_ns * 1e-9, s->last_ns * 1e-9);
+	}
+
+	vcp_archive_query(&q, &a, 0, UINT64_MAX, VCP_ARCHIVE_ALL);
+	while ((frame = vcp_archive_next(&q)) != NULL)
+	{
+		frames[frame->address]++;
+		errors[frame->address] += (frame->status != VCP_TERM);
+	}
+	for (int addr = 0; addr < 256; addr++)
+		if (frames[addr])
+			printf("address 0x%02x: %llu frames, %llu crc errors\n", addr, (unsigned long long)frames[addr], (unsigned long long)errors[addr]);
+	printf("%u segments, %llu frames, %zu bytes", a.count, (unsigned long long)a.frames, a.size);
+	if (a.ignored)
+		printf(", %zu bytes of a segment cut short", a.ignored);
+	printf("\n");
+
+	vcp_archive_unmap(&a);
+	return 0;
+}
+
+
+/*****************/
+/* Test mode     */
+/*****************/
+
+/// Frame written in the test, for the scan
+typedef struct {
+	uint64_t		time_ns;
+	uint8_t			address;
+	uint16_t		size;
+	uint32_t		seed;					///< Payload bytes
+} test_frame_t;
+
+/**
+ * Name         : test_payload
+ *
+ * Synopsis     : static void test_payload (uint8_t *payload, uint16_t size, uint32_t seed)
+ */
+static void test_payload (uint8_t *payload, uint16_t size, uint32_t seed)
+{
+	for (uint16_t i = 0; i < size; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		payload[i] = seed >> 16;
+	}
+}
+
+/**
+ * Name         : test_write
+ *
+ * Synopsis     : static int test_write (const char *path, test_frame_t *frames, int from, int to, uint64_t *time_ns)
+ *
+ * Description  : Append frames [from, to) with random segment and index sizes. Times mostly go
+ *				  up, some go back
+ *
+ * \return			0, 1 on error
+ */
+static int test_write (const char *path, test_frame_t *frames, int from, int to, uint64_t *time_ns)
+{
+	static const uint8_t	addresses[] = { VCP_RADIO_1, VCP_CDHIB_1, VCP_RADIOIB_1, VCP_SUN_SENSOR };
+	vcp_archive_writer_t	w;
+	uint8_t					payload[1024];
+
+	if (vcp_archive_create(&w, path, 1 + lrand48() % 3000, 1 + lrand48() % 100))
+		return 1;
+	for (int i = from; i < to; i++)
+	{
+		test_frame_t *	f = &frames[i];
+
+		*time_ns +=	(lrand48() % 20 == 0) ? -(int64_t)(lrand48() % 1000000) : lrand48() % 1000000;
+		f->time_ns =	*time_ns;
+		// The spectrometer is rare, and comes in bursts
+		f->address =	((i / 500) % 7 == 3) ? VCP_SPECTROMETER : addresses[lrand48() % sizeof(addresses)];
+		f->size =		(lrand48() % 4) ? lrand48() % 64 : lrand48() % (long)sizeof(payload);
+		f->seed =		lrand48();
+		test_payload(payload, f->size, f->seed);
+		if (vcp_archive_add(&w, f->time_ns, VCP_RADIO_1, f->address, (f->seed % 10) ? VCP_TERM : VCP_CRC_ERR,
+							f->seed & 0xFFFF, payload, f->size))
+			return 1;
+	}
+	return vcp_archive_finish(&w) ? 1 : 0;
+}
+
+/**
+ * Name         : test
+ *
+ * Synopsis     : static int test (long queries)
+ *
+ * \return			Number of differences
+ */
+static int test (long queries)
+{
+	static test_frame_t	frames[TEST_FRAMES];
+	char				path[] = "/tmp/frame_archive_XXXXXX";
+	uint64_t			time_ns = 1000000000, visited = 0, matched = 0;
+	uint8_t				payload[1024];
+	vcp_archive_t		a;
+	int					fd, failures = 0, written = 0;
+	FILE *				f;
+
+	srand48(1);
+	if ((fd = mkstemp(path)) < 0)
+	{
+		perror(path);
+		return 1;
+	}
+	close(fd);
+	unlink(path);
+
+	// Three appends, then a segment cut short, then one more append that drops it
+	for (int part = 1; part <= 3; part++)
+	{
+		if (test_write(path, frames, written, TEST_FRAMES * part / 4, &time_ns))
+			failures++;
+		written = TEST_FRAMES * part / 4;
+	}
+	if ((f = fopen(path, "ab")) != NULL)
+	{
+		fwrite("VCPS", 1, 4, f);
+		fwrite(frames, 1, 100, f);
+		fclose(f);
+	}
+	if (test_write(path, frames, written, TEST_FRAMES, &time_ns))
+		failures++;
+
+	if (failures || vcp_archive_open(&a, path))
+	{
+		perror(path);
+		unlink(path);
+		return 1;
+	}
+	if (a.frames != TEST_FRAMES || a.ignored)
+	{
+		printf("archive has %llu frames, %zu bytes ignored, written %d frames\n", (unsigned long long)a.frames, a.ignored, TEST_FRAMES);
+		failures++;
+	}
+
+	for (long n = 0; n < queries && failures < 10; n++)
+	{
+		static const int			addresses[] = { VCP_ARCHIVE_ALL, VCP_RADIO_1, VCP_SPECTROMETER, VCP_CDHIB_1, VCP_SUN_SENSOR, VCP_GPS_1 };
+		int							address = addresses[lrand48() % 6];
+		uint64_t					from = frames[lrand48() % TEST_FRAMES].time_ns + lrand48() % 3 - 1;
+		uint64_t					to = from + ((lrand48() % 4) ? lrand48() % 100000000 : lrand48() % 20000000000);
+		vcp_archive_query_t			q;
+		const vcp_archive_frame_t *	frame;
+		int							i = 0;
+
+		if (lrand48() % 10 == 0)
+			from = 0, to = UINT64_MAX;
+
+		// The frames in file order that match, and the ones the query gives, must be the same
+		vcp_archive_query(&q, &a, from, to, address);
+		for (;;)
+		{
+			while (i < TEST_FRAMES && !(frames[i].time_ns >= from && frames[i].time_ns <= to &&
+										(address == VCP_ARCHIVE_ALL || frames[i].address == address)))
+				i++;
+			frame = vcp_archive_next(&q);
+			if (frame == NULL || i == TEST_FRAMES)
+			{
+				if (frame != NULL || i != TEST_FRAMES)
+				{
+					printf("query %ld (%d, %llu-%llu): %s ends early at frame %d\n", n, address, (unsigned long long)from,
+						   (unsigned long long)to, frame ? "scan" : "query", i);
+					failures++;
+				}
+				break;
+			}
+			test_payload(payload, frames[i].size, frames[i].seed);
+			if (frame->time_ns != frames[i].time_ns || frame->address != frames[i].address || frame->size != frames[i].size ||
+				frame->crc != (frames[i].seed & 0xFFFF) || memcmp(VCP_ARCHIVE_PAYLOAD(frame), payload, frame->size))
+			{
+				printf("query %ld (%d, %llu-%llu): frame %d differs\n", n, address, (unsigned long long)from, (unsigned long long)to, i);
+				failures++;
+				break;
+			}
+			matched++;
+			i++;
+		}
+		visited += q.visited;
+	}
+
+	printf("%u segments, %ld queries, %llu frames matched, %llu looked at, %d differences\n", a.count, queries,
+		   (unsigned long long)matched, (unsigned long long)visited, failures);
+	vcp_archive_unmap(&a);
+	unlink(path);
+	return failures;
+}
+
+int main (int argc, char **argv)
+{
+	convert_t				cv = { 0, 115200, ARCHIVE_FRAME_BUFF, 0 };
+	vcp_archive_writer_t	w;
+	const char *			archive = NULL;
+	int						mode = 0, address = VCP_ARCHIVE_ALL, crc_errors = 0, print = 0, opt, result = 0;
+	long					segment_frames = VCP_ARCHIVE_SEGMENT, stride = VCP_ARCHIVE_STRIDE, frame_buff = ARCHIVE_FRAME_BUFF, queries = 2000;
+	uint64_t				from_ns = 0, to_ns = UINT64_MAX;
+
+	while ((opt = getopt(argc, argv, "a:b:ce:f:in:qrs:tT:w:x:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'a':	address = strtol(optarg, NULL, 0);				break;
+			case 'b':	cv.baud = atol(optarg);							break;
+			case 'c':	crc_errors = 1;									break;
+			case 'e':	to_ns = parse_seconds(optarg);							break;
+			case 'f':	frame_buff = atol(optarg);						break;
+			case 'i':	mode = 'i';										break;
+			case 'n':	segment_frames = queries = atol(optarg);		break;
+			case 'q':	print = 'q';									break;
+			case 'r':	print = 'r';									break;
+			case 's':	from_ns = parse_seconds(optarg);						break;
+			case 't':	mode = 't';										break;
+			case 'T':	cv.start_ns = parse_seconds(optarg);					break;
+			case 'w':	mode = 'w'; archive = optarg;					break;
+			case 'x':	stride = atol(optarg);							break;
+			default:
+				fprintf(stderr, "usage: %s -w archive [-T start s] [-b baud] [-n segment frames] [-x stride] [-f frame buffer] capture...\n"
+								"       %s [-a address] [-s from s] [-e to s] [-c] [-q | -r] archive\n"
+								"       %s -i archive\n"
+								"       %s -t [-n queries]\n", argv[0], argv[0], argv[0], argv[0]);
+				return 1;
+		}
+	}
+
+	if (mode == 't')
+		return test(queries) ? 1 : 0;
+
+	if (mode == 'w')
+	{
+		if (optind >= argc || cv.baud == 0 || segment_frames < 1 || stride < 1 || frame_buff < 3 || frame_buff > 65535)
+		{
+			fprintf(stderr, "%s -w needs captures, a baud rate, segments and stride of 1 frame or more, a frame buffer of 3 to 65535\n", argv[0]);
+			return 1;
+		}
+		cv.frame_buff = frame_buff;
+		if (vcp_archive_create(&w, archive, segment_frames, stride))
+		{
+			perror(archive);
+			return 1;
+		}
+		for (int i = optind; i < argc && !result; i++)
+			result = convert(&w, &cv, argv[i]);
+		if (vcp_archive_finish(&w))
+		{
+			perror(archive);
+			result = 1;
+		}
+		fprintf(stderr, "%llu frames, %llu receive errors without a frame, %llu segments appended\n",
+				(unsigned long long)w.frames, (unsigned long long)cv.lost, (unsigned long long)w.segments);
+		return result;
+	}
+
+	if (optind >= argc)
+	{
+		fprintf(stderr, "%s: no archive\n", argv[0]);
+		return 1;
+	}
+	if (mode == 'i')
+		return info(argv[optind]);
+	return query(argv[optind], address, from_ns, to_ns, crc_errors, print);
+}
@@ -0,0 +1,504 @@
+/** \file
+ * hal_posix.c
+ * \brief Hardware abstraction layer, POSIX backend
+ *
+ *	See ../RadioIB/src/hal/hal_posix.h. One thread stands in for the interrupt controller:
+ *	it waits on the UART file descriptors with poll(), hands the received bytes to the UART
+ *	receive handlers and calls the tick handler once for every ms of CLOCK_MONOTONIC.
+ *	The handlers run with the critical section lock held - the lock HAL_CRITICAL takes.
+ *
+ *	With hal_posix_virtual() there is no thread and no real time: the program injects the
+ *	received bytes and moves the clock itself (host/rx_replay), so a run is repeatable.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hal/hal.h"
+
+#define HAL_POSIX_UARTS		3						///< USARTC0, USARTD0, USARTE0
+#define HAL_POSIX_RX_READ	64						///< Bytes read from a UART at a time
+#define NS_PER_MS			1000000L
+#define FNV_OFFSET			2166136261u				///< FNV-1a hash start
+#define FNV_PRIME			16777619u				///< FNV-1a hash multiplier
+
+hal_uart_t			USARTC0 = { .fd = -1 };
+hal_uart_t			USARTD0 = { .fd = -1 };
+hal_uart_t			USARTE0 = { .fd = -1 };
+hal_posix_dma_t		DMA;
+hal_port_t			PORTA, PORTD;
+
+static hal_uart_t * const	uarts[HAL_POSIX_UARTS] = { &USARTC0, &USARTD0, &USARTE0 };
+
+static pthread_mutex_t		irq_lock;				///< Held by the interrupt handlers and HAL_CRITICAL
+static pthread_once_t		irq_lock_once = PTHREAD_ONCE_INIT;
+static pthread_t			irq_thread;
+static volatile int			irq_running;
+static hal_vector_t			tick_vector;			///< 1 kHz tick handler
+static hal_vector_t			capture_vector;			///< Radio external event edge handler
+
+static struct timespec		tick_time;				///< Time of the last tick
+static uint16_t				capture_count;			///< Tick timer count at the last captured edge
+static int					virtual_clock;			///< hal_posix_virtual() - time moves with hal_posix_advance_to() only
+static int64_t				virtual_ns;				///< Virtual clock time
+
+/**
+ * Name         : clock_now
+ *
+ * Synopsis     : static void clock_now (struct timespec *t)
+ *
+ * Description  : CLOCK_MONOTONIC, or the virtual clock
+ */
+static void clock_now (struct timespec *t)
+{
+	if (virtual_clock)
+	{
+		t->tv_sec =		virtual_ns / (1000 * NS_PER_MS);
+		t->tv_nsec =	virtual_ns % (1000 * NS_PER_MS);
+		return;
+	}
+	clock_gettime(CLOCK_MONOTONIC, t);
+}
+
+/**
+ * Name         : ns_since
+ *
+ * Synopsis     : static long ns_since (const struct timespec *t)
+ *
+ * \return		ns from t to now
+ */
+static long ns_since (const struct timespec *t)
+{
+	struct timespec	now;
+
+	clock_now(&now);
+	return (now.tv_sec - t->tv_sec) * 1000 * NS_PER_MS + (now.tv_nsec - t->tv_nsec);
+}
+
+/**
+ * Name         : irq_lock_init
+ *
+ * Synopsis     : static void irq_lock_init (void)
+ *
+ * Description  : Recursive lock, so critical sections can nest and handlers can take them
+ */
+static void irq_lock_init (void)
+{
+	pthread_mutexattr_t	attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&irq_lock, &attr);
+	pthread_mutexattr_destroy(&attr);
+	clock_now(&tick_time);
+}
+
+/*********************/
+/* Critical sections */
+/*********************/
+
+void hal_posix_lock (void)
+{
+	pthread_once(&irq_lock_once, irq_lock_init);
+	pthread_mutex_lock(&irq_lock);
+}
+
+void hal_posix_unlock (void)
+{
+	pthread_mutex_unlock(&irq_lock);
+}
+
+/**************/
+/* UART / DMA */
+/**************/
+
+void hal_uart_dma_init (hal_dma_t *channel, uint8_t trigger)
+{
+	(void)channel;
+	(void)trigger;
+}
+
+/**
+ * Name         : hal_uart_send
+ *
+ * Synopsis     : void hal_uart_send (hal_uart_t *uart, hal_dma_t *channel, const uint8_t *data, uint16_t size)
+ *
+ * Description  : Write the block to the UART file descriptor. Waits up to HAL_POSIX_TX_WAIT_MS at a time 
+ *				  while the reader is behind, then drops the rest - a UART does not wait for its listener.
+ */
+void hal_uart_send (hal_uart_t *uart, hal_dma_t *channel, const uint8_t *data, uint16_t size)
+{
+	uint16_t		done = 0;
+	ssize_t			n;
+	struct pollfd	p;
+
+	channel->transfers++;
+	uart->tx_bytes += size;
+	if (!uart->tx_hash)
+		uart->tx_hash = FNV_OFFSET;
+	for (n = 0; n < size; n++)
+		uart->tx_hash = (uart->tx_hash ^ data[n]) * FNV_PRIME;
+	if (uart->fd < 0)
+		return;
+
+	while (done < size)
+	{
+		n = write(uart->fd, data + done, size - done);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0 && errno == EAGAIN)
+		{
+			p.fd =		uart->fd;
+			p.events =	POLLOUT;
+			if (poll(&p, 1, HAL_POSIX_TX_WAIT_MS) > 0 && (p.revents & POLLOUT))
+				continue;
+		}
+		if (n <= 0)
+		{
+			uart->tx_dropped += size - done;
+			return;
+		}
+		done += (uint16_t)n;
+	}
+}
+
+void hal_dma_init (void)
+{
+	pthread_once(&irq_lock_once, irq_lock_init);
+}
+
+/*********/
+/* Timer */
+/*********/
+
+uint16_t hal_timer_count (void)
+{
+	long	ns = ns_since(&tick_time);
+
+	if (ns >= NS_PER_MS)
+		ns -= NS_PER_MS;					// Tick not handled yet, hal_timer_overflow() is set - count after the wrap
+	if (ns >= NS_PER_MS)
+		return HAL_POSIX_TIMER_PERIOD - 1;
+	if (ns < 0)
+		return 0;
+	return (uint16_t)(ns * HAL_POSIX_TIMER_PERIOD / NS_PER_MS);
+}
+
+uint8_t hal_timer_overflow (void)
+{
+	return ns_since(&tick_time) >= NS_PER_MS;
+}
+
+uint16_t hal_timer_capture (void)
+{
+	return capture_count;
+}
+
+void hal_capture_init (void)
+{
+	PORTD.capture |= 0x80;		// PD7, the radio external event
+}
+
+/********/
+/* GPIO */
+/********/
+
+void hal_gpio_set (hal_port_t *port, uint8_t mask)
+{
+	port->out |=	mask;
+	port->in |=		mask;
+}
+
+void hal_gpio_clear (hal_port_t *port, uint8_t mask)
+{
+	port->out &=	(uint8_t)~mask;
+	port->in &=		(uint8_t)~mask;
+}
+
+void hal_gpio_toggle (hal_port_t *port, uint8_t mask)
+{
+	port->out ^=	mask;
+	port->in ^=		mask;
+}
+
+/**
+ * Name         : hal_posix_gpio_input
+ *
+ * Synopsis     : void hal_posix_gpio_input (hal_port_t *port, uint8_t mask, uint8_t level)
+ *
+ * Description  : Drive input pins from outside. An edge on a captured pin (hal_capture_init())
+ *				  keeps the tick timer count and calls the capture handler.
+ */
+void hal_posix_gpio_input (hal_port_t *port, uint8_t mask, uint8_t level)
+{
+	uint8_t	in;
+
+	hal_posix_lock();
+	in = level ? (uint8_t)(port->in | mask) : (uint8_t)(port->in & ~mask);
+	if ((in ^ port->in) & port->capture)
+	{
+		port->in =		in;
+		capture_count =	hal_timer_count();
+		if (capture_vector)
+			capture_vector();
+	}
+	port->in = in;
+	pthread_mutex_unlock(&irq_lock);
+}
+
+/*******************/
+/* Backend control */
+/*******************/
+
+/**
+ * Name         : hal_posix_uart_attach
+ *
+ * Synopsis     : void hal_posix_uart_attach (hal_uart_t *uart, int fd, hal_vector_t rx_vector, uint32_t baudrate)
+ *
+ * \param	uart		UART
+ * \param	fd			File descriptor for both directions, -1 to detach
+ * \param	rx_vector	Receive handler, NULL for transmit only
+ * \param	baudrate	Receive rate limit, as a 8N1 line at this rate. 0 for none (host speed)
+ */
+void hal_posix_uart_attach (hal_uart_t *uart, int fd, hal_vector_t rx_vector, uint32_t baudrate)
+{
+	pthread_once(&irq_lock_once, irq_lock_init);
+	if (fd >= 0)
+		fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	pthread_mutex_lock(&irq_lock);
+	uart->fd =			fd;
+	uart->rx_vector =	rx_vector;
+	uart->rx_per_ms =	baudrate ? (uint16_t)((baudrate + 9999) / 10000) : 0;	// 10 bits per byte
+	uart->rx_budget =	uart->rx_per_ms;
+	pthread_mutex_unlock(&irq_lock);
+}
+
+/**
+ * Name         : hal_posix_uart_pty
+ *
+ * Synopsis     : int hal_posix_uart_pty (hal_uart_t *uart, hal_vector_t rx_vector, uint32_t baudrate, char *name, size_t name_size)
+ *
+ * Description  : Attach the UART to a new raw pseudo-terminal
+ *
+ * \return		Master file descriptor, -1 on error. name is the slave device, for the other end
+ */
+int hal_posix_uart_pty (hal_uart_t *uart, hal_vector_t rx_vector, uint32_t baudrate, char *name, size_t name_size)
+{
+	struct termios	tio;
+	int				fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if (fd < 0)
+		return -1;
+	if (grantpt(fd) < 0 || unlockpt(fd) < 0 || ptsname_r(fd, name, name_size) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+
+	if (tcgetattr(fd, &tio) == 0)
+	{
+		cfmakeraw(&tio);
+		tcsetattr(fd, TCSANOW, &tio);
+	}
+
+	// Keep the slave side open, so the master does not hang up between the programs that use it
+	if (open(name, O_RDWR | O_NOCTTY) < 0)
+	{
+		close(fd);
+		return -1;
+	}
+
+	hal_posix_uart_attach(uart, fd, rx_vector, baudrate);
+	return fd;
+}
+
+/**
+ * Name         : hal_posix_uart_inject
+ *
+ * Synopsis     : void hal_posix_uart_inject (hal_uart_t *uart, uint8_t byte)
+ *
+ * Description  : Receive a byte as if it came in on the line - call the receive handler.
+ *				  For programs that feed the UARTs themselves (hal_posix_virtual())
+ */
+void hal_posix_uart_inject (hal_uart_t *uart, uint8_t byte)
+{
+	hal_posix_lock();
+	uart->rx_byte = byte;
+	uart->rx_bytes++;
+	if (uart->rx_vector)
+		uart->rx_vector();
+	pthread_mutex_unlock(&irq_lock);
+}
+
+/**
+ * Name         : irq_ticks
+ *
+ * Synopsis     : static void irq_ticks (void)
+ *
+ * Description  : One tick handler call for every ms since the last tick, a new receive budget for the UARTs
+ */
+static void irq_ticks (void)
+{
+	int	i;
+
+	while (ns_since(&tick_time) >= NS_PER_MS)
+	{
+		tick_time.tv_nsec += NS_PER_MS;
+		if (tick_time.tv_nsec >= 1000 * NS_PER_MS)
+		{
+			tick_time.tv_nsec -= 1000 * NS_PER_MS;
+			tick_time.tv_sec++;
+		}
+		for (i = 0; i < HAL_POSIX_UARTS; i++)
+			uarts[i]->rx_budget = uarts[i]->rx_per_ms;
+		if (tick_vector)
+			tick_vector();
+	}
+}
+
+/**
+ * Name         : irq_main
+ *
+ * Synopsis     : static void *irq_main (void *arg)
+ *
+ * Description  : Interrupt thread - wait for received bytes or the next tick, then run the handlers
+ */
+static void *irq_main (void *arg)
+{
+	struct pollfd	fds[HAL_POSIX_UARTS];
+	hal_uart_t *	owner[HAL_POSIX_UARTS];
+	uint8_t			buf[HAL_POSIX_RX_READ];
+	size_t			want;
+	ssize_t			got;
+	long			ns;
+	int				i, n, count;
+
+	(void)arg;
+	while (irq_running)
+	{
+		count = 0;
+		for (i = 0; i < HAL_POSIX_UARTS; i++)
+		{
+			if (uarts[i]->fd < 0 || !uarts[i]->rx_vector)
+				continue;
+			if (uarts[i]->rx_per_ms && !uarts[i]->rx_budget)
+				continue;							// line rate reached in this ms
+			fds[count].fd =		uarts[i]->fd;
+			fds[count].events =	POLLIN;
+			owner[count++] =	uarts[i];
+		}
+
+		// Sleep until the next tick at most
+		ns = NS_PER_MS - ns_since(&tick_time);
+		poll(fds, count, ns > 0 ? (int)((ns + NS_PER_MS - 1) / NS_PER_MS) : 0);
+
+		pthread_mutex_lock(&irq_lock);
+		irq_ticks();
+		for (i = 0; i < count; i++)
+		{
+			if (!(fds[i].revents & POLLIN))
+				continue;
+			want = sizeof(buf);
+			if (owner[i]->rx_per_ms && want > owner[i]->rx_budget)
+				want = owner[i]->rx_budget;
+			got = read(fds[i].fd, buf, want);
+			for (n = 0; n < got; n++)
+			{
+				owner[i]->rx_byte = buf[n];
+				owner[i]->rx_bytes++;
+				owner[i]->rx_vector();
+			}
+			if (got > 0 && owner[i]->rx_per_ms)
+				owner[i]->rx_budget -= (uint16_t)got;
+		}
+		pthread_mutex_unlock(&irq_lock);
+	}
+	return NULL;
+}
+
+/**
+ * Name         : hal_posix_start
+ *
+ * Synopsis     : void hal_posix_start (hal_vector_t tick, hal_vector_t capture)
+ *
+ * Description  : Start the interrupt thread - "enable the interrupts"
+ */
+void hal_posix_start (hal_vector_t tick, hal_vector_t capture)
+{
+	pthread_once(&irq_lock_once, irq_lock_init);
+	tick_vector =		tick;
+	capture_vector =	capture;
+	clock_now(&tick_time);
+	if (virtual_clock)
+		return;								// hal_posix_advance_to() runs the ticks
+	irq_running =		1;
+	if (pthread_create(&irq_thread, NULL, irq_main, NULL) != 0)
+	{
+		perror("hal_posix_start");
+		exit(1);
+	}
+}
+
+void hal_posix_stop (void)
+{
+	if (!irq_running)
+		return;
+	irq_running = 0;
+	pthread_join(irq_thread, NULL);
+}
+
+/**
+ * Name         : hal_posix_virtual
+ *
+ * Synopsis     : void hal_posix_virtual (void)
+ *
+ * Description  : Switch to the virtual clock, at time 0. Call before anything else - 
+ *				  hal_posix_start() then starts no thread, the program drives the time
+ */
+void hal_posix_virtual (void)
+{
+	virtual_clock =	1;
+	virtual_ns =	0;
+	pthread_once(&irq_lock_once, irq_lock_init);
+	clock_now(&tick_time);
+}
+
+/**
+ * Name         : hal_posix_advance_to
+ *
+ * Synopsis     : void hal_posix_advance_to (int64_t ns)
+ *
+ * \param	ns	Virtual clock time, not before the current one
+ *
+ * Description  : Move the virtual clock and run the ticks that fell due
+ */
+void hal_posix_advance_to (int64_t ns)
+{
+	if (ns > virtual_ns)
+		virtual_ns = ns;
+	hal_posix_lock();
+	irq_ticks();
+	pthread_mutex_unlock(&irq_lock);
+}
+
+/**
+ * Name         : hal_posix_now
+ *
+ * Synopsis     : int64_t hal_posix_now (void)
+ *
+ * \return		Virtual clock time in ns
+ */
+int64_t hal_posix_now (void)
+{
+	return virtual_ns;
+}
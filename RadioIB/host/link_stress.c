@@ -0,0 +1,750 @@
+/** \file
+ * link_stress.c
+ * \brief Line rate stress test of the Radio IB bridge
+ *
+ *	Drives both links of a bridge - a board on two USB-serial adapters, or radioib_posix on
+ *	its pseudo-terminals - with random VCP traffic and checks every frame that comes out:
+ *
+ * *	CDHIB end: sends frames for the radio up to the flow control credit limit (-n: ignore
+ *		the limit), and receives the frames the ground sent. At the limit it reads it with
+ *		FLOW_CREDIT_COMMAND every STRESS_CREDIT_POLL ms - the bridge only advertises a higher one.
+ *		Frames with bit errors on the line never reach the bridge and do not count as sent
+ * *	Radio end: the ground station - runs the firmware ARQ (radio/arq.c) and LZSS
+ *		(radio/lzss.c), receives the downlink and sends the uplink frames
+ *
+ *	Payload sizes are uniform in -s min-max, -x is the share of payload bytes that are FEND
+ *	or FESC (escaped on the line). The payload is built from its sequence number, so the
+ *	receiver regenerates and compares it. -e and -E add bit errors to both directions of the
+ *	CDHIB and the radio line - frames with errors are lost on the CDHIB line, the ARQ repairs the radio ones.
+ *	The bridge is put in contact first (STORE_PASS_START), so nothing goes to the store.
+ *	The radio link ARQ has no session reset - start every run with a fresh bridge (restart
+ *	radioib_posix, reset the board), or the ground end here is out of step with it.
+ *
+ *	Per direction it prints the frames sent and delivered, the throughput, the latency
+ *	percentiles (sent to delivered) and the frames lost by cause:
+ * *	line -		down: bit errors added on the CDHIB line, up: frames garbled on the CDHIB line
+ * *	arq -		given up by the ARQ after ARQ_MAX_RETRIES
+ * *	missing -	never delivered, no cause seen here (bridge overrun, dropped frames - see dlog_decode)
+ * *	bad, dup, order - delivered with the wrong content, twice, or out of order
+ *
+ *	-c prints CSV lines instead (a '#' header first) for sweeps over baud rates and buffer sizes.
+ *	The exit code is 1 if any frame was missing, bad, duplicated or out of order.
+ *
+ *	Usage: link_stress [-b baud] [-t seconds] [-w drain seconds] [-r frames/s] [-s min-max]
+ *	                   [-x escapes] [-e CDHIB BER] [-E radio BER] [-d up|down|both] [-S seed] [-n] [-c]
+ *	                   cdhib_device radio_device
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vcp_library.h"
+#include "arq.h"
+#include "lzss.h"
+
+#define STRESS_RADIOIB			VCP_RADIOIB_1		///< Radio IB VCP address (conf_board.h, RADIO_IB_1)
+#define STRESS_RADIO			VCP_RADIO_1			///< Radio VCP address
+#define STRESS_FRAME_BUFF		1024				///< Encoded / decoded frame buffer size
+#define STRESS_HEADER			4					///< Payload sequence number, LSB first
+#define STRESS_COMMAND_TIMEOUT	5000				///< Time for the bridge to answer the pass command, ms
+
+// Radio IB commands used here - see ../RadioIB/src/tasks/radioib.h
+#define STRESS_FLOW_CREDIT		0x04				///< FLOW_CREDIT_COMMAND
+#define STRESS_STORE			0x08				///< STORE_COMMAND
+#define STRESS_PASS_START		0x01				///< STORE_PASS_START
+#define STRESS_NOTIFY_SEQUENCE	0xFF				///< COMMAND_NOTIFY_SEQUENCE
+#define STRESS_COMMAND_SEQUENCE	0x5A				///< Sequence number of the pass and credit commands
+#define STRESS_CREDIT_POLL		200					///< Time between credit limit reads while at the limit, ms
+
+// Frame states
+#define FRAME_SENT				0x00				///< Sent, not delivered yet
+#define FRAME_CORRUPTED			0x01				///< Bit errors added on the CDHIB line
+#define FRAME_DELIVERED			0x02				///< Delivered
+
+/// One serial line end
+typedef struct {
+	const char *	name;							///< Device name
+	int				fd;								///< File descriptor
+	double			ber;							///< Bit error rate added to what is sent and received
+	vcp_ptrbuffer	vcp;							///< VCP decoder
+	uint8_t			rx[STRESS_FRAME_BUFF];			///< Decoded frame
+	uint8_t			tx[STRESS_FRAME_BUFF];			///< Encoded frame being written
+	uint16_t		tx_size;						///< Its size, 0 when the line is free
+	uint16_t		tx_done;						///< Bytes written so far
+	uint8_t			rx_address;						///< VCP address of the decoded frame
+	long			rx_errors;						///< VCP errors in received frames
+} line_t;
+
+/// One sent frame
+typedef struct {
+	double			sent;							///< Time sent, ms
+	uint8_t			state;							///< FRAME_...
+} frame_t;
+
+/// Frames of one direction
+typedef struct {
+	const char *	name;							///< "down" - CDHIB to ground, "up" - ground to CDHIB
+	uint32_t		seed;							///< Payload generator seed
+	int				enabled;						///< Traffic is sent this way
+	frame_t *		frames;							///< Sent frames by sequence number
+	uint32_t		capacity;						///< Size of frames[]
+	uint32_t		sent;							///< Frames sent = next sequence number
+	uint32_t		last;							///< Sequence number of the last delivered frame + 1
+	double			next_time;						///< Next send time for the rate limit, ms
+	double			last_time;						///< Time of the last delivery, ms
+	double *		latency;						///< Latency of each delivered frame, ms
+	long			delivered, corrupted, bad, duplicates, out_of_order, line_lost, arq_lost;
+	double			bytes;							///< Payload bytes delivered
+} stream_t;
+
+static double		rate;							///< Frames per second per direction, 0 - as fast as the link takes them
+static uint16_t		size_min =	STRESS_HEADER;		///< Smallest payload
+static uint16_t		size_max =	ARQ_MAX_PAYLOAD;	///< Largest payload
+static uint32_t		escape_threshold;				///< FEND / FESC share of the payload bytes, of 65536
+
+/**
+ * Name         : now_ms
+ *
+ * Synopsis     : static double now_ms (void)
+ *
+ * \return		Monotonic time in ms
+ */
+static double now_ms (void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+/**
+ * Name         : prng
+ *
+ * Synopsis     : static uint32_t prng (uint32_t *state)
+ *
+ * Description  : xorshift32 step, for payloads that can be generated again from the sequence number
+ */
+static uint32_t prng (uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+/**
+ * Name         : payload_make
+ *
+ * Synopsis     : static uint16_t payload_make (const stream_t *s, uint32_t seq, uint8_t *dst)
+ *
+ * Description  : Build payload seq of a direction - [sequence number][random bytes, -x of them FEND / FESC]
+ *
+ * \return		Payload size
+ */
+static uint16_t payload_make (const stream_t *s, uint32_t seq, uint8_t *dst)
+{
+	uint32_t	state = ((seq + 1) * 2654435761u) ^ s->seed;
+	uint16_t	size;
+
+	if (state == 0)
+		state = 1;
+	size = size_min + prng(&state) % (size_max - size_min + 1);
+
+	dst[0] = seq;
+	dst[1] = seq >> 8;
+	dst[2] = seq >> 16;
+	dst[3] = seq >> 24;
+	for (uint16_t i = STRESS_HEADER; i < size; i++)
+	{
+		uint32_t r = prng(&state);
+
+		if ((r & 0xFFFF) < escape_threshold)
+			dst[i] = (r & 0x10000) ? FEND : FESC;
+		else
+			dst[i] = r >> 24;
+	}
+	return size;
+}
+
+/**
+ * Name         : stream_send
+ *
+ * Synopsis     : static uint16_t stream_send (stream_t *s, double now, uint8_t *dst)
+ *
+ * Description  : Build the next payload of a direction and record its send time
+ *
+ * \return		Payload size
+ */
+static uint16_t stream_send (stream_t *s, double now, uint8_t *dst)
+{
+	if (s->sent == s->capacity)
+	{
+		s->capacity =	s->capacity ? s->capacity * 2 : 4096;
+		s->frames =		realloc(s->frames, s->capacity * sizeof(frame_t));
+		s->latency =	realloc(s->latency, s->capacity * sizeof(double));
+		if (s->frames == NULL || s->latency == NULL)
+		{
+			fprintf(stderr, "out of memory\n");
+			exit(2);
+		}
+	}
+
+	s->frames[s->sent].sent =	now;
+	s->frames[s->sent].state =	FRAME_SENT;
+	s->next_time = (rate > 0) ? s->next_time + 1000.0 / rate : now;
+	return payload_make(s, s->sent++, dst);
+}
+
+/**
+ * Name         : stream_ready
+ *
+ * Synopsis     : static int stream_ready (const stream_t *s, double now)
+ *
+ * \return		The rate limit lets the next frame of a direction go now
+ */
+static int stream_ready (const stream_t *s, double now)
+{
+	return s->enabled && now >= s->next_time;
+}
+
+/**
+ * Name         : stream_check
+ *
+ * Synopsis     : static void stream_check (stream_t *s, double now, const uint8_t *data, uint16_t size)
+ *
+ * Description  : Check a delivered payload against the one that was sent
+ */
+static void stream_check (stream_t *s, double now, const uint8_t *data, uint16_t size)
+{
+	uint8_t		expected[ARQ_MAX_PAYLOAD];
+	uint32_t	seq;
+	frame_t *	f;
+
+	if (size < STRESS_HEADER)
+	{
+		s->bad++;
+		return;
+	}
+	seq = data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+	if (seq >= s->sent || payload_make(s, seq, expected) != size || memcmp(expected, data, size))
+	{
+		s->bad++;
+		return;
+	}
+
+	f = &s->frames[seq];
+	if (f->state == FRAME_DELIVERED)
+	{
+		s->duplicates++;
+		return;
+	}
+	if (f->state == FRAME_CORRUPTED)
+		s->corrupted--;
+	if (seq < s->last)
+		s->out_of_order++;
+
+	f->state =							FRAME_DELIVERED;
+	s->last =							seq + 1;
+	s->latency[s->delivered++] =		now - f->sent;
+	s->bytes +=							size;
+	s->last_time =						now;
+}
+
+/**
+ * Name         : line_open
+ *
+ * Synopsis     : static int line_open (line_t *line, const char *name, uint32_t baud)
+ *
+ * Description  : Open a serial device raw at the baud rate (just raw for a pseudo-terminal)
+ *
+ * \return		0, -1 on error
+ */
+static int line_open (line_t *line, const char *name, uint32_t baud)
+{
+	static const struct { uint32_t baud; speed_t speed; } speeds[] = {
+		{ 9600, B9600 }, { 19200, B19200 }, { 38400, B38400 }, { 57600, B57600 }, { 115200, B115200 },
+		{ 230400, B230400 }, { 460800, B460800 }, { 921600, B921600 }
+	};
+	struct termios	tio;
+	speed_t			speed = 0;
+
+	line->name =	name;
+	line->fd =		open(name, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (line->fd < 0)
+	{
+		perror(name);
+		return -1;
+	}
+	vcpptr_init(&line->vcp, line->rx, sizeof(line->rx));
+
+	if (tcgetattr(line->fd, &tio) < 0)
+		return 0;											// Not a terminal - a pipe or a socket
+
+	for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+		if (speeds[i].baud == baud)
+			speed = speeds[i].speed;
+	if (speed == 0)
+	{
+		fprintf(stderr, "%s: unsupported baud rate %u\n", name, baud);
+		return -1;
+	}
+
+	cfmakeraw(&tio);
+	cfsetispeed(&tio, speed);
+	cfsetospeed(&tio, speed);
+	if (tcsetattr(line->fd, TCSANOW, &tio) < 0)
+	{
+		perror(name);
+		return -1;
+	}
+	tcflush(line->fd, TCIOFLUSH);
+	return 0;
+}
+
+/**
+ * Name         : line_send
+ *
+ * Synopsis     : static int line_send (line_t *line, uint8_t addr, uint8_t *frame, uint16_t size)
+ *
+ * Description  : VCP encode a frame for the line and add the bit errors. frame needs 2 spare bytes (CRC).
+ *				  The line must be free (tx_size 0).
+ *
+ * \return		Number of bits flipped
+ */
+static int line_send (line_t *line, uint8_t addr, uint8_t *frame, uint16_t size)
+{
+	uint16_t	encoded = sizeof(line->tx);
+	int			flipped = 0;
+
+	if (Create_VCP_frame(line->tx, &encoded, addr, frame, size) != VCP_TERM)
+		return 0;
+
+	if (line->ber > 0)
+		for (uint16_t i = 0; i < encoded; i++)
+			for (int bit = 0; bit < 8; bit++)
+				if (drand48() < line->ber)
+				{
+					line->tx[i] ^= (1 << bit);
+					flipped++;
+				}
+
+	line->tx_size =	encoded;
+	line->tx_done =	0;
+	return flipped;
+}
+
+/**
+ * Name         : line_flush
+ *
+ * Synopsis     : static int line_flush (line_t *line)
+ *
+ * Description  : Write as much of the frame being sent as the line takes now
+ *
+ * \return		0, -1 on error
+ */
+static int line_flush (line_t *line)
+{
+	ssize_t n;
+
+	if (line->tx_size == 0)
+		return 0;
+
+	n = write(line->fd, &line->tx[line->tx_done], line->tx_size - line->tx_done);
+	if (n < 0)
+	{
+		if (errno == EAGAIN || errno == EINTR)
+			return 0;
+		perror(line->name);
+		return -1;
+	}
+
+	line->tx_done += n;
+	if (line->tx_done == line->tx_size)
+		line->tx_size = 0;
+	return 0;
+}
+
+/**
+ * Name         : line_receive
+ *
+ * Synopsis     : static int line_receive (line_t *line, uint8_t c)
+ *
+ * Description  : Decode one received byte
+ *
+ * \return		Size of the frame it completed (in line->rx, address in line->rx_address), 0 otherwise
+ */
+static int line_receive (line_t *line, uint8_t c)
+{
+	uint8_t status;
+	int		size = 0;
+
+	// Back to back frames - FEND FEND between them
+	if (line->vcp.status == VCP_ADDRESS && c == FEND)
+		return 0;
+
+	status = Receive_VCP_byte(&line->vcp, c);
+	if (status == VCP_TERM)
+	{
+		size =				line->vcp.index;
+		line->rx_address =	line->vcp.address;
+	}
+	else if (status >= VCP_OVR_ERR && status <= VCP_ESC_ERR)
+		line->rx_errors++;
+	else
+		return 0;
+
+	// The caller takes the frame before the next byte - the FEND that ended it may start the next one
+	vcpptr_init(&line->vcp, line->rx, sizeof(line->rx));
+	if (c == FEND)
+		Receive_VCP_byte(&line->vcp, FEND);
+	return size;
+}
+
+/**
+ * Name         : line_read
+ *
+ * Synopsis     : static ssize_t line_read (line_t *line, uint8_t *buff, size_t size)
+ *
+ * Description  : Read what the line has now, with the bit errors of the line
+ *
+ * \return		Bytes read, -1 on error
+ */
+static ssize_t line_read (line_t *line, uint8_t *buff, size_t size)
+{
+	ssize_t n = read(line->fd, buff, size);
+
+	if (n < 0)
+	{
+		if (errno == EAGAIN || errno == EINTR)
+			return 0;
+		perror(line->name);
+		return -1;
+	}
+
+	if (line->ber > 0)
+		for (ssize_t i = 0; i < n; i++)
+			for (int bit = 0; bit < 8; bit++)
+				if (drand48() < line->ber)
+					buff[i] ^= (1 << bit);
+	return n;
+}
+
+/**
+ * Name         : compare_double
+ *
+ * Synopsis     : static int compare_double (const void *a, const void *b)
+ *
+ * Description  : qsort() order of the latencies
+ */
+static int compare_double (const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ * Name         : percentile
+ *
+ * Synopsis     : static double percentile (const stream_t *s, double p)
+ *
+ * \return		Latency percentile p of the delivered frames (sorted), ms
+ */
+static double percentile (const stream_t *s, double p)
+{
+	long i;
+
+	if (s->delivered == 0)
+		return 0;
+	i = (long)(p / 100.0 * (s->delivered - 1) + 0.5);
+	return s->latency[i];
+}
+
+/**
+ * Name         : stream_report
+ *
+ * Synopsis     : static long stream_report (stream_t *s, double start, int csv, const char *config)
+ *
+ * Description  : Print the results of a direction. Throughput is up to the last delivery
+ *
+ * \return		Frames missing, bad, duplicated or out of order
+ */
+static long stream_report (stream_t *s, double start, int csv, const char *config)
+{
+	double	seconds = (s->last_time - start) / 1000;
+	long	missing = (long)s->sent - s->delivered - s->corrupted - s->line_lost - s->arq_lost;
+
+	if (missing < 0)
+		missing = 0;
+	if (seconds <= 0)
+		seconds = 1;
+	qsort(s->latency, s->delivered, sizeof(double), compare_double);
+
+	printf(csv ? "%s%s,%u,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%.0f,%.1f,%.1f,%.1f,%.1f\n"
+			   : "%-5s%s %8u %9ld %6ld %6ld %8ld %6ld %6ld %6ld %10.0f %8.1f %8.1f %8.1f %8.1f\n",
+		   s->name, config, s->sent, s->delivered, s->corrupted + s->line_lost, s->arq_lost, missing,
+		   s->bad, s->duplicates, s->out_of_order, s->bytes * 8 / seconds,
+		   percentile(s, 50), percentile(s, 90), percentile(s, 99), percentile(s, 100));
+
+	return missing + s->bad + s->duplicates + s->out_of_order;
+}
+
+int main (int argc, char **argv)
+{
+	static arq_t		ground;
+	static struct { uint8_t data[LZSS_MAX_INPUT]; uint16_t size; } history[256];	// Delivered payloads by ARQ sequence number
+	static line_t		cdhib, radio;
+	stream_t			down = { .name = "down", .seed = 0x00D0D0D0, .enabled = 1 };
+	stream_t			up = { .name = "up", .seed = 0x00F00F00, .enabled = 1 };
+	uint8_t				frame[STRESS_FRAME_BUFF];
+	uint8_t				buff[512];
+	uint32_t			baud = 115200;
+	double				seconds = 10, drain = 3, escapes = 0.05;
+	double				start, now, last, send_end, end, command_time, credit_time = 0, stall = 0;
+	long				seed = 1, failed;
+	uint8_t				limit = 0, radio_sent = 0;			// Credit limit, frames for the radio sent - modulo 256
+	int					ignore_credits = 0, csv = 0, in_contact = 0, arq_checked = 0;
+	int					opt;
+	char				config[256];
+
+	while ((opt = getopt(argc, argv, "b:t:w:r:s:x:e:E:d:S:nc")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':	baud =			strtoul(optarg, NULL, 0);	break;
+			case 't':	seconds =		atof(optarg);				break;
+			case 'w':	drain =			atof(optarg);				break;
+			case 'r':	rate =			atof(optarg);				break;
+			case 'x':	escapes =		atof(optarg);				break;
+			case 'e':	cdhib.ber =		atof(optarg);				break;
+			case 'E':	radio.ber =		atof(optarg);				break;
+			case 'S':	seed =			atol(optarg);				break;
+			case 'n':	ignore_credits = 1;							break;
+			case 'c':	csv = 1;									break;
+			case 's':
+			{
+				unsigned a, b;
+				int n = sscanf(optarg, "%u-%u", &a, &b);
+
+				if (n == 1)
+					b = a;
+				if (n < 1 || a < STRESS_HEADER || b < a || b > ARQ_MAX_PAYLOAD)
+				{
+					fprintf(stderr, "payload sizes %d to %d\n", STRESS_HEADER, ARQ_MAX_PAYLOAD);
+					return 2;
+				}
+				size_min =	a;
+				size_max =	b;
+				break;
+			}
+			case 'd':
+				down.enabled =	strcmp(optarg, "up") != 0;
+				up.enabled =	strcmp(optarg, "down") != 0;
+				break;
+			default:
+				fprintf(stderr, "usage: %s [-b baud] [-t seconds] [-w drain seconds] [-r frames/s] [-s min-max]\n"
+						"       [-x escapes] [-e CDHIB BER] [-E radio BER] [-d up|down|both] [-S seed] [-n] [-c]\n"
+						"       cdhib_device radio_device\n", argv[0]);
+				return 2;
+		}
+	}
+	if (optind + 2 != argc)
+	{
+		fprintf(stderr, "%s: the CDHIB and the radio devices are needed\n", argv[0]);
+		return 2;
+	}
+	if (line_open(&cdhib, argv[optind], baud) < 0 || line_open(&radio, argv[optind + 1], baud) < 0)
+		return 2;
+
+	escape_threshold = (uint32_t)(escapes * 65536);
+	srand48(seed);
+	arq_init(&ground);
+	snprintf(config, sizeof(config), csv ? ",%u,%.1f,%u,%u,%.3f,%g,%g,%d" : "",
+			 baud, rate, size_min, size_max, escapes, cdhib.ber, radio.ber, ignore_credits);
+
+	start =			now_ms();
+	command_time =	start;
+	send_end =		start + STRESS_COMMAND_TIMEOUT;		// Until the bridge is in contact
+	end =			send_end;
+
+	for (now = last = start; now < end; last = now, now = now_ms())
+	{
+		struct pollfd	fds[2] = { { cdhib.fd, POLLIN, 0 }, { radio.fd, POLLIN, 0 } };
+		uint16_t		tick = (uint16_t)(now - start);
+		uint8_t *		data;
+		uint8_t			flags;
+		uint16_t		size;
+		ssize_t			n;
+
+		fds[0].events |= cdhib.tx_size ? POLLOUT : 0;
+		fds[1].events |= radio.tx_size ? POLLOUT : 0;
+		poll(fds, 2, 1);
+
+		// CDHIB end - command responses and the uplink
+		if ((n = line_read(&cdhib, buff, sizeof(buff))) < 0)
+			return 2;
+		for (ssize_t i = 0; i < n; i++)
+		{
+			int size = line_receive(&cdhib, buff[i]);
+
+			if (size == 0)
+				continue;
+			if (cdhib.rx_address == STRESS_RADIO)
+			{
+				stream_check(&up, now_ms(), cdhib.rx, size);
+			}
+			else if (cdhib.rx_address == STRESS_RADIOIB && size >= 5)
+			{
+				// [sequence][header][status][size][data]
+				// Advertised, or the answer to a credit read
+				if (cdhib.rx[1] == STRESS_FLOW_CREDIT && cdhib.rx[2] == 0)
+					limit = cdhib.rx[4];
+				else if (cdhib.rx[0] == STRESS_COMMAND_SEQUENCE && cdhib.rx[1] == STRESS_STORE && !in_contact)
+				{
+					in_contact =	1;
+					start =			now_ms();
+					send_end =		start + seconds * 1000;
+					end =			send_end + drain * 1000;
+					down.next_time = up.next_time = start;
+				}
+			}
+		}
+
+		// Radio end - the ground station
+		if ((n = line_read(&radio, buff, sizeof(buff))) < 0)
+			return 2;
+		for (ssize_t i = 0; i < n; i++)
+		{
+			int size = line_receive(&radio, buff[i]);
+
+			if (size == 0)
+				continue;
+			// A bridge that ran before has its ARQ window further on - [data][seq][window base]
+			if (!arq_checked && size >= ARQ_HEADER_SIZE && (radio.rx[0] & ARQ_TYPE_MASK) == ARQ_DATA)
+			{
+				arq_checked = 1;
+				if (radio.rx[2] != 0)
+					fprintf(stderr, "%s: the bridge ARQ is not at its start - restart or reset the bridge before a run\n", radio.name);
+			}
+			arq_receive(&ground, tick, radio.rx, size);
+		}
+		while ((size = arq_deliver(&ground, &data, &flags)))
+		{
+			uint8_t		payload[LZSS_MAX_INPUT];
+			uint8_t		seq = ground.rx_next;
+
+			if (flags & ARQ_FLAG_REFERENCE)
+			{
+				size = history[data[0]].size ? lzss_decompress(history[data[0]].data, history[data[0]].size, &data[1], size - 1, payload, sizeof(payload)) : 0;
+				data = payload;
+			}
+			else if (flags & ARQ_FLAG_COMPRESSED)
+			{
+				size = lzss_decompress(NULL, 0, data, size, payload, sizeof(payload));
+				data = payload;
+			}
+
+			history[seq].size = (size <= LZSS_MAX_INPUT) ? size : 0;
+			memcpy(history[seq].data, data, history[seq].size);
+			stream_check(&down, now_ms(), data, size);
+			arq_deliver_done(&ground);
+		}
+
+		// New frames
+		if (!in_contact)
+		{
+			if (cdhib.tx_size == 0 && now >= command_time)
+			{
+				// Ground contact until STORE_PASS_END, retried every second. 2 spare bytes for the CRC
+				uint8_t command[] = { STRESS_COMMAND_SEQUENCE, STRESS_STORE, STRESS_PASS_START, 0, 0, 0, 0 };
+
+				line_send(&cdhib, STRESS_RADIOIB, command, sizeof(command) - 2);
+				command_time = now + 1000;
+			}
+		}
+		else if (now < send_end)
+		{
+			if (cdhib.tx_size == 0 && stream_ready(&down, now))
+			{
+				if ((int8_t)(limit - radio_sent) > 0 || ignore_credits)
+				{
+					size = stream_send(&down, now, frame);
+					if (line_send(&cdhib, STRESS_RADIO, frame, size))
+					{
+						down.frames[down.sent - 1].state = FRAME_CORRUPTED;
+						down.corrupted++;
+					}
+					else
+						radio_sent++;
+				}
+				else
+				{
+					stall += now - last;
+					if (now >= credit_time)
+					{
+						// No higher limit advertised yet, or it was lost. 2 spare bytes for the CRC
+						uint8_t command[] = { STRESS_COMMAND_SEQUENCE, STRESS_FLOW_CREDIT, 0, 0 };
+
+						line_send(&cdhib, STRESS_RADIOIB, command, sizeof(command) - 2);
+						credit_time = now + STRESS_CREDIT_POLL;
+					}
+				}
+			}
+			while (arq_tx_space(&ground) && stream_ready(&up, now))
+			{
+				size = stream_send(&up, now, frame);
+				arq_send(&ground, frame, size, 0);
+			}
+		}
+		else if (down.delivered + down.corrupted + (long)ground.rx_lost >= (long)down.sent &&
+				 up.delivered + up.line_lost + (long)ground.tx_given_up >= (long)up.sent)
+		{
+			break;											// Everything accounted for
+		}
+
+		if (radio.tx_size == 0 && (size = arq_tx_poll(&ground, tick, &data)))
+			line_send(&radio, STRESS_RADIOIB, data, size);
+
+		if (line_flush(&cdhib) < 0 || line_flush(&radio) < 0)
+			return 2;
+	}
+
+	if (!in_contact)
+	{
+		fprintf(stderr, "%s: no response from the Radio IB\n", cdhib.name);
+		return 2;
+	}
+
+	down.arq_lost =		ground.rx_lost;
+	up.arq_lost =		ground.tx_given_up;
+	up.line_lost =		cdhib.rx_errors;
+	seconds =			(now - start) / 1000;			// Including the drain
+
+	if (csv)
+		printf("#dir,baud,rate,size_min,size_max,escapes,ber_cdhib,ber_radio,no_credits,"
+			   "sent,delivered,line,arq,missing,bad,dup,order,bps,p50_ms,p90_ms,p99_ms,max_ms\n");
+	else
+		printf("# %s %s, %u baud, %.1f s, sizes %u-%u, escapes %.3f, BER CDHIB %g radio %g, %s, stalled on credits %.0f ms\n"
+			   "%-5s %8s %9s %6s %6s %8s %6s %6s %6s %10s %8s %8s %8s %8s\n",
+			   cdhib.name, radio.name, baud, seconds, size_min, size_max, escapes, cdhib.ber, radio.ber,
+			   ignore_credits ? "credits ignored" : "credits kept", stall,
+			   "dir", "sent", "delivered", "line", "arq", "missing", "bad", "dup", "order",
+			   "bps", "p50_ms", "p90_ms", "p99_ms", "max_ms");
+
+	failed = 0;
+	if (down.enabled)
+		failed += stream_report(&down, start, csv, config);
+	if (up.enabled)
+		failed += stream_report(&up, start, csv, config);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,260 @@
+/** \file
+ * lzss_tool.c
+ * \brief Host decompressor and benchmark for the radio link LZSS compression
+ *
+ *	Decode mode reads the raw byte stream received from the radio (file, serial device
+ *	or stdin), decodes the VCP frames, puts the ARQ data frames back in order (radio/arq.c)
+ *	and writes the payloads, decompressed, one hex line per frame (-r: raw bytes).
+ *	Delivered payloads are kept by sequence number for the frames compressed against them.
+ *
+ *	Benchmark mode (-b) splits files into frames of ARQ_MAX_PAYLOAD bytes (-f: other size)
+ *	and compresses them the way radio_link_send() does: against a reference payload that
+ *	becomes usable -d frames after it was sent (the acknowledge delay, default 3) and is 
+ *	replaced every RADIO_REFERENCE_INTERVAL frames. Checks the round trip and prints the
+ *	compression ratio, with and without the reference.
+ *
+ *	Usage: lzss_tool [-r] [capture file or serial device]
+ *	       lzss_tool -b [-f frame size] [-d ack delay] file ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vcp_library.h"
+#include "arq.h"
+#include "lzss.h"
+
+#define FRAME_BUFF		512			///< Decoded VCP frame buffer size
+
+/// Delivered payloads by sequence number
+typedef struct {
+	uint8_t		data[LZSS_MAX_INPUT];	///< Payload, decompressed
+	uint16_t	size;					///< Payload size, 0 if not delivered
+} history_t;
+
+/**
+ * Name         : write_payload
+ *
+ * Synopsis     : static void write_payload (const uint8_t *data, uint16_t size, int raw)
+ *
+ * Description  : Write one payload as raw bytes or as a hex line
+ */
+static void write_payload (const uint8_t *data, uint16_t size, int raw)
+{
+	if (raw)
+	{
+		fwrite(data, 1, size, stdout);
+		return;
+	}
+	for (uint16_t i = 0; i < size; i++)
+		printf("%02x", data[i]);
+	printf("\n");
+}
+
+/**
+ * Name         : decode
+ *
+ * Synopsis     : static int decode (FILE *in, int raw)
+ *
+ * Description  : Decode a radio capture: VCP frames -> ARQ -> LZSS -> payloads
+ *
+ * \return		Exit code
+ */
+static int decode (FILE *in, int raw)
+{
+	static arq_t		arq;
+	static history_t	history[256];
+	vcp_ptrbuffer	vcp;
+	uint8_t			frame[FRAME_BUFF];
+	uint8_t			payload[LZSS_MAX_INPUT];
+	long			frames = 0, errors = 0, compressed = 0, bytes_in = 0, bytes_out = 0;
+	int				c;
+
+	arq_init(&arq);
+	vcpptr_init(&vcp, frame, sizeof(frame));
+
+	while ((c = fgetc(in)) != EOF)
+	{
+		uint8_t		status;
+		uint8_t *	data;
+		uint8_t		flags;
+		uint16_t	size;
+
+		// Back to back frames - FEND FEND between them
+		if (vcp.status == VCP_ADDRESS && c == FEND)
+			continue;
+
+		status = Receive_VCP_byte(&vcp, (uint8_t)c);
+		if (status == VCP_TERM)
+			arq_receive(&arq, 0, frame, vcp.index);
+		else if (status >= VCP_OVR_ERR && status <= VCP_ESC_ERR)
+			errors++;
+		else
+			continue;
+
+		// The FEND that ended this frame may start the next one
+		vcpptr_init(&vcp, frame, sizeof(frame));
+		if (c == FEND)
+			Receive_VCP_byte(&vcp, FEND);
+
+		while ((size = arq_deliver(&arq, &data, &flags)))
+		{
+			history_t *	entry = &history[arq.rx_next];
+
+			frames++;
+			bytes_in += size;
+			if (flags & ARQ_FLAG_REFERENCE)
+			{
+				history_t *	ref = &history[data[0]];
+
+				compressed++;
+				size = ref->size ? lzss_decompress(ref->data, ref->size, &data[1], size - 1, payload, sizeof(payload)) : 0;
+				data = payload;
+			}
+			else if (flags & ARQ_FLAG_COMPRESSED)
+			{
+				compressed++;
+				size = lzss_decompress(NULL, 0, data, size, payload, sizeof(payload));
+				data = payload;
+			}
+
+			entry->size = (size <= LZSS_MAX_INPUT) ? size : 0;
+			memcpy(entry->data, data, entry->size);
+			if (size == 0)
+				errors++;
+			bytes_out += size;
+			if (size)
+				write_payload(data, size, raw);
+			arq_deliver_done(&arq);
+		}
+	}
+
+	fprintf(stderr, "%ld frames (%ld compressed), %ld bytes -> %ld bytes, %ld errors, %u lost\n",
+			frames, compressed, bytes_in, bytes_out, errors, arq.rx_lost);
+	return 0;
+}
+
+/**
+ * Name         : benchmark
+ *
+ * Synopsis     : static int benchmark (const char *name, uint16_t frame_size, int ack_delay, int use_reference)
+ *
+ * Description  : Compress a file frame by frame, check the round trip, print the ratio
+ *
+ * \return		Exit code
+ */
+static int benchmark (const char *name, uint16_t frame_size, int ack_delay, int use_reference)
+{
+	static lzss_t	lz;
+	static uint8_t	ref[LZSS_MAX_INPUT];
+	uint8_t			src[LZSS_MAX_INPUT], dst[LZSS_MAX_INPUT], check[LZSS_MAX_INPUT];
+	uint16_t		ref_size = 0;
+	long			ref_sent = -1, ref_uses = 0;
+	long			frames = 0, compressed = 0, bytes_in = 0, bytes_out = 0;
+	double			seconds = 0;
+	size_t			n;
+	FILE *			in = fopen(name, "rb");
+
+	if (in == NULL)
+	{
+		perror(name);
+		return 1;
+	}
+
+	while ((n = fread(src, 1, frame_size, in)) > 0)
+	{
+		struct timespec	t0, t1;
+		int				ready = use_reference && ref_sent >= 0 && frames - ref_sent > ack_delay;
+		const uint8_t *	dict = ready ? ref : NULL;
+		uint16_t		dict_size = ready ? ref_size : 0;
+		uint16_t		size;
+
+		// With a reference the frame also carries the reference sequence number
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		size = lzss_compress(&lz, dict, dict_size, src, n, dst, n - (ready ? 2 : 1));
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		seconds += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+		if (size)
+		{
+			if (lzss_decompress(dict, dict_size, dst, size, check, sizeof(check)) != n || memcmp(check, src, n))
+			{
+				fprintf(stderr, "%s: round trip failed at frame %ld\n", name, frames);
+				fclose(in);
+				return 1;
+			}
+			compressed++;
+			size += ready;
+		}
+		if (ready)
+			ref_uses++;
+
+		// Next reference, as radio_link_send() picks it
+		if (use_reference && (ref_sent < 0 || (ready && ref_uses >= RADIO_REFERENCE_INTERVAL)))
+		{
+			memcpy(ref, src, n);
+			ref_size =	n;
+			ref_sent =	frames;
+			ref_uses =	0;
+		}
+
+		frames++;
+		bytes_in += n;
+		bytes_out += size ? size : n;
+	}
+	fclose(in);
+
+	printf("%-20s %-9s %6ld frames %5.1f%% compressed %8ld -> %8ld bytes  ratio %.2f  %.1f ns/byte\n",
+		   name, use_reference ? "reference" : "frame", frames, frames ? 100.0 * compressed / frames : 0, 
+		   bytes_in, bytes_out, bytes_out ? (double)bytes_in / bytes_out : 0, bytes_in ? seconds * 1e9 / bytes_in : 0);
+	return 0;
+}
+
+int main (int argc, char **argv)
+{
+	int			raw = 0, bench = 0, ack_delay = 3, opt, result = 0;
+	long		frame_size = ARQ_MAX_PAYLOAD;
+	FILE *		in = stdin;
+
+	while ((opt = getopt(argc, argv, "rbf:d:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'r':	raw = 1;					break;
+			case 'b':	bench = 1;					break;
+			case 'f':	frame_size = atol(optarg);	break;
+			case 'd':	ack_delay = atoi(optarg);	break;
+			default:
+				fprintf(stderr, "usage: %s [-r] [capture]\n       %s -b [-f frame size] [-d ack delay] file ...\n", argv[0], argv[0]);
+				return 1;
+		}
+	}
+
+	if (bench)
+	{
+		if (frame_size < 2 || frame_size > LZSS_MAX_INPUT)
+		{
+			fprintf(stderr, "frame size must be 2 to %d\n", LZSS_MAX_INPUT);
+			return 1;
+		}
+		for (int i = optind; i < argc; i++)
+		{
+			result |= benchmark(argv[i], (uint16_t)frame_size, ack_delay, 0);
+			result |= benchmark(argv[i], (uint16_t)frame_size, ack_delay, 1);
+		}
+		return result;
+	}
+
+	if (optind < argc && (in = fopen(argv[optind], "rb")) == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+	result = decode(in, raw);
+	if (in != stdin)
+		fclose(in);
+	return result;
+}
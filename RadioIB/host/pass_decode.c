@@ -0,0 +1,532 @@
+/** \file
+ * pass_decode.c
+ * \brief Decodes a whole pass archive on all the CPUs, one output file per VCP address
+ *
+ *	The archive (a VCP byte stream - a radio capture, the output of fec_decode) is memory mapped
+ *	and cut into chunks just after FENDs. After a FEND the decoder state is always the same
+ *	(vcp_stream_start()), so every chunk decodes on its own to the frames the whole stream gives
+ *	(vcp_stream.c - the same frames and errors as Receive_VCP_byte()).
+ *
+ *	The chunks go to a work-stealing pool: every thread has a queue, the main thread deals the
+ *	chunks out in order, and a thread with an empty queue takes the oldest chunk from another
+ *	thread's queue. The main thread writes the chunks out in order as they are done - at most
+ *	-w chunks per thread ahead of it, so memory does not grow with the archive.
+ *
+ *	The good frames of each address go to their own file, <prefix>_<address>.txt - one hex line
+ *	per frame as vcp_split - or .bin with -r, the payloads only. The frame and error counts
+ *	per address and the speed are printed on stderr.
+ *
+ *	Usage: pass_decode [-j threads] [-c chunk MB] [-w window] [-f frame buffer] [-o prefix] [-r] archive
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "vcp_stream.h"
+
+#define DECODE_THREADS		256				///< Most threads
+#define DECODE_CHUNK_MIN	(64 << 10)		///< Smallest chunk, bytes
+#define DECODE_FRAME_BUFF	4096			///< Default frame buffer size
+#define DECODE_ADDRESSES	256				///< Output per address byte value
+
+/// Growing output buffer
+typedef struct {
+	uint8_t *		data;
+	size_t			size;
+	size_t			capacity;
+} output_t;
+
+/// Chunk of the archive, and its decoded output
+typedef struct {
+	uint64_t		start;					///< Offset in the archive
+	uint64_t		size;					///< Bytes
+	output_t *		output[DECODE_ADDRESSES];	///< Frames per address, NULL for none
+	uint64_t		frames[DECODE_ADDRESSES];	///< Good frames per address
+	uint64_t		errors[VCP_ESC_ERR + 1];	///< Receive errors, by VCP_OVR_ERR...
+	volatile int	done;					///< Decoded, under pool.lock
+} chunk_t;
+
+/// Work-stealing queue of chunk numbers - the owner and thieves take from the front (oldest)
+typedef struct {
+	pthread_mutex_t	lock;
+	uint32_t *		items;					///< Ring of capacity entries
+	uint32_t		capacity;
+	uint32_t		head;					///< Next to take
+	uint32_t		count;
+	uint64_t		stolen;					///< Chunks taken by other threads
+} queue_t;
+
+/// Thread pool
+typedef struct {
+	pthread_mutex_t	lock;					///< queued, finished and chunk done flags
+	pthread_cond_t	work;					///< A chunk was queued, or finished
+	pthread_cond_t	done;					///< A chunk was decoded
+	uint32_t		queued;					///< Chunks in the queues not taken yet
+	int				finished;				///< No more chunks
+	int				threads;
+	queue_t			queues[DECODE_THREADS];
+	chunk_t *		chunks;
+	const uint8_t *	archive;
+	uint32_t		frame_buff;				///< vcp_stream frame buffer size
+	int				raw;					///< Payload bytes instead of hex lines
+} pool_t;
+
+/// Worker thread
+typedef struct {
+	pool_t *		pool;
+	int				index;
+	pthread_t		thread;
+} worker_t;
+
+static pool_t		pool;
+static worker_t		workers[DECODE_THREADS];
+
+/**
+ * Name         : seconds
+ *
+ * Synopsis     : static double seconds (void)
+ *
+ * \return			Monotonic time, s
+ */
+static double seconds (void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * Name         : output_append
+ *
+ * Synopsis     : static void output_append (output_t *out, const void *data, size_t size)
+ */
+static void output_append (output_t *out, const void *data, size_t size)
+{
+	if (out->size + size > out->capacity)
+	{
+		out->capacity = (out->capacity ? out->capacity * 2 : 65536) + size;
+		if ((out->data = realloc(out->data, out->capacity)) == NULL)
+		{
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+	}
+	memcpy(out->data + out->size, data, size);
+	out->size += size;
+}
+
+
+/*****************/
+/* Chunks        */
+/*****************/
+
+/**
+ * Name         : chunks_cut
+ *
+ * Synopsis     : static uint32_t chunks_cut (const uint8_t *archive, uint64_t size, uint64_t chunk_size, chunk_t **chunks)
+ *
+ * Description  : Cut the archive just after the first FEND from every chunk_size bytes. A chunk
+ *				  with no FEND runs on to the next one
+ *
+ * \return			Number of chunks
+ */
+static uint32_t chunks_cut (const uint8_t *archive, uint64_t size, uint64_t chunk_size, chunk_t **chunks)
+{
+	uint32_t	count = 0, capacity = size / chunk_size + 2;
+	uint64_t	start = 0;
+
+	*chunks = calloc(capacity, sizeof(chunk_t));
+	while (start < size && *chunks)
+	{
+		uint64_t		end = start + chunk_size;
+		const uint8_t *	fend;
+
+		if (end >= size)
+			end = size;
+		else if ((fend = memchr(archive + end, FEND, size - end)) != NULL)
+			end = fend - archive + 1;
+		else
+			end = size;
+
+		(*chunks)[count].start =	start;
+		(*chunks)[count].size =		end - start;
+		count++;
+		start = end;
+	}
+	return count;
+}
+
+/**
+ * Name         : chunk_frame
+ *
+ * Synopsis     : static void chunk_frame (void *context, const vcp_stream_frame_t *frame)
+ *
+ * Description  : Keep a good frame in the output of its address
+ */
+static void chunk_frame (void *context, const vcp_stream_frame_t *frame)
+{
+	chunk_t *			chunk = context;
+	output_t *			out;
+	static const char	hex[] = "0123456789abcdef";
+	char				line[64];
+
+	if (frame->status != VCP_TERM)
+		return;
+
+	chunk->frames[frame->address]++;
+	if ((out = chunk->output[frame->address]) == NULL)
+		out = chunk->output[frame->address] = calloc(1, sizeof(output_t));
+
+	if (pool.raw)
+	{
+		output_append(out, frame->data, frame->size);
+		return;
+	}
+
+	line[0] = hex[frame->address >> 4];
+	line[1] = hex[frame->address & 0xF];
+	line[2] = ' ';
+	output_append(out, line, 3);
+	for (uint32_t i = 0; i < frame->size; )
+	{
+		int	n = 0;
+
+		for (; n < (int)sizeof(line) && i < frame->size; i++)
+		{
+			line[n++] = hex[frame->data[i] >> 4];
+			line[n++] = hex[frame->data[i] & 0xF];
+		}
+		output_append(out, line, n);
+	}
+	output_append(out, "\n", 1);
+}
+
+/**
+ * Name         : chunk_decode
+ *
+ * Synopsis     : static void chunk_decode (chunk_t *chunk, uint8_t *frame)
+ *
+ * Description  : Decode a chunk - the first one from the start of the stream, the others from just
+ *				  after the FEND that ended the one before
+ */
+static void chunk_decode (chunk_t *chunk, uint8_t *frame)
+{
+	vcp_stream_t	vs;
+
+	vcp_stream_init(&vs, VCP_STREAM_AUTO, frame, pool.frame_buff);
+	if (chunk->start)
+		vcp_stream_start(&vs, chunk->start);
+	vcp_stream_decode(&vs, pool.archive + chunk->start, chunk->size, chunk_frame, chunk);
+	memcpy(chunk->errors, vs.errors, sizeof(chunk->errors));
+}
+
+
+/*****************/
+/* Thread pool   */
+/*****************/
+
+/**
+ * Name         : queue_take
+ *
+ * Synopsis     : static int queue_take (queue_t *queue, uint32_t *item, int thief)
+ *
+ * \return			1 with the oldest chunk in item, 0 for an empty queue
+ */
+static int queue_take (queue_t *queue, uint32_t *item, int thief)
+{
+	int	taken = 0;
+
+	pthread_mutex_lock(&queue->lock);
+	if (queue->count)
+	{
+		*item =			queue->items[queue->head];
+		queue->head =	(queue->head + 1) % queue->capacity;
+		queue->count--;
+		queue->stolen += thief;
+		taken = 1;
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return taken;
+}
+
+/**
+ * Name         : queue_put
+ *
+ * Synopsis     : static void queue_put (queue_t *queue, uint32_t item)
+ */
+static void queue_put (queue_t *queue, uint32_t item)
+{
+	pthread_mutex_lock(&queue->lock);
+	queue->items[(queue->head + queue->count++) % queue->capacity] = item;
+	pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * Name         : worker_thread
+ *
+ * Synopsis     : static void *worker_thread (void *context)
+ *
+ * Description  : Reserve a queued chunk, take it from the own queue or steal it from the others,
+ *				  decode it. Until the main thread has no more chunks
+ */
+static void *worker_thread (void *context)
+{
+	worker_t *	worker = context;
+	uint8_t *	frame = malloc(pool.frame_buff);
+	uint32_t	item;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&pool.lock);
+		while (pool.queued == 0 && !pool.finished)
+			pthread_cond_wait(&pool.work, &pool.lock);
+		if (pool.queued == 0)
+		{
+			pthread_mutex_unlock(&pool.lock);
+			break;
+		}
+		pool.queued--;
+		pthread_mutex_unlock(&pool.lock);
+
+		// There is a chunk for this thread in one of the queues
+		for (int i = 0; ; i = (i + 1) % pool.threads)
+		{
+			int	q = (worker->index + i) % pool.threads;
+
+			if (queue_take(&pool.queues[q], &item, q != worker->index))
+				break;
+		}
+
+		chunk_decode(&pool.chunks[item], frame);
+
+		pthread_mutex_lock(&pool.lock);
+		pool.chunks[item].done = 1;
+		pthread_cond_broadcast(&pool.done);
+		pthread_mutex_unlock(&pool.lock);
+	}
+
+	free(frame);
+	return NULL;
+}
+
+/**
+ * Name         : pool_start
+ *
+ * Synopsis     : static void pool_start (int threads, uint32_t window)
+ */
+static void pool_start (int threads, uint32_t window)
+{
+	pthread_mutex_init(&pool.lock, NULL);
+	pthread_cond_init(&pool.work, NULL);
+	pthread_cond_init(&pool.done, NULL);
+	pool.threads = threads;
+
+	for (int i = 0; i < threads; i++)
+	{
+		pthread_mutex_init(&pool.queues[i].lock, NULL);
+		pool.queues[i].capacity =	window;
+		pool.queues[i].items =		malloc(window * sizeof(uint32_t));
+		workers[i].pool =			&pool;
+		workers[i].index =			i;
+		pthread_create(&workers[i].thread, NULL, worker_thread, &workers[i]);
+	}
+}
+
+/**
+ * Name         : pool_queue
+ *
+ * Synopsis     : static void pool_queue (uint32_t item)
+ *
+ * Description  : Deal a chunk to the threads in turn
+ */
+static void pool_queue (uint32_t item)
+{
+	queue_put(&pool.queues[item % pool.threads], item);
+
+	pthread_mutex_lock(&pool.lock);
+	pool.queued++;
+	pthread_cond_signal(&pool.work);
+	pthread_mutex_unlock(&pool.lock);
+}
+
+/**
+ * Name         : pool_stop
+ *
+ * Synopsis     : static uint64_t pool_stop (void)
+ *
+ * \return			Chunks stolen
+ */
+static uint64_t pool_stop (void)
+{
+	uint64_t	stolen = 0;
+
+	pthread_mutex_lock(&pool.lock);
+	pool.finished = 1;
+	pthread_cond_broadcast(&pool.work);
+	pthread_mutex_unlock(&pool.lock);
+
+	for (int i = 0; i < pool.threads; i++)
+	{
+		pthread_join(workers[i].thread, NULL);
+		stolen += pool.queues[i].stolen;
+		free(pool.queues[i].items);
+	}
+	return stolen;
+}
+
+
+/*****************/
+/* Output        */
+/*****************/
+
+/**
+ * Name         : chunk_write
+ *
+ * Synopsis     : static void chunk_write (chunk_t *chunk, FILE **files, const char *prefix, uint64_t *frames, uint64_t *errors)
+ *
+ * Description  : Write a decoded chunk to the address files, add up its counts, free it
+ */
+static void chunk_write (chunk_t *chunk, FILE **files, const char *prefix, uint64_t *frames, uint64_t *errors)
+{
+	char	name[1024];
+
+	for (int a = 0; a < DECODE_ADDRESSES; a++)
+	{
+		output_t *	out = chunk->output[a];
+
+		frames[a] += chunk->frames[a];
+		if (out == NULL)
+			continue;
+		if (files[a] == NULL)
+		{
+			snprintf(name, sizeof(name), "%s_%02x.%s", prefix, a, pool.raw ? "bin" : "txt");
+			if ((files[a] = fopen(name, "wb")) == NULL)
+			{
+				perror(name);
+				exit(1);
+			}
+		}
+		fwrite(out->data, 1, out->size, files[a]);
+		free(out->data);
+		free(out);
+		chunk->output[a] = NULL;
+	}
+	for (int e = 0; e <= VCP_ESC_ERR; e++)
+		errors[e] += chunk->errors[e];
+}
+
+int main (int argc, char **argv)
+{
+	static FILE *	files[DECODE_ADDRESSES];
+	static uint64_t	frames[DECODE_ADDRESSES];
+	uint64_t		errors[VCP_ESC_ERR + 1] = { 0 }, total = 0, stolen;
+	const char *	prefix = "pass";
+	int				threads = sysconf(_SC_NPROCESSORS_ONLN), opt, fd;
+	long			chunk_mb = 16, window = 4, frame_buff = DECODE_FRAME_BUFF;
+	uint64_t		chunk_size;
+	uint32_t		count, queued = 0;
+	struct stat		st;
+	double			t0;
+
+	while ((opt = getopt(argc, argv, "c:f:j:o:rw:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'c':	chunk_mb = atol(optarg);		break;
+			case 'f':	frame_buff = atol(optarg);		break;
+			case 'j':	threads = atoi(optarg);			break;
+			case 'o':	prefix = optarg;				break;
+			case 'r':	pool.raw = 1;					break;
+			case 'w':	window = atol(optarg);			break;
+			default:
+				fprintf(stderr, "usage: %s [-j threads] [-c chunk MB] [-w window] [-f frame buffer] [-o prefix] [-r] archive\n", argv[0]);
+				return 1;
+		}
+	}
+	if (optind >= argc || threads < 1 || threads > DECODE_THREADS || chunk_mb < 1 || window < 1 ||
+		frame_buff < 2 || frame_buff > 65536)
+	{
+		fprintf(stderr, "usage: %s [-j threads 1-%d] [-c chunk MB] [-w window] [-f frame buffer 2-65536] [-o prefix] [-r] archive\n",
+				argv[0], DECODE_THREADS);
+		return 1;
+	}
+
+	// Map the archive
+	if ((fd = open(argv[optind], O_RDONLY)) < 0 || fstat(fd, &st) < 0)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+	if (st.st_size == 0)
+	{
+		fprintf(stderr, "%s: empty\n", argv[optind]);
+		return 1;
+	}
+	if ((pool.archive = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+	{
+		perror("mmap");
+		return 1;
+	}
+	madvise((void *)pool.archive, st.st_size, MADV_SEQUENTIAL);
+
+	// Enough chunks for every thread to have a few, even for a small archive
+	chunk_size = (uint64_t)chunk_mb << 20;
+	if ((uint64_t)st.st_size / (threads * 4) < chunk_size)
+		chunk_size = st.st_size / (threads * 4);
+	if (chunk_size < DECODE_CHUNK_MIN)
+		chunk_size = DECODE_CHUNK_MIN;
+
+	t0 = seconds();
+	count = chunks_cut(pool.archive, st.st_size, chunk_size, &pool.chunks);
+	if (pool.chunks == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	pool.frame_buff = frame_buff;
+	pool_start(threads, window * threads);
+
+	// Deal the chunks out, at most window per thread ahead of the writer, and write them in order
+	for (uint32_t next = 0; next < count; next++)
+	{
+		for (; queued < count && queued < next + window * threads; queued++)
+			pool_queue(queued);
+
+		pthread_mutex_lock(&pool.lock);
+		while (!pool.chunks[next].done)
+			pthread_cond_wait(&pool.done, &pool.lock);
+		pthread_mutex_unlock(&pool.lock);
+
+		chunk_write(&pool.chunks[next], files, prefix, frames, errors);
+	}
+	stolen = pool_stop();
+
+	for (int a = 0; a < DECODE_ADDRESSES; a++)
+	{
+		if (files[a])
+			fclose(files[a]);
+		if (frames[a])
+			fprintf(stderr, "address 0x%02x: %llu frames\n", a, (unsigned long long)frames[a]);
+		total += frames[a];
+	}
+	fprintf(stderr, "%llu bytes, %llu frames, errors: overflow %llu crc %llu address %llu escape %llu\n",
+			(unsigned long long)st.st_size, (unsigned long long)total,
+			(unsigned long long)errors[VCP_OVR_ERR], (unsigned long long)errors[VCP_CRC_ERR],
+			(unsigned long long)errors[VCP_ADDR_ERR], (unsigned long long)errors[VCP_ESC_ERR]);
+	fprintf(stderr, "%u chunks of %llu KB, %d threads, %llu stolen, %.0f MB/s\n", count,
+			(unsigned long long)(chunk_size >> 10), threads, (unsigned long long)stolen,
+			st.st_size / (seconds() - t0) / 1e6);
+
+	munmap((void *)pool.archive, st.st_size);
+	close(fd);
+	free(pool.chunks);
+	return 0;
+}
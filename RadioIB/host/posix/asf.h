@@ -0,0 +1,44 @@
+/** \file
+ * asf.h
+ * \brief ASF stand-in for the POSIX backend
+ *
+ *	The firmware modules include <asf.h>. For the POSIX build (-Iposix) this header gives them 
+ *	the few ASF definitions the bridge logic uses, on top of the POSIX HAL (hal_posix.h).
+ *	Little endian hosts only, like the XMEGA - MSB() and LSB() pick bytes from memory.
+ */
+
+#ifndef ASF_POSIX_H_
+#define ASF_POSIX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "hal/hal.h"
+
+typedef unsigned char		Bool;					///< Boolean, as ASF compiler.h
+
+#define MSB(u16)			(((uint8_t*)&u16)[1])	///< Most significant byte of u16
+#define LSB(u16)			(((uint8_t*)&u16)[0])	///< Least significant byte of u16
+#define MSB0W(u32)			(((uint8_t*)&(u32))[3])	///< Most significant byte of u32
+#define MSB1W(u32)			(((uint8_t*)&(u32))[2])
+#define MSB2W(u32)			(((uint8_t*)&(u32))[1])
+#define MSB3W(u32)			(((uint8_t*)&(u32))[0])	///< Least significant byte of u32
+
+// Program memory is plain memory
+#define PROGMEM_DECLARE(type, name)	const type name
+#define PROGMEM_READ_BYTE(x)		(*(x))
+#define PROGMEM_READ_WORD(x)		(*(x))
+
+// Pin masks, as the XMEGA device header
+#define PIN0_bm				0x01
+#define PIN1_bm				0x02
+#define PIN2_bm				0x04
+#define PIN3_bm				0x08
+#define PIN4_bm				0x10
+#define PIN5_bm				0x20
+#define PIN6_bm				0x40
+#define PIN7_bm				0x80
+
+#endif /* ASF_POSIX_H_ */
@@ -0,0 +1,553 @@
+/** \file
+ * radio_channel.c
+ * \brief Radio channel simulator between the Radio IB and a ground station
+ *
+ *	Stands in for the radio pair and the air between them. One end is the radio UART of the
+ *	bridge (a board on a USB-serial adapter, or the radio pseudo-terminal of radioib_posix),
+ *	the other a new pseudo-terminal for the ground station (link_stress, a ground program).
+ *	Its name is printed at the start. Per direction ("down" bridge to ground, "up" ground to bridge):
+ *
+ * *	UART - the bytes reach the radio at the -b baud rate (8N1)
+ * *	Radio FIFO - -q bytes. The radio takes bytes from the UART while the FIFO has room and
+ *		drops them when it is full, like the real one (see RADIO_PACING_BURST)
+ * *	Air - 8 bits per byte at -a bps, one byte after the other while the FIFO has bytes.
+ *		Half duplex with -k: one direction at a time, the air changes hands when the FIFO
+ *		of the sender is empty, after a turnaround of -k ms
+ * *	Errors - Gilbert-Elliott channel, -g p:r:good BER:bad BER - per bit it goes from good to
+ *		bad with p, back with r, and flips the bit with the BER of its state. -e BER for a
+ *		channel with the good state only
+ * *	Fading - -f up:down seconds, the link is there for up seconds then gone for down
+ *		seconds, from the start. Bytes on the air in a fade are lost. Pass length windows: -f 600:5400
+ * *	Latency - -l ms from the end of a byte on the air to the receiving radio UART
+ *
+ *	The channel runs in steps of one bit time and draws the state changes and the bit errors of
+ *	every step from -S, whether a byte is on the air or not - the same seed is the same channel
+ *	trace, so pacing, ARQ and FEC modes can be compared on it.
+ *
+ *	At the end (-t seconds, or Ctrl-C) it prints per direction the bytes and VCP frames that went
+ *	in, the bytes lost in the FIFO and in fades, the bit errors, the frames delivered with a
+ *	good CRC and the goodput (their bytes). -c prints CSV lines instead (a '#' header first).
+ *
+ *	Usage: radio_channel [-b baud] [-a air bps] [-q FIFO bytes] [-k turnaround ms] [-l latency ms]
+ *	                     [-e BER] [-g p:r:good BER:bad BER] [-f up:down seconds] [-t seconds] [-S seed] [-c]
+ *	                     bridge_radio_device
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vcp_library.h"
+#include "../RadioIB/src/config/conf_radio_link.h"
+
+#define CHANNEL_QUEUE			65536				///< Bytes in a UART or air queue, power of 2
+#define CHANNEL_FRAME_BUFF		1024				///< Decoded frame buffer size
+#define CHANNEL_DIRECTIONS		2					///< down, up
+
+/// Byte with a time
+typedef struct {
+	uint8_t			byte;
+	int64_t			time;							///< ns for the UART queue, bit step for the air queue
+} entry_t;
+
+/// Queue of bytes with times
+typedef struct {
+	entry_t			entry[CHANNEL_QUEUE];
+	uint32_t		in, out;
+} queue_t;
+
+/// VCP frame counter on a byte stream
+typedef struct {
+	vcp_ptrbuffer	vcp;
+	uint8_t			buff[CHANNEL_FRAME_BUFF];
+	long			frames;							///< Frames with a good CRC
+	long			errors;							///< Frames with VCP errors
+	double			bytes;							///< Bytes of the good frames
+} counter_t;
+
+/// One direction
+typedef struct {
+	const char *	name;
+	int				in_fd, out_fd;					///< Sending radio UART, receiving radio UART
+	int64_t			uart_free;						///< ns the UART line is free for the next byte
+	queue_t			uart;							///< Bytes on the sending UART, by the time they reach the radio
+	queue_t			fifo;							///< Radio FIFO (time unused)
+	queue_t			air;							///< Bytes on the way, by the step they reach the receiving radio
+	uint32_t		prng;							///< Bit error draws
+	int				tx_bits;						///< Bits of the byte on the air sent so far, 0 - none on the air
+	uint8_t			tx_byte;						///< Byte on the air
+	int				tx_faded;						///< It was on the air in a fade
+	int				tx_error;						///< It has bit errors
+	counter_t		sent, delivered;				///< Frames that went in, that came out
+	long			in_bytes, fifo_lost, air_bytes, fade_lost, bit_errors, error_bytes, out_bytes, out_lost;
+	int64_t			air_steps;						///< Steps with a byte on the air
+} direction_t;
+
+static volatile int	stop;							///< Ctrl-C
+
+/**
+ * Name         : now_ns
+ *
+ * Synopsis     : static int64_t now_ns (void)
+ *
+ * \return		Monotonic time in ns
+ */
+static int64_t now_ns (void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (int64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+/**
+ * Name         : prng
+ *
+ * Synopsis     : static uint32_t prng (uint32_t *state)
+ *
+ * Description  : xorshift32 step
+ */
+static uint32_t prng (uint32_t *state)
+{
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+/**
+ * Name         : threshold
+ *
+ * Synopsis     : static uint32_t threshold (double p)
+ *
+ * \return		prng() values below this come with probability p
+ */
+static uint32_t threshold (double p)
+{
+	if (p <= 0)
+		return 0;
+	if (p >= 1)
+		return UINT32_MAX;
+	return (uint32_t)(p * 4294967296.0);
+}
+
+static uint32_t	queue_count	(const queue_t *q)						{ return q->in - q->out; }
+static entry_t *queue_head	(queue_t *q)							{ return &q->entry[q->out % CHANNEL_QUEUE]; }
+
+/**
+ * Name         : queue_put
+ *
+ * Synopsis     : static int queue_put (queue_t *q, uint32_t limit, uint8_t byte, int64_t time)
+ *
+ * \return		1, 0 if the queue holds limit bytes - the byte is dropped
+ */
+static int queue_put (queue_t *q, uint32_t limit, uint8_t byte, int64_t time)
+{
+	entry_t *e;
+
+	if (queue_count(q) >= limit)
+		return 0;
+	e = &q->entry[q->in++ % CHANNEL_QUEUE];
+	e->byte = byte;
+	e->time = time;
+	return 1;
+}
+
+/**
+ * Name         : count_byte
+ *
+ * Synopsis     : static void count_byte (counter_t *c, uint8_t byte)
+ *
+ * Description  : Decode one byte of the stream, count the frames
+ */
+static void count_byte (counter_t *c, uint8_t byte)
+{
+	uint8_t status;
+
+	// Back to back frames - FEND FEND between them
+	if (c->vcp.status == VCP_ADDRESS && byte == FEND)
+		return;
+
+	status = Receive_VCP_byte(&c->vcp, byte);
+	if (status == VCP_TERM)
+	{
+		c->frames++;
+		c->bytes += c->vcp.index;
+	}
+	else if (status >= VCP_OVR_ERR && status <= VCP_ESC_ERR)
+		c->errors++;
+	else
+		return;
+
+	vcpptr_init(&c->vcp, c->buff, sizeof(c->buff));
+	if (byte == FEND)
+		Receive_VCP_byte(&c->vcp, FEND);
+}
+
+/**
+ * Name         : open_bridge
+ *
+ * Synopsis     : static int open_bridge (const char *name, uint32_t baud)
+ *
+ * Description  : Open the bridge radio UART raw at the baud rate (just raw for a pseudo-terminal)
+ *
+ * \return		File descriptor, -1 on error
+ */
+static int open_bridge (const char *name, uint32_t baud)
+{
+	static const struct { uint32_t baud; speed_t speed; } speeds[] = {
+		{ 9600, B9600 }, { 19200, B19200 }, { 38400, B38400 }, { 57600, B57600 }, { 115200, B115200 },
+		{ 230400, B230400 }, { 460800, B460800 }, { 921600, B921600 }
+	};
+	struct termios	tio;
+	speed_t			speed = 0;
+	int				fd = open(name, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if (fd < 0)
+	{
+		perror(name);
+		return -1;
+	}
+	if (tcgetattr(fd, &tio) < 0)
+		return fd;											// Not a terminal - a pipe or a socket
+
+	for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+		if (speeds[i].baud == baud)
+			speed = speeds[i].speed;
+	if (speed == 0)
+	{
+		fprintf(stderr, "%s: unsupported baud rate %u\n", name, baud);
+		return -1;
+	}
+
+	cfmakeraw(&tio);
+	cfsetispeed(&tio, speed);
+	cfsetospeed(&tio, speed);
+	if (tcsetattr(fd, TCSANOW, &tio) < 0)
+	{
+		perror(name);
+		return -1;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return fd;
+}
+
+/**
+ * Name         : open_ground
+ *
+ * Synopsis     : static int open_ground (char *name, size_t name_size)
+ *
+ * Description  : New raw pseudo-terminal for the ground station. The slave side is kept open,
+ *				  so the master does not hang up between the programs that use it
+ *
+ * \return		Master file descriptor, -1 on error. name is the slave device
+ */
+static int open_ground (char *name, size_t name_size)
+{
+	struct termios	tio;
+	int				fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if (fd < 0)
+		return -1;
+	if (grantpt(fd) < 0 || unlockpt(fd) < 0 || ptsname_r(fd, name, name_size) != 0 || open(name, O_RDWR | O_NOCTTY) < 0)
+	{
+		close(fd);
+		return -1;
+	}
+	if (tcgetattr(fd, &tio) == 0)
+	{
+		cfmakeraw(&tio);
+		tcsetattr(fd, TCSANOW, &tio);
+	}
+	return fd;
+}
+
+/**
+ * Name         : uart_read
+ *
+ * Synopsis     : static int uart_read (direction_t *d, int64_t now, int64_t byte_ns)
+ *
+ * Description  : Read what the sending end wrote, time it on its UART
+ *
+ * \return		0, -1 on error
+ */
+static int uart_read (direction_t *d, int64_t now, int64_t byte_ns)
+{
+	uint8_t	buff[512];
+	ssize_t	n = read(d->in_fd, buff, sizeof(buff));
+
+	if (n < 0)
+	{
+		if (errno == EAGAIN || errno == EINTR || errno == EIO)	// EIO - nobody on the pseudo-terminal yet
+			return 0;
+		perror(d->name);
+		return -1;
+	}
+	for (ssize_t i = 0; i < n; i++)
+	{
+		if (d->uart_free < now)
+			d->uart_free = now;
+		d->uart_free += byte_ns;
+		queue_put(&d->uart, CHANNEL_QUEUE, buff[i], d->uart_free);
+		count_byte(&d->sent, buff[i]);
+		d->in_bytes++;
+	}
+	return 0;
+}
+
+/**
+ * Name         : deliver
+ *
+ * Synopsis     : static void deliver (direction_t *d, int64_t step)
+ *
+ * Description  : Write the bytes that reached the receiving radio by this step to its UART
+ */
+static void deliver (direction_t *d, int64_t step)
+{
+	uint8_t		buff[512];
+	size_t		n = 0;
+	ssize_t		done;
+
+	while (queue_count(&d->air) && queue_head(&d->air)->time <= step && n < sizeof(buff))
+	{
+		buff[n] = queue_head(&d->air)->byte;
+		count_byte(&d->delivered, buff[n++]);
+		d->air.out++;
+	}
+	if (n == 0)
+		return;
+
+	done = write(d->out_fd, buff, n);
+	if (done < 0)
+		done = 0;
+	d->out_bytes +=	done;
+	d->out_lost +=	n - done;				// Nobody reading at the other end
+}
+
+/**
+ * Name         : print_report
+ *
+ * Synopsis     : static void print_report (const direction_t *d, double seconds, int64_t steps, int csv, const char *config)
+ */
+static void print_report (const direction_t *d, double seconds, int64_t steps, int csv, const char *config)
+{
+	double	goodput = d->delivered.bytes * 8 / seconds;
+	double	air = steps ? 100.0 * d->air_steps / steps : 0;
+
+	if (csv)
+	{
+		printf("%s%s,%.1f,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%.0f,%.1f\n", d->name, config, seconds,
+			   d->in_bytes, d->sent.frames, d->fifo_lost, d->air_bytes, d->fade_lost, d->bit_errors,
+			   d->error_bytes, d->out_lost, d->delivered.frames, d->delivered.errors, goodput, air);
+		return;
+	}
+	printf("%-5s %8ld %7ld %8ld %8ld %8ld %8ld %8ld %8ld %7ld %7ld %10.0f %5.1f\n", d->name,
+		   d->in_bytes, d->sent.frames, d->fifo_lost, d->air_bytes, d->fade_lost, d->bit_errors,
+		   d->error_bytes, d->out_lost, d->delivered.frames, d->delivered.errors, goodput, air);
+}
+
+static void on_signal (int sig)
+{
+	(void)sig;
+	stop = 1;
+}
+
+int main (int argc, char **argv)
+{
+	static direction_t	dir[CHANNEL_DIRECTIONS] = { { .name = "down", .prng = 0x00D0D0D0 }, { .name = "up", .prng = 0x00F00F00 } };
+	uint32_t			baud = 115200, air_bps = RADIO_PACING_RATE ? RADIO_PACING_RATE * 10 : 9600;
+	uint32_t			fifo_size = RADIO_PACING_BURST, state_prng;
+	double				seconds = 0, latency_ms = 0, turnaround_ms = -1, fade_up = 0, fade_down = 0;
+	double				p_gb = 0, p_bg = 1, ber_good = 0, ber_bad = 0;
+	uint32_t			t_gb, t_bg, t_good, t_bad;
+	int64_t				start, now, step = 0, target, byte_ns, latency, turnaround, fade_period, fade_up_steps, handover = 0;
+	long				seed = 1, turnarounds = 0;
+	int					csv = 0, opt, bad = 0, owner = -1, i;
+	char				ground_name[64], config[256];
+
+	while ((opt = getopt(argc, argv, "b:a:q:k:l:e:g:f:t:S:c")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':	baud =			strtoul(optarg, NULL, 0);	break;
+			case 'a':	air_bps =		strtoul(optarg, NULL, 0);	break;
+			case 'q':	fifo_size =		strtoul(optarg, NULL, 0);	break;
+			case 'k':	turnaround_ms =	atof(optarg);				break;
+			case 'l':	latency_ms =	atof(optarg);				break;
+			case 'e':	ber_good =		atof(optarg);				break;
+			case 't':	seconds =		atof(optarg);				break;
+			case 'S':	seed =			atol(optarg);				break;
+			case 'c':	csv = 1;									break;
+			case 'g':
+				if (sscanf(optarg, "%lf:%lf:%lf:%lf", &p_gb, &p_bg, &ber_good, &ber_bad) != 4)
+				{
+					fprintf(stderr, "-g p:r:good BER:bad BER\n");
+					return 2;
+				}
+				break;
+			case 'f':
+				if (sscanf(optarg, "%lf:%lf", &fade_up, &fade_down) != 2 || fade_up <= 0 || fade_down < 0)
+				{
+					fprintf(stderr, "-f up:down seconds\n");
+					return 2;
+				}
+				break;
+			default:
+				fprintf(stderr, "usage: %s [-b baud] [-a air bps] [-q FIFO bytes] [-k turnaround ms] [-l latency ms]\n"
+						"       [-e BER] [-g p:r:good BER:bad BER] [-f up:down seconds] [-t seconds] [-S seed] [-c]\n"
+						"       bridge_radio_device\n", argv[0]);
+				return 2;
+		}
+	}
+	if (optind + 1 != argc || air_bps == 0 || baud == 0 || fifo_size == 0 || fifo_size > CHANNEL_QUEUE)
+	{
+		fprintf(stderr, "%s: the bridge radio device is needed, air rate, baud rate and FIFO size above 0\n", argv[0]);
+		return 2;
+	}
+
+	if ((dir[0].in_fd = open_bridge(argv[optind], baud)) < 0)
+		return 2;
+	if ((dir[1].in_fd = open_ground(ground_name, sizeof(ground_name))) < 0)
+	{
+		perror("pseudo-terminal");
+		return 2;
+	}
+	dir[0].out_fd = dir[1].in_fd;
+	dir[1].out_fd = dir[0].in_fd;
+	printf("%sground %s\n", csv ? "# " : "", ground_name);
+	fflush(stdout);
+
+	// Everything in bit steps of the air rate
+	state_prng =	(uint32_t)seed * 2654435761u | 1;
+	for (i = 0; i < CHANNEL_DIRECTIONS; i++)
+	{
+		dir[i].prng ^= (uint32_t)seed;
+		vcpptr_init(&dir[i].sent.vcp, dir[i].sent.buff, sizeof(dir[i].sent.buff));
+		vcpptr_init(&dir[i].delivered.vcp, dir[i].delivered.buff, sizeof(dir[i].delivered.buff));
+	}
+	t_gb =			threshold(p_gb);
+	t_bg =			threshold(p_bg);
+	t_good =		threshold(ber_good);
+	t_bad =			threshold(ber_bad);
+	byte_ns =		10 * 1000000000LL / baud;						// 8N1
+	latency =		(int64_t)(latency_ms * air_bps / 1000);
+	turnaround =	(int64_t)(turnaround_ms * air_bps / 1000);
+	fade_period =	(int64_t)((fade_up + fade_down) * air_bps);
+	fade_up_steps =	(int64_t)(fade_up * air_bps);
+	snprintf(config, sizeof(config), csv ? ",%u,%u,%u,%g,%g,%g,%g,%g,%g,%g,%g,%ld" : "",
+			 baud, air_bps, fifo_size, turnaround_ms, latency_ms, p_gb, p_bg, ber_good, ber_bad, fade_up, fade_down, seed);
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+	start = now_ns();
+
+	while (!stop && (seconds <= 0 || now_ns() - start < seconds * 1e9))
+	{
+		struct pollfd	fds[CHANNEL_DIRECTIONS] = { { dir[0].in_fd, POLLIN, 0 }, { dir[1].in_fd, POLLIN, 0 } };
+
+		poll(fds, CHANNEL_DIRECTIONS, 1);
+		now = now_ns() - start;
+		for (i = 0; i < CHANNEL_DIRECTIONS; i++)
+			if (uart_read(&dir[i], now, byte_ns) < 0)
+				return 2;
+
+		// Run the channel up to now, one bit time at a time
+		for (target = now * air_bps / 1000000000; step < target; step++)
+		{
+			int64_t	step_ns = step * 1000000000 / air_bps;
+			int		faded = fade_period && (step % fade_period) >= fade_up_steps;
+
+			if (prng(&state_prng) < (bad ? t_bg : t_gb))
+				bad = !bad;
+
+			for (i = 0; i < CHANNEL_DIRECTIONS; i++)
+			{
+				direction_t *	d = &dir[i];
+				int				error = prng(&d->prng) < (bad ? t_bad : t_good);
+
+				// UART into the radio FIFO
+				while (queue_count(&d->uart) && queue_head(&d->uart)->time <= step_ns)
+				{
+					if (!queue_put(&d->fifo, fifo_size, queue_head(&d->uart)->byte, 0))
+						d->fifo_lost++;
+					d->uart.out++;
+				}
+
+				// Next byte on the air - half duplex: when this side has the air
+				if (d->tx_bits == 0 && queue_count(&d->fifo))
+				{
+					if (turnaround >= 0 && owner != i)
+					{
+						if (owner >= 0 && queue_count(&dir[owner].fifo) + dir[owner].tx_bits)
+							continue;								// The other side is still sending
+						if (owner >= 0)
+						{
+							owner =		-1;							// Its FIFO ran empty, turn around
+							handover =	step + turnaround;
+							turnarounds++;
+						}
+						if (step < handover)
+							continue;
+						owner = i;
+					}
+					d->tx_byte =	queue_head(&d->fifo)->byte;
+					d->tx_faded =	0;
+					d->tx_error =	0;
+					d->fifo.out++;
+				}
+				else if (d->tx_bits == 0)
+				{
+					continue;
+				}
+
+				// One bit on the air
+				d->air_steps++;
+				d->tx_faded |= faded;
+				if (error)
+				{
+					d->tx_byte ^= (uint8_t)(1 << d->tx_bits);
+					d->tx_error = 1;
+					d->bit_errors++;
+				}
+				if (++d->tx_bits < 8)
+					continue;
+
+				d->tx_bits = 0;
+				d->air_bytes++;
+				if (d->tx_faded)
+					d->fade_lost++;
+				else
+				{
+					d->error_bytes += d->tx_error;
+					queue_put(&d->air, CHANNEL_QUEUE, d->tx_byte, step + latency);
+				}
+			}
+		}
+
+		for (i = 0; i < CHANNEL_DIRECTIONS; i++)
+			deliver(&dir[i], step);
+	}
+
+	seconds = (now_ns() - start) / 1e9;
+	if (csv)
+		printf("#dir,baud,air_bps,fifo,turnaround_ms,latency_ms,p_gb,p_bg,ber_good,ber_bad,fade_up,fade_down,seed,seconds,"
+			   "in_bytes,in_frames,fifo_lost,air_bytes,fade_lost,bit_errors,error_bytes,out_lost,frames,frame_errors,goodput_bps,air_pct\n");
+	else
+		printf("%.1f s, air %u bps, FIFO %u bytes, %s, %ld turnarounds\n"
+			   "dir   in_bytes  frames fifo_lost air_bytes fade_lost bit_errs err_byte out_lost  frames  errors goodput_bps  air%%\n",
+			   seconds, air_bps, fifo_size, turnaround >= 0 ? "half duplex" : "full duplex", turnarounds);
+	for (i = 0; i < CHANNEL_DIRECTIONS; i++)
+		print_report(&dir[i], seconds, step, csv, config);
+
+	return 0;
+}
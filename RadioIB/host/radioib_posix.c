@@ -0,0 +1,68 @@
+/** \file
+ * radioib_posix.c
+ * \brief Radio IB bridge as a Linux process
+ *
+ *	Runs the firmware bridge logic on the POSIX HAL, with each UART on a pseudo-terminal.
+ *	The slave device names are printed at the start - connect the CDHIB side and the
+ *	radio side to them (a ground station simulator, socat, the host tools).
+ *
+ *	Usage: radioib_posix [-b baud] [-w capture]
+ *		-b	receive rate limit of the radio and CDHIB UARTs, as a 8N1 line (default 115200, 0 for none)
+ *		-w	record the received bytes to a capture file, for rx_replay
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <asf.h>
+#include "bridge_posix.h"
+#include "config/conf_usart_serial.h"
+
+int main (int argc, char **argv)
+{
+	char		radio_name[64], cdhib_name[64], debug_name[64];
+	int			radio_fd, cdhib_fd, debug_fd;
+	uint32_t	baudrate = CDHIB_UART_BAUDRATE;
+	FILE *		capture = NULL;
+	int			opt;
+
+	while ((opt = getopt(argc, argv, "b:w:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':	baudrate = strtoul(optarg, NULL, 0);	break;
+			case 'w':
+				capture = fopen(optarg, "wb");
+				if (!capture)
+				{
+					perror(optarg);
+					return 1;
+				}
+				break;
+			default:
+				fprintf(stderr, "usage: %s [-b baud] [-w capture]\n", argv[0]);
+				return 2;
+		}
+	}
+
+	// Receive handlers are attached by bridge_posix_init()
+	radio_fd = hal_posix_uart_pty(&RADIO_UART, NULL, 0, radio_name, sizeof(radio_name));
+	cdhib_fd = hal_posix_uart_pty(&CDHIB_UART, NULL, 0, cdhib_name, sizeof(cdhib_name));
+	debug_fd = hal_posix_uart_pty(&DEBUG_UART, NULL, 0, debug_name, sizeof(debug_name));
+	if (radio_fd < 0 || cdhib_fd < 0 || debug_fd < 0)
+	{
+		perror("pseudo-terminal");
+		return 1;
+	}
+
+	printf("radio %s\ncdhib %s\ndebug %s\n", radio_name, cdhib_name, debug_name);
+	fflush(stdout);
+
+	bridge_posix_init(radio_fd, cdhib_fd, debug_fd, baudrate);
+	if (capture)
+		bridge_posix_capture(capture);
+	bridge_posix_run();
+
+	return 0;
+}
@@ -0,0 +1,252 @@
+/** \file
+ * rx_replay.c
+ * \brief Replay a receive capture through the Radio IB bridge
+ *
+ *	Feeds the bytes of a capture (../RadioIB/src/debug/rx_capture.h - from radioib_posix -w,
+ *	or dlog_decode -x of a board log with RX_CAPTURE) into the bridge on the POSIX HAL, with
+ *	the captured timing, on a virtual clock. Nothing depends on the host speed or threads,
+ *	so the same capture always gives the same run - a field problem can be replayed under a
+ *	debugger, and a change can be checked against the same traffic before and after.
+ *
+ *	The main loop is modelled as one scheduler pass every -l us of virtual time, the receive
+ *	interrupts come at the capture times in between. Bytes of one link are no closer than the
+ *	-b line rate - host captures have the bytes of a read() chunk at the same time.
+ *
+ *	At the end it prints per link the bytes fed, the frames received, the VCP receive errors
+ *	and the ring buffer overflows, the debug log records dropped, and the bytes and FNV-1a
+ *	hash of what the bridge sent on each UART. Equal hashes - the bridge did the same.
+ *	-t adds the host CPU time per byte, which does change from run to run.
+ *
+ *	Usage: rx_replay [-b baud] [-s time scale] [-l loop us] [-w drain ms] [-t] [-c] capture
+ *		-b	line rate the bytes of a link are spaced to (default 115200, 0 for the capture times only)
+ *		-s	time scale - 2 replays at half speed, 0.5 at double (default 1)
+ *		-l	main loop period in us (default 50)
+ *		-w	time to run on after the last byte, ms (default 100)
+ *		-t	print the host CPU time per byte
+ *		-c	print CSV lines instead (a '#' header first)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <asf.h>
+#include "bridge_posix.h"
+#include "config/conf_usart_serial.h"
+#include "debug/rx_capture.h"
+#include "memory/memory.h"
+#include "scheduler/scheduler.h"
+
+#define REPLAY_LINKS		2				///< CDHIB, radio
+
+/// Replayed link
+typedef struct {
+	const char *	name;					///< Report name
+	peripheral_t *	peripheral;				///< Receiving peripheral
+	hal_uart_t *	uart;					///< Its UART
+	uint32_t		bytes;					///< Bytes fed
+	int64_t			free_ns;				///< The line is free for the next byte at this time
+} replay_link_t;
+
+static replay_link_t	links[REPLAY_LINKS] = {
+	{ "cdhib",	&cdhib,	&CDHIB_UART,	0, 0 },
+	{ "radio",	&radio,	&RADIO_UART,	0, 0 },
+};
+
+/**
+ * Name         : read_capture
+ *
+ * Synopsis     : static uint8_t *read_capture (const char *path, size_t *size, uint32_t *tick_ns)
+ *
+ * \param	path	Capture file
+ * \param	size	Set to the size of the records
+ * \param	tick_ns	Set to the tick length of the capture
+ *
+ * \return			The records, NULL on error (printed)
+ */
+static uint8_t *read_capture (const char *path, size_t *size, uint32_t *tick_ns)
+{
+	FILE *		in = fopen(path, "rb");
+	uint8_t		header[RX_CAPTURE_HEADER_SIZE];
+	uint8_t *	data = NULL;
+	size_t		got = 0, alloc = 0;
+
+	if (!in)
+	{
+		perror(path);
+		return NULL;
+	}
+	if (fread(header, 1, sizeof(header), in) != sizeof(header) || memcmp(header, "RXCP", 4) || header[4] != RX_CAPTURE_VERSION)
+	{
+		fprintf(stderr, "rx_replay: %s is not a version %u capture\n", path, RX_CAPTURE_VERSION);
+		fclose(in);
+		return NULL;
+	}
+	*tick_ns = header[6] | (header[7] << 8);
+
+	for (;;)
+	{
+		if (got == alloc)
+		{
+			alloc = alloc ? 2 * alloc : 65536;
+			data = realloc(data, alloc);
+			if (!data)
+			{
+				perror("rx_replay");
+				exit(1);
+			}
+		}
+		size_t n = fread(data + got, 1, alloc - got, in);
+		if (!n)
+			break;
+		got += n;
+	}
+	fclose(in);
+
+	if (got % RX_CAPTURE_RECORD_SIZE)
+		fprintf(stderr, "rx_replay: %s ends in a partial record, ignored\n", path);
+	*size = got - got % RX_CAPTURE_RECORD_SIZE;
+	return data;
+}
+
+/**
+ * Name         : find_link
+ *
+ * Synopsis     : static replay_link_t *find_link (uint8_t address)
+ *
+ * \return		The link of the peripheral with this VCP address, NULL for none
+ */
+static replay_link_t *find_link (uint8_t address)
+{
+	int	i;
+
+	for (i = 0; i < REPLAY_LINKS; i++)
+		if (links[i].peripheral->VCP_address == address)
+			return &links[i];
+	return NULL;
+}
+
+/**
+ * Name         : run_until
+ *
+ * Synopsis     : static void run_until (int64_t ns, int64_t loop_ns, int64_t *pass_ns)
+ *
+ * \param	ns		Virtual time to run to
+ * \param	loop_ns	Main loop period
+ * \param	pass_ns	Time of the next scheduler pass, moved on
+ *
+ * Description  : Run the main loop passes that fall before ns, then move the clock to ns
+ */
+static void run_until (int64_t ns, int64_t loop_ns, int64_t *pass_ns)
+{
+	while (*pass_ns <= ns)
+	{
+		hal_posix_advance_to(*pass_ns);
+		scheduler_pass();
+		*pass_ns += loop_ns;
+	}
+	hal_posix_advance_to(ns);
+}
+
+int main (int argc, char **argv)
+{
+	uint32_t			baudrate = CDHIB_UART_BAUDRATE;
+	double				scale = 1.0;
+	int64_t				loop_ns = 50000, drain_ns = 100000000;
+	int					cpu = 0, csv = 0, opt, i;
+	uint8_t *			data;
+	size_t				size, at;
+	uint32_t			tick_ns, lost = 0, holes = 0, skipped = 0, total = 0;
+	int64_t				byte_ns, capture_ns = 0, now_ns, pass_ns = 0;
+	struct timespec		cpu_start, cpu_end;
+	replay_link_t *		link;
+
+	while ((opt = getopt(argc, argv, "b:s:l:w:tc")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b':	baudrate = strtoul(optarg, NULL, 0);				break;
+			case 's':	scale = atof(optarg);								break;
+			case 'l':	loop_ns = (int64_t)(atof(optarg) * 1000);			break;
+			case 'w':	drain_ns = (int64_t)(atof(optarg) * 1000000);		break;
+			case 't':	cpu = 1;											break;
+			case 'c':	csv = 1;											break;
+			default:
+				fprintf(stderr, "usage: %s [-b baud] [-s time scale] [-l loop us] [-w drain ms] [-t] [-c] capture\n", argv[0]);
+				return 2;
+		}
+	}
+	if (optind >= argc || scale <= 0 || loop_ns <= 0)
+	{
+		fprintf(stderr, "usage: %s [-b baud] [-s time scale] [-l loop us] [-w drain ms] [-t] [-c] capture\n", argv[0]);
+		return 2;
+	}
+	if ((data = read_capture(argv[optind], &size, &tick_ns)) == NULL)
+		return 1;
+	byte_ns = baudrate ? 10 * 1000000000LL / baudrate : 0;		// 8N1
+
+	// The bridge on the virtual clock, no file descriptors - the bytes are injected
+	hal_posix_virtual();
+	bridge_posix_init(-1, -1, -1, 0);
+	bridge_posix_start();
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+	for (at = 0; at < size; at += RX_CAPTURE_RECORD_SIZE)
+	{
+		uint8_t *	record = &data[at];
+
+		capture_ns += (int64_t)((record[2] | (record[3] << 8)) * (double)tick_ns * scale);
+		if (record[0] == RX_CAPTURE_TIME)
+			continue;
+		if (record[0] == RX_CAPTURE_LOST)
+		{
+			lost += record[1];
+			holes++;
+			continue;
+		}
+		if ((link = find_link(record[0])) == NULL)
+		{
+			skipped++;
+			continue;
+		}
+
+		now_ns = capture_ns > link->free_ns ? capture_ns : link->free_ns;
+		link->free_ns = now_ns + byte_ns;
+		run_until(now_ns, loop_ns, &pass_ns);
+		hal_posix_uart_inject(link->uart, record[1]);
+		link->bytes++;
+		total++;
+	}
+	run_until(hal_posix_now() + drain_ns, loop_ns, &pass_ns);
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+	free(data);
+
+	if (csv)
+	{
+		printf("# link,bytes,frames,rx_errors,overflows,tx_bytes,tx_hash\n");
+		for (i = 0; i < REPLAY_LINKS; i++)
+			printf("%s,%u,%u,%u,%u,%u,%08x\n", links[i].name, links[i].bytes, links[i].peripheral->rx_packet_count,
+					links[i].peripheral->rx_error_count, links[i].peripheral->rx_ringbuff_overflow,
+					links[i].uart->tx_bytes, links[i].uart->tx_hash);
+		printf("debug,0,0,0,%u,%u,%08x\n", dlog_dropped, DEBUG_UART.tx_bytes, DEBUG_UART.tx_hash);
+	}
+	else
+	{
+		printf("replayed %u bytes over %.3f s, %u main loop passes\n", total, hal_posix_now() / 1e9, (unsigned)(pass_ns / loop_ns));
+		if (holes || skipped)
+			printf("capture holes %u (%u log records lost), records for unknown links %u\n", holes, lost, skipped);
+		for (i = 0; i < REPLAY_LINKS; i++)
+			printf("%-6s rx %8u bytes %6u frames %4u errors %4u overflows | tx %8u bytes hash %08x\n", links[i].name,
+					links[i].bytes, links[i].peripheral->rx_packet_count, links[i].peripheral->rx_error_count,
+					links[i].peripheral->rx_ringbuff_overflow, links[i].uart->tx_bytes, links[i].uart->tx_hash);
+		printf("%-6s log records dropped %u                              | tx %8u bytes hash %08x\n", "debug",
+				dlog_dropped, DEBUG_UART.tx_bytes, DEBUG_UART.tx_hash);
+	}
+	if (cpu && total)
+		printf("%shost cpu %.1f ns/byte\n", csv ? "# " : "",
+				((cpu_end.tv_sec - cpu_start.tv_sec) * 1e9 + (cpu_end.tv_nsec - cpu_start.tv_nsec)) / total);
+
+	return 0;
+}
@@ -0,0 +1,445 @@
+/** \file
+ * vcp_archive.c
+ * \brief Indexed archive of decoded VCP frames for the host tools
+ *
+ *	See vcp_archive.h. The writer builds a segment in memory and writes it with one fwrite(), so
+ *	a segment in the file is either complete or the last one, cut short. Opening an archive for
+ *	writing cuts such a segment off before appending.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "vcp_archive.h"
+
+#define ALIGN8(size)		(((size) + 7) & ~(size_t)7)		///< Record size, padded
+
+static const char	file_magic[4] =		{ 'V', 'C', 'P', 'A' };
+static const char	segment_magic[4] =	{ 'V', 'C', 'P', 'S' };
+
+/**
+ * Name         : segment_valid
+ *
+ * Synopsis     : static int segment_valid (const vcp_archive_segment_t *s, uint64_t room)
+ *
+ * \param	room	File bytes from the segment header on
+ *
+ * \return			1 for a complete segment with a consistent header
+ */
+static int segment_valid (const vcp_archive_segment_t *s, uint64_t room)
+{
+	return	room >= sizeof(*s) && !memcmp(s->magic, segment_magic, 4) && s->stride &&
+			s->blocks == (s->frames + s->stride - 1) / s->stride && s->size <= room && !(s->size & 7) &&
+			s->size >= sizeof(*s) + (uint64_t)s->blocks * sizeof(vcp_archive_block_t) +
+					   (uint64_t)s->frames * sizeof(vcp_archive_frame_t);
+}
+
+
+/*****************/
+/* Writer        */
+/*****************/
+
+/**
+ * Name         : vcp_archive_create
+ *
+ * Synopsis     : int vcp_archive_create (vcp_archive_writer_t *w, const char *path, uint32_t segment_frames, uint32_t stride)
+ *
+ * \param	segment_frames	Frames per segment, VCP_ARCHIVE_SEGMENT
+ * \param	stride			Frames per index block, VCP_ARCHIVE_STRIDE
+ *
+ * Description  : Open an archive to append to, a new one if there is none. A segment cut short
+ *				  at the end is dropped
+ *
+ * \return			0, -1 on error (errno, or EINVAL for a file that is not an archive)
+ */
+int vcp_archive_create (vcp_archive_writer_t *w, const char *path, uint32_t segment_frames, uint32_t stride)
+{
+	vcp_archive_header_t	header;
+	vcp_archive_segment_t	s;
+	struct stat				st;
+	uint64_t				end;
+
+	memset(w, 0, sizeof(*w));
+	if (!segment_frames || !stride)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	w->segment_frames =	segment_frames;
+	w->stride =			stride;
+
+	if ((w->file = fopen(path, "r+b")) == NULL && (errno != ENOENT || (w->file = fopen(path, "w+b")) == NULL))
+		return -1;
+	fstat(fileno(w->file), &st);
+
+	if (st.st_size == 0)
+	{
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, file_magic, 4);
+		header.version =		VCP_ARCHIVE_VERSION;
+		header.header_size =	sizeof(header);
+		return (fwrite(&header, sizeof(header), 1, w->file) == 1) ? 0 : -1;
+	}
+
+	if (fread(&header, sizeof(header), 1, w->file) != 1 || memcmp(header.magic, file_magic, 4) ||
+		header.version != VCP_ARCHIVE_VERSION || header.header_size != sizeof(header))
+	{
+		fclose(w->file);
+		w->file = NULL;
+		errno = EINVAL;
+		return -1;
+	}
+
+	// Walk the segments to the end of the last complete one
+	for (end = sizeof(header); fseeko(w->file, end, SEEK_SET) == 0 && fread(&s, sizeof(s), 1, w->file) == 1; end += s.size)
+		if (!segment_valid(&s, st.st_size - end))
+			break;
+	if (end < (uint64_t)st.st_size && ftruncate(fileno(w->file), end))
+		return -1;
+	return fseeko(w->file, end, SEEK_SET);
+}
+
+/**
+ * Name         : writer_flush
+ *
+ * Synopsis     : static int writer_flush (vcp_archive_writer_t *w)
+ *
+ * Description  : Write the segment being built, if it has frames, and start a new one
+ *
+ * \return			0, -1 on a write error
+ */
+static int writer_flush (vcp_archive_writer_t *w)
+{
+	vcp_archive_segment_t *	s = &w->segment;
+	size_t					index = s->blocks * sizeof(vcp_archive_block_t);
+	int						ret = 0;
+
+	if (s->frames)
+	{
+		memcpy(s->magic, segment_magic, 4);
+		s->stride =	w->stride;
+		s->size =	sizeof(*s) + index + w->data_size;
+		for (uint32_t b = 0; b < s->blocks; b++)
+			w->blocks[b].offset += sizeof(*s) + index;
+
+		if (fwrite(s, sizeof(*s), 1, w->file) != 1 || fwrite(w->blocks, 1, index, w->file) != index ||
+			fwrite(w->data, 1, w->data_size, w->file) != w->data_size || fflush(w->file))
+			ret = -1;
+		w->segments++;
+		w->frames += s->frames;
+		memset(s, 0, sizeof(*s));
+	}
+	w->data_size = 0;
+	return ret;
+}
+
+/**
+ * Name         : vcp_archive_add
+ *
+ * Synopsis     : int vcp_archive_add (vcp_archive_writer_t *w, uint64_t time_ns, uint8_t link, uint8_t address, uint8_t status,
+ *									   uint16_t crc, const uint8_t *payload, uint16_t size)
+ *
+ * \param	time_ns	Time the frame ended
+ * \param	link	VCP address of the receiving link, 0 if not known
+ * \param	status	VCP_TERM, or VCP_CRC_ERR
+ * \param	crc		CRC as received
+ *
+ * Description  : Add a frame. A new segment starts when the segment is full, and for a frame
+ *				  older than the one before - the frames of a segment stay in time order
+ *
+ * \return			0, -1 on error
+ */
+int vcp_archive_add (vcp_archive_writer_t *w, uint64_t time_ns, uint8_t link, uint8_t address, uint8_t status,
+					 uint16_t crc, const uint8_t *payload, uint16_t size)
+{
+	vcp_archive_segment_t *	s = &w->segment;
+	vcp_archive_frame_t		frame;
+	size_t					record = sizeof(frame) + ALIGN8(size);
+
+	if (s->frames && (s->frames == w->segment_frames || time_ns < s->last_ns ||
+		sizeof(*s) + (s->blocks + 1) * sizeof(vcp_archive_block_t) + w->data_size + record > VCP_ARCHIVE_SEGMENT_MAX))
+	{
+		uint32_t	lost = s->lost;
+
+		if (writer_flush(w))
+			return -1;
+		s->lost = lost;
+	}
+
+	if (w->data_size + record > w->data_capacity)
+	{
+		w->data_capacity = 2 * w->data_capacity + record + 65536;
+		if ((w->data = realloc(w->data, w->data_capacity)) == NULL)
+			return -1;
+	}
+
+	// Index entry for the first frame of a block
+	if (s->frames % w->stride == 0)
+	{
+		if ((s->blocks & (s->blocks - 1)) == 0 &&
+			(w->blocks = realloc(w->blocks, (s->blocks ? 2 * s->blocks : 1) * sizeof(vcp_archive_block_t))) == NULL)
+			return -1;
+		memset(&w->blocks[s->blocks], 0, sizeof(vcp_archive_block_t));
+		w->blocks[s->blocks].time_ns =	time_ns;
+		w->blocks[s->blocks].offset =	w->data_size;
+		s->blocks++;
+	}
+	w->blocks[s->blocks - 1].addresses[address >> 3] |= 1 << (address & 7);
+	s->addresses[address >> 3] |= 1 << (address & 7);
+
+	if (s->frames++ == 0)
+		s->first_ns = time_ns;
+	s->last_ns = time_ns;
+	s->crc_errors += (status == VCP_CRC_ERR);
+
+	memset(&frame, 0, sizeof(frame));
+	frame.time_ns =	time_ns;
+	frame.size =	size;
+	frame.crc =		crc;
+	frame.address =	address;
+	frame.status =	status;
+	frame.link =	link;
+	memcpy(w->data + w->data_size, &frame, sizeof(frame));
+	if (size)
+		memcpy(w->data + w->data_size + sizeof(frame), payload, size);
+	memset(w->data + w->data_size + sizeof(frame) + size, 0, record - sizeof(frame) - size);
+	w->data_size += record;
+	return 0;
+}
+
+/**
+ * Name         : vcp_archive_lost
+ *
+ * Synopsis     : void vcp_archive_lost (vcp_archive_writer_t *w)
+ *
+ * Description  : Count a receive error without a frame - VCP_OVR_ERR, VCP_ADDR_ERR, VCP_ESC_ERR
+ */
+void vcp_archive_lost (vcp_archive_writer_t *w)
+{
+	w->segment.lost++;
+}
+
+/**
+ * Name         : vcp_archive_finish
+ *
+ * Synopsis     : int vcp_archive_finish (vcp_archive_writer_t *w)
+ *
+ * Description  : Write the last segment and close the archive
+ *
+ * \return			0, -1 on a write error
+ */
+int vcp_archive_finish (vcp_archive_writer_t *w)
+{
+	int	ret = writer_flush(w);
+
+	if (fclose(w->file))
+		ret = -1;
+	free(w->blocks);
+	free(w->data);
+	w->file =	NULL;
+	w->blocks =	NULL;
+	w->data =	NULL;
+	return ret;
+}
+
+
+/*****************/
+/* Reader        */
+/*****************/
+
+/**
+ * Name         : vcp_archive_open
+ *
+ * Synopsis     : int vcp_archive_open (vcp_archive_t *a, const char *path)
+ *
+ * Description  : Map an archive and list its complete segments
+ *
+ * \return			0, -1 on error (errno, or EINVAL for a file that is not an archive)
+ */
+int vcp_archive_open (vcp_archive_t *a, const char *path)
+{
+	const vcp_archive_header_t *	header;
+	struct stat						st;
+	size_t							offset, capacity = 0;
+	int								fd;
+
+	memset(a, 0, sizeof(*a));
+	if ((fd = open(path, O_RDONLY)) < 0)
+		return -1;
+	if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(vcp_archive_header_t))
+	{
+		close(fd);
+		errno = EINVAL;
+		return -1;
+	}
+	a->size =	st.st_size;
+	a->map =	mmap(NULL, a->size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (a->map == MAP_FAILED)
+	{
+		a->map = NULL;
+		return -1;
+	}
+
+	header = (const vcp_archive_header_t *)a->map;
+	if (memcmp(header->magic, file_magic, 4) || header->version != VCP_ARCHIVE_VERSION || header->header_size != sizeof(*header))
+	{
+		vcp_archive_unmap(a);
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (offset = sizeof(*header); offset < a->size; )
+	{
+		const vcp_archive_segment_t *	s = (const vcp_archive_segment_t *)(a->map + offset);
+
+		if (!segment_valid(s, a->size - offset))
+			break;
+		if (a->count == capacity)
+		{
+			capacity = capacity ? 2 * capacity : 64;
+			a->segments = realloc(a->segments, capacity * sizeof(*a->segments));
+			if (a->segments == NULL)
+			{
+				vcp_archive_unmap(a);
+				return -1;
+			}
+		}
+		a->segments[a->count++] = s;
+		a->frames += s->frames;
+		offset += s->size;
+	}
+	a->ignored = a->size - offset;
+	return 0;
+}
+
+/**
+ * Name         : vcp_archive_unmap
+ *
+ * Synopsis     : void vcp_archive_unmap (vcp_archive_t *a)
+ *
+ * Description  : Close an archive. The frames from it are gone
+ */
+void vcp_archive_unmap (vcp_archive_t *a)
+{
+	if (a->map)
+		munmap((void *)a->map, a->size);
+	free(a->segments);
+	memset(a, 0, sizeof(*a));
+}
+
+/**
+ * Name         : vcp_archive_query
+ *
+ * Synopsis     : void vcp_archive_query (vcp_archive_query_t *q, const vcp_archive_t *a, uint64_t from_ns, uint64_t to_ns, int address)
+ *
+ * \param	from_ns	First time
+ * \param	to_ns	Last time, UINT64_MAX for the end
+ * \param	address	VCP address, VCP_ARCHIVE_ALL for every address
+ *
+ * Description  : Start a query, for vcp_archive_next()
+ */
+void vcp_archive_query (vcp_archive_query_t *q, const vcp_archive_t *a, uint64_t from_ns, uint64_t to_ns, int address)
+{
+	memset(q, 0, sizeof(*q));
+	q->archive =	a;
+	q->from_ns =	from_ns;
+	q->to_ns =		to_ns;
+	q->address =	address;
+}
+
+/**
+ * Name         : query_start
+ *
+ * Synopsis     : static int query_start (vcp_archive_query_t *q, const vcp_archive_segment_t *s)
+ *
+ * Description  : Find the first block of the segment that can have frames of the query - the one
+ *				  before the first block that starts at or after from_ns
+ *
+ * \return			1, 0 for a segment without frames of the query
+ */
+static int query_start (vcp_archive_query_t *q, const vcp_archive_segment_t *s)
+{
+	const vcp_archive_block_t *	blocks = (const vcp_archive_block_t *)(s + 1);
+	uint32_t					lo = 0, hi = s->blocks;
+
+	if (!s->frames || s->last_ns < q->from_ns || s->first_ns > q->to_ns ||
+		(q->address != VCP_ARCHIVE_ALL && !VCP_ARCHIVE_HAS(s->addresses, q->address)))
+		return 0;
+
+	while (lo < hi)
+	{
+		uint32_t	mid = (lo + hi) / 2;
+
+		if (blocks[mid].time_ns < q->from_ns)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo)
+		lo--;
+	q->frame =	lo * s->stride;
+	q->next =	(const uint8_t *)s + blocks[lo].offset;
+	return 1;
+}
+
+/**
+ * Name         : vcp_archive_next
+ *
+ * Synopsis     : const vcp_archive_frame_t *vcp_archive_next (vcp_archive_query_t *q)
+ *
+ * Description  : The next frame of the query, in file order. Blocks without the address are
+ *				  skipped, and a segment is left at the first frame past to_ns
+ *
+ * \return			The frame, in the archive map - the payload is VCP_ARCHIVE_PAYLOAD(frame). NULL at the end
+ */
+const vcp_archive_frame_t *vcp_archive_next (vcp_archive_query_t *q)
+{
+	const vcp_archive_t *	a = q->archive;
+
+	for (; q->segment < a->count; q->segment++, q->next = NULL)
+	{
+		const vcp_archive_segment_t *	s = a->segments[q->segment];
+		const vcp_archive_block_t *		blocks = (const vcp_archive_block_t *)(s + 1);
+		const uint8_t *					data = (const uint8_t *)(blocks + s->blocks);
+		const uint8_t *					end = (const uint8_t *)s + s->size;
+
+		if (q->next == NULL && !query_start(q, s))
+			continue;
+
+		while (q->frame < s->frames)
+		{
+			const vcp_archive_frame_t *	frame;
+			uint32_t					b = q->frame / s->stride;
+
+			// A block without the address - on to the next one
+			if (q->address != VCP_ARCHIVE_ALL && q->frame % s->stride == 0 && !VCP_ARCHIVE_HAS(blocks[b].addresses, q->address))
+			{
+				if (b + 1 >= s->blocks || blocks[b + 1].time_ns > q->to_ns)
+					break;
+				q->frame += s->stride;
+				q->next = (const uint8_t *)s + blocks[b + 1].offset;
+				continue;
+			}
+
+			// The index and the frames must stay in the segment
+			if (q->next < data || q->next + sizeof(*frame) > end)
+				break;
+			frame = (const vcp_archive_frame_t *)q->next;
+			if ((const uint8_t *)(frame + 1) + ALIGN8(frame->size) > end || frame->time_ns > q->to_ns)
+				break;
+
+			q->next += sizeof(*frame) + ALIGN8(frame->size);
+			q->frame++;
+			q->visited++;
+			if (frame->time_ns >= q->from_ns && (q->address == VCP_ARCHIVE_ALL || frame->address == q->address))
+				return frame;
+		}
+	}
+	return NULL;
+}
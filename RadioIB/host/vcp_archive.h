@@ -0,0 +1,128 @@
+/** \file
+ * vcp_archive.h
+ * \brief Indexed archive of decoded VCP frames for the host tools
+ *
+ *	An archive keeps decoded frames - time, address, payload, received CRC and CRC status - so a
+ *	time window of one address can be read without decoding the captures again. It is written
+ *	in append-only segments and read through a memory map; the frames handed out point into the
+ *	map, nothing is copied.
+ *
+ *	Archive file, all fields little endian, every record 8 byte aligned:
+ * *	File header:	vcp_archive_header_t
+ * *	Segments:		vcp_archive_segment_t, then its index (blocks of vcp_archive_block_t),
+ *					then its frames - vcp_archive_frame_t and the payload, padded to 8 bytes
+ *	The frames of a segment are in time order. The index has an entry for every stride frames:
+ *	the time and offset of the first one, and the addresses in the block. A query finds its start
+ *	by binary search of the index and skips the segments and blocks without its address.
+ *	Segments are only ever added at the end; a segment cut short (a writer that stopped) is
+ *	ignored by the reader.
+ */
+
+
+#ifndef VCP_ARCHIVE_H_
+#define VCP_ARCHIVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "vcp_library.h"
+
+#define VCP_ARCHIVE_VERSION		1			///< Archive file version
+#define VCP_ARCHIVE_STRIDE		64			///< Default frames per index block
+#define VCP_ARCHIVE_SEGMENT		65536		///< Default frames per segment
+#define VCP_ARCHIVE_SEGMENT_MAX	(64u << 20)	///< Largest segment, bytes
+#define VCP_ARCHIVE_ALL			-1			///< Query address: every address
+
+/// File header
+typedef struct {
+	char			magic[4];			///< "VCPA"
+	uint16_t		version;			///< VCP_ARCHIVE_VERSION
+	uint16_t		header_size;		///< sizeof(vcp_archive_header_t)
+	uint32_t		reserved[2];
+} vcp_archive_header_t;
+
+/// Segment header
+typedef struct {
+	char			magic[4];			///< "VCPS"
+	uint32_t		frames;				///< Frames in the segment
+	uint32_t		blocks;				///< Index entries
+	uint32_t		stride;				///< Frames per index block
+	uint64_t		size;				///< Segment bytes, this header included
+	uint64_t		first_ns;			///< Time of the first frame
+	uint64_t		last_ns;			///< Time of the last frame
+	uint32_t		crc_errors;			///< Frames with VCP_CRC_ERR
+	uint32_t		lost;				///< Receive errors without a frame - VCP_OVR_ERR, VCP_ADDR_ERR, VCP_ESC_ERR
+	uint8_t			addresses[32];		///< Bit map of the frame addresses
+} vcp_archive_segment_t;
+
+/// Index entry, a block of stride frames
+typedef struct {
+	uint64_t		time_ns;			///< Time of the first frame
+	uint32_t		offset;				///< Offset of the first frame from the segment header
+	uint32_t		reserved;
+	uint8_t			addresses[32];		///< Bit map of the frame addresses
+} vcp_archive_block_t;
+
+/// Frame, followed by its payload
+typedef struct {
+	uint64_t		time_ns;			///< Time of the FEND that ended the frame
+	uint16_t		size;				///< Payload size, without the CRC
+	uint16_t		crc;				///< CRC as received
+	uint8_t			address;			///< VCP address
+	uint8_t			status;				///< VCP_TERM, or VCP_CRC_ERR
+	uint8_t			link;				///< VCP address of the receiving link, 0 if not known
+	uint8_t			reserved;
+} vcp_archive_frame_t;
+
+#define VCP_ARCHIVE_PAYLOAD(frame)	((const uint8_t *)((frame) + 1))	///< Payload of a frame, in the map
+#define VCP_ARCHIVE_HAS(map, addr)	((map)[(addr) >> 3] & (1 << ((addr) & 7)))	///< Address in a bit map
+
+/// Archive writer
+typedef struct {
+	FILE *			file;
+	uint32_t		stride;				///< Frames per index block
+	uint32_t		segment_frames;		///< Frames per segment
+	vcp_archive_segment_t	segment;	///< Segment being built
+	vcp_archive_block_t *	blocks;		///< Its index
+	uint8_t *		data;				///< Its frames
+	size_t			data_size;
+	size_t			data_capacity;
+	uint64_t		segments;			///< Segments written
+	uint64_t		frames;				///< Frames written
+} vcp_archive_writer_t;
+
+/// Archive reader
+typedef struct {
+	const uint8_t *	map;
+	size_t			size;
+	const vcp_archive_segment_t **	segments;	///< The complete segments, in file order
+	uint32_t		count;
+	uint64_t		frames;
+	size_t			ignored;			///< Bytes after the last complete segment
+} vcp_archive_t;
+
+/// Query - frames of an address (or all) in a time window
+typedef struct {
+	const vcp_archive_t *	archive;
+	uint64_t		from_ns;			///< First time
+	uint64_t		to_ns;				///< Last time
+	int				address;			///< VCP address, VCP_ARCHIVE_ALL
+	uint32_t		segment;			///< Segment being read
+	uint32_t		frame;				///< Next frame in it
+	const uint8_t *	next;				///< Next frame, NULL to find the start in the segment
+	uint64_t		visited;			///< Frames looked at
+} vcp_archive_query_t;
+
+// Functions
+int			vcp_archive_create		(vcp_archive_writer_t *w, const char *path, uint32_t segment_frames, uint32_t stride);
+int			vcp_archive_add			(vcp_archive_writer_t *w, uint64_t time_ns, uint8_t link, uint8_t address, uint8_t status,
+									 uint16_t crc, const uint8_t *payload, uint16_t size);
+void		vcp_archive_lost		(vcp_archive_writer_t *w);
+int			vcp_archive_finish		(vcp_archive_writer_t *w);
+int			vcp_archive_open		(vcp_archive_t *a, const char *path);
+void		vcp_archive_unmap		(vcp_archive_t *a);
+void		vcp_archive_query		(vcp_archive_query_t *q, const vcp_archive_t *a, uint64_t from_ns, uint64_t to_ns, int address);
+const vcp_archive_frame_t *vcp_archive_next	(vcp_archive_query_t *q);
+
+#endif /* VCP_ARCHIVE_H_ */
@@ -0,0 +1,479 @@
+/** \file
+ * vcp_bench.c
+ * \brief Microbenchmarks of the VCP codec and the CRC
+ *
+ *	Times Create_VCP_frame, Receive_VCP_byte (a whole frame), crc16 and append_crc16 (a byte at
+ *	a time, as the codec calls it) on three workloads:
+ * *	escape -	ARQ_MAX_PAYLOAD bytes, all FEND / FESC - the worst case, every byte escaped
+ * *	telemetry -	ARQ_MAX_PAYLOAD bytes of counters and flags, MSB first - the usual downlink
+ * *	minimum -	1 byte payload, the per frame overhead
+ *
+ *	The same source builds for the host and for an AVR8 core:
+ * *	Host (vcp_bench, table CRC as the host tools; vcp_bench_mcu, the bit-wise firmware CRC) -
+ *		ns per call, the best of BENCH_ROUNDS rounds of about BENCH_ROUND_NS each
+ * *	AVR (make avr-bench, -Os and the bit-wise CRC as the firmware) - CPU cycles per call from
+ *		Timer1 at clk/1, run in simavr. simavr has no XMEGA core, so this is the ATmega2560: the
+ *		nearest one it runs, with the 3 byte PC of the ATxmega192A3 (same CALL / RET costs).
+ *		The lines go out on USART0, simavr prints them
+ *
+ *	The ATmega2560 counts are an upper bound for the ATxmega192A3. The XMEGA core takes 1 cycle
+ *	less for ST / STD / PUSH (1 instead of 2), CALL / RCALL / ICALL (4 / 3 / 3 instead of
+ *	5 / 4 / 4); LD / LDD / POP / RET and the ALU instructions are the same. The stores of the
+ *	escaping encoder and the calls per byte of the decoder and append_crc16 make the difference,
+ *	up to a few cycles per byte. Exact counts on the board: SELF_BENCH_COMMAND
+ *
+ *	Output is CSV, one line per function and workload:
+ *		platform,function,workload,bytes,calls,per_call,per_byte,unit
+ *	-r compares with an earlier output - this run, or a second file - and prints the change.
+ *	The exit code is 1 if anything got slower than -p percent (default 10).
+ *
+ *	Usage: vcp_bench [-r baseline.csv [-p percent] [new.csv]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vcp_library.h"
+#include "crclib.h"
+#include "arq.h"
+
+#ifdef __AVR__
+	#include <avr/io.h>
+	#include <avr/interrupt.h>
+	#include <avr/sleep.h>
+#else
+	#include <time.h>
+	#include <unistd.h>
+#endif
+
+#define BENCH_PAYLOAD		ARQ_MAX_PAYLOAD				///< Largest payload, as on the radio link
+#define BENCH_FRAME_BUFF	(2 * BENCH_PAYLOAD + 8)		///< Encoded frame, every byte escaped
+#define BENCH_ROUNDS		5							///< Host: timed rounds, the best one counts
+#define BENCH_ROUND_NS		20000000.0					///< Host: length of a round, ns
+#define BENCH_LINE			128							///< Longest CSV line
+
+/// Workload
+typedef struct {
+	const char *	name;								///< Workload name
+	uint8_t			payload[BENCH_PAYLOAD + 2];			///< Payload, 2 spare bytes for the CRC
+	uint16_t		size;								///< Payload size
+	uint8_t			frame[BENCH_FRAME_BUFF];			///< Encoded frame
+	uint16_t		frame_size;							///< Encoded size
+} workload_t;
+
+static workload_t		workloads[3];
+static uint8_t			decoded[BENCH_FRAME_BUFF];		///< Receive_VCP_byte buffer
+static volatile uint16_t	sink;						///< Results go here, so nothing is optimised away
+
+/**
+ * Name         : workloads_init
+ *
+ * Synopsis     : static void workloads_init (void)
+ *
+ * Description  : Build the workload payloads and their encoded frames
+ */
+static void workloads_init (void)
+{
+	workload_t *	w;
+
+	w = &workloads[0];
+	w->name =	"escape";
+	w->size =	BENCH_PAYLOAD;
+	for (uint16_t i = 0; i < w->size; i++)
+		w->payload[i] = (i & 1) ? FESC : FEND;
+
+	// Telemetry - 16 bit counters MSB first, status bytes, a few escapes from the counters
+	w = &workloads[1];
+	w->name =	"telemetry";
+	w->size =	BENCH_PAYLOAD;
+	for (uint16_t i = 0; i < w->size; i += 4)
+	{
+		uint16_t counter = i * 97 + 3;
+
+		w->payload[i] =		counter >> 8;
+		w->payload[i + 1] =	counter & 0xFF;
+		w->payload[i + 2] =	(i / 4) & 0x03;
+		w->payload[i + 3] =	0x00;
+	}
+
+	w = &workloads[2];
+	w->name =	"minimum";
+	w->size =	1;
+	w->payload[0] = 0x42;
+
+	for (w = workloads; w < workloads + 3; w++)
+	{
+		w->frame_size = sizeof(w->frame);
+		Create_VCP_frame(w->frame, &w->frame_size, VCP_RADIOIB_1, w->payload, w->size);
+	}
+}
+
+/// Benchmarked calls - one call of a function on a workload
+static void call_create (workload_t *w)
+{
+	uint16_t size = sizeof(w->frame);
+
+	Create_VCP_frame(w->frame, &size, VCP_RADIOIB_1, w->payload, w->size);
+	sink = size;
+}
+
+static void call_receive (workload_t *w)
+{
+	vcp_ptrbuffer	vcp;
+	uint8_t			status = VCP_IDLE;
+
+	vcpptr_init(&vcp, decoded, sizeof(decoded));
+	for (uint16_t i = 0; i < w->frame_size; i++)
+		status = Receive_VCP_byte(&vcp, w->frame[i]);
+	sink = status;
+}
+
+static void call_crc16 (workload_t *w)
+{
+	sink = crc16(w->payload, w->size);
+}
+
+static void call_append_crc16 (workload_t *w)
+{
+	uint16_t crc = CRC16_INIT_VALUE;
+
+	for (uint16_t i = 0; i < w->size; i++)
+		append_crc16(w->payload[i], &crc);
+	sink = crc;
+}
+
+/// Benchmarked function
+typedef struct {
+	const char *	name;
+	void			(*call)(workload_t *w);
+	uint8_t			encoded;							///< Works on the encoded frame - per byte of the frame
+} bench_t;
+
+static const bench_t benches[] = {
+	{	"Create_VCP_frame",		call_create,		0	},
+	{	"Receive_VCP_byte",		call_receive,		1	},
+	{	"crc16",				call_crc16,			0	},
+	{	"append_crc16",			call_append_crc16,	0	},
+};
+
+#ifdef __AVR__
+
+/**
+ * Name         : bench_putc
+ *
+ * Synopsis     : static int bench_putc (char c, FILE *stream)
+ *
+ * Description  : stdout on USART0. Plain \n line ends, simavr prints a line on each
+ */
+static int bench_putc (char c, FILE *stream)
+{
+	(void)stream;
+	while (!(UCSR0A & _BV(UDRE0)))
+		;
+	UDR0 = c;
+	return 0;
+}
+
+static FILE bench_stdout = FDEV_SETUP_STREAM(bench_putc, NULL, _FDEV_SETUP_WRITE);
+
+/**
+ * Name         : bench_cycles
+ *
+ * Synopsis     : static uint32_t bench_cycles (const bench_t *b, workload_t *w)
+ *
+ * Description  : CPU cycles of one call, from Timer1 at clk/1. One counter overflow is allowed for
+ *
+ * \return		Cycles, with the cost of the measurement itself
+ */
+static uint32_t bench_cycles (const bench_t *b, workload_t *w)
+{
+	uint32_t cycles;
+
+	TCNT1 =		0;
+	TIFR1 =		_BV(TOV1);
+	b->call(w);
+	cycles = TCNT1;
+	if (TIFR1 & _BV(TOV1))
+		cycles += 0x10000;
+	return cycles;
+}
+
+/// Empty call, for the cost of the measurement
+static void call_none (workload_t *w)
+{
+	(void)w;
+}
+
+int main (void)
+{
+	static const bench_t	none = { "none", call_none, 0 };
+	uint32_t				overhead;
+
+	// USART0 9600 8N1 at 16 MHz
+	UBRR0 =		103;
+	UCSR0C =	_BV(UCSZ01) | _BV(UCSZ00);
+	UCSR0B =	_BV(TXEN0);
+	stdout =	&bench_stdout;
+
+	// Timer1 normal mode, clk/1
+	TCCR1A =	0;
+	TCCR1B =	_BV(CS10);
+
+	workloads_init();
+	overhead = bench_cycles(&none, workloads);
+
+	printf("#platform,function,workload,bytes,calls,per_call,per_byte,unit\n");
+	for (const bench_t *b = benches; b < benches + sizeof(benches) / sizeof(benches[0]); b++)
+	{
+		for (workload_t *w = workloads; w < workloads + 3; w++)
+		{
+			uint16_t	bytes = b->encoded ? w->frame_size : w->size;
+			uint32_t	cycles = bench_cycles(b, w) - overhead;
+			uint32_t	per_byte = cycles * 100 / bytes;
+
+			// Cycles are exact - one call is enough
+			printf("avr,%s,%s,%u,1,%lu,%lu.%02u,cycles\n", b->name, w->name, bytes,
+				   (unsigned long)cycles, (unsigned long)(per_byte / 100), (unsigned)(per_byte % 100));
+		}
+	}
+
+	// Done - a simulator stops on sleep with the interrupts off
+	while (!(UCSR0A & _BV(TXC0)))
+		;
+	cli();
+	sleep_enable();
+	sleep_cpu();
+	return 0;
+}
+
+#else
+
+/**
+ * Name         : now_ns
+ *
+ * Synopsis     : static double now_ns (void)
+ *
+ * \return		Monotonic time in ns
+ */
+static double now_ns (void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/**
+ * Name         : bench_ns
+ *
+ * Synopsis     : static double bench_ns (const bench_t *b, workload_t *w, long *calls)
+ *
+ * Description  : Time a function on a workload - calls per round from a calibration run,
+ *				  the best round of BENCH_ROUNDS
+ *
+ * \return		ns per call
+ */
+static double bench_ns (const bench_t *b, workload_t *w, long *calls)
+{
+	double	best = 0, t0;
+	long	n = 1;
+
+	// Calibrate - double the calls until a run takes a tenth of a round
+	for (;;)
+	{
+		t0 = now_ns();
+		for (long i = 0; i < n; i++)
+			b->call(w);
+		if (now_ns() - t0 > BENCH_ROUND_NS / 10)
+			break;
+		n *= 2;
+	}
+	n *= 10;
+
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		double ns;
+
+		t0 = now_ns();
+		for (long i = 0; i < n; i++)
+			b->call(w);
+		ns = (now_ns() - t0) / n;
+		if (round == 0 || ns < best)
+			best = ns;
+	}
+
+	*calls = n * BENCH_ROUNDS;
+	return best;
+}
+
+/**
+ * Name         : run
+ *
+ * Synopsis     : static int run (FILE *out)
+ *
+ * Description  : Run all the benchmarks and write the CSV lines
+ *
+ * \return		0
+ */
+static int run (FILE *out)
+{
+#ifdef COMP_PLATFORM
+	const char *	platform = "host-table";
+#else
+	const char *	platform = "host-mcu";
+#endif
+
+	workloads_init();
+
+	fprintf(out, "#platform,function,workload,bytes,calls,per_call,per_byte,unit\n");
+	for (const bench_t *b = benches; b < benches + sizeof(benches) / sizeof(benches[0]); b++)
+	{
+		for (workload_t *w = workloads; w < workloads + 3; w++)
+		{
+			uint16_t	bytes = b->encoded ? w->frame_size : w->size;
+			long		calls;
+			double		ns = bench_ns(b, w, &calls);
+
+			fprintf(out, "%s,%s,%s,%u,%ld,%.2f,%.3f,ns\n", platform, b->name, w->name, bytes, calls, ns, ns / bytes);
+			fflush(out);
+		}
+	}
+	return 0;
+}
+
+/// One CSV line
+typedef struct {
+	char			key[BENCH_LINE];					///< platform,function,workload
+	double			per_call;							///< ns or cycles per call
+} result_t;
+
+/**
+ * Name         : load
+ *
+ * Synopsis     : static int load (FILE *in, result_t *results, int max)
+ *
+ * Description  : Read the results from a CSV output
+ *
+ * \return		Number of results
+ */
+static int load (FILE *in, result_t *results, int max)
+{
+	char	line[BENCH_LINE];
+	int		n = 0;
+
+	while (n < max && fgets(line, sizeof(line), in))
+	{
+		char *	field = line;
+
+		if (line[0] == '#')
+			continue;
+
+		// Key is the first 3 fields, per_call the 6th
+		for (int i = 0; i < 5 && field; i++)
+		{
+			field = strchr(field, ',');
+			if (field && i == 2)
+			{
+				*field = '\0';
+				strcpy(results[n].key, line);
+			}
+			if (field)
+				field++;
+		}
+		if (field == NULL)
+			continue;
+		results[n++].per_call = atof(field);
+	}
+	return n;
+}
+
+/**
+ * Name         : compare
+ *
+ * Synopsis     : static int compare (const char *baseline, const char *current, double percent)
+ *
+ * Description  : Compare a CSV output with a baseline, print the change of each result
+ *
+ * \return		1 if anything got slower than percent, 0 otherwise, 2 on error
+ */
+static int compare (const char *baseline, const char *current, double percent)
+{
+	static result_t	old[64], new[64];
+	FILE *			in;
+	int				n_old, n_new, slower = 0;
+
+	if ((in = fopen(baseline, "r")) == NULL)
+	{
+		perror(baseline);
+		return 2;
+	}
+	n_old = load(in, old, 64);
+	fclose(in);
+
+	if (current)
+	{
+		if ((in = fopen(current, "r")) == NULL)
+		{
+			perror(current);
+			return 2;
+		}
+	}
+	else
+	{
+		// Compare with this run
+		if ((in = tmpfile()) == NULL)
+		{
+			perror("tmpfile");
+			return 2;
+		}
+		run(in);
+		rewind(in);
+	}
+	n_new = load(in, new, 64);
+	fclose(in);
+
+	printf("%-44s %12s %12s %8s\n", "benchmark", "baseline", "now", "change");
+	for (int i = 0; i < n_new; i++)
+	{
+		for (int j = 0; j < n_old; j++)
+		{
+			double change;
+
+			if (strcmp(new[i].key, old[j].key) || old[j].per_call <= 0)
+				continue;
+
+			change = (new[i].per_call / old[j].per_call - 1) * 100;
+			printf("%-44s %12.2f %12.2f %+7.1f%%%s\n", new[i].key, old[j].per_call, new[i].per_call, change,
+				   change > percent ? "  slower" : "");
+			if (change > percent)
+				slower = 1;
+		}
+	}
+	return slower;
+}
+
+int main (int argc, char **argv)
+{
+	const char *	baseline = NULL;
+	double			percent = 10;
+	int				opt;
+
+	while ((opt = getopt(argc, argv, "r:p:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'r':	baseline =	optarg;			break;
+			case 'p':	percent =	atof(optarg);	break;
+			default:
+				fprintf(stderr, "usage: %s [-r baseline.csv [-p percent] [new.csv]]\n", argv[0]);
+				return 2;
+		}
+	}
+
+	if (baseline)
+		return compare(baseline, optind < argc ? argv[optind] : NULL, percent);
+	return run(stdout);
+}
+
+#endif
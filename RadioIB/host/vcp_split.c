@@ -0,0 +1,698 @@
+/** \file
+ * vcp_split.c
+ * \brief Splits captured VCP byte streams into frames, with the bulk codec
+ *
+ *	Split mode reads a VCP byte stream (a pass archive, a capture file or stdin) a megabyte at
+ *	a time through vcp_stream.c and prints one line per good frame - the address and the payload
+ *	in hex, -r the payload bytes only - and the frame and error counts on stderr.
+ *	-a keeps the frames of one address, -q only counts. -k picks the kernel (scalar, sse2, avx2),
+ *	-f the frame buffer size, as given to vcpptr_init().
+ *
+ *	Test mode (-t) decodes random streams - frames, noise, bit errors, bad escapes and addresses,
+ *	long frames, in random pieces - with every kernel and with Receive_VCP_byte(), and encodes
+ *	random payloads with every kernel and with Create_VCP_frame(), and checks every CRC engine
+ *	(crc16_host.c) and the CRC combine with append_crc16(). Any difference is printed and the
+ *	exit code is 1.
+ *
+ *	Benchmark mode (-b) prints the decode and encode speed of every kernel and of the byte-wise
+ *	codec on a stream of frames (payload size -s, FEND / FESC share -x), in MB/s. Then the CRC
+ *	speed of crclib.c crc16() and of every crc16_host.c engine, and of the fastest engine in -j
+ *	threads, each on its part of the buffer (default a thread per CPU).
+ *
+ *	Usage: vcp_split [-k kernel] [-f frame buffer] [-a address] [-q | -r] [stream] > frames
+ *	       vcp_split -t [-n streams]
+ *	       vcp_split -b [-m MB] [-s payload size] [-x escape share] [-j CRC threads]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "vcp_stream.h"
+#include "crc16_host.h"
+#include "crclib.h"
+
+#define SPLIT_CHUNK			(1 << 20)		///< Bytes read at a time
+#define SPLIT_FRAME_BUFF	4096			///< Default frame buffer size
+#define TEST_STREAM			65536			///< Largest test stream
+#define TEST_EVENTS			8192			///< Most events kept per test stream
+#define BENCH_PAYLOADS		256				///< Different payloads in the benchmark stream
+#define BENCH_THREADS		64				///< Most CRC benchmark threads
+
+/// Split mode options and output
+typedef struct {
+	int				address;				///< Address to keep, -1 for all
+	int				quiet;					///< Count only
+	int				raw;					///< Payload bytes instead of hex lines
+} split_t;
+
+/// Frame or error, for the comparison in test mode
+typedef struct {
+	uint8_t			status;
+	uint8_t			address;
+	uint32_t		size;					///< VCP_TERM only
+	uint64_t		offset;
+	uint32_t		hash;					///< FNV-1a of the payload, VCP_TERM only
+} event_t;
+
+/// Event list
+typedef struct {
+	event_t			event[TEST_EVENTS];
+	int				count;
+} events_t;
+
+/// Part of a buffer for a CRC thread
+typedef struct {
+	pthread_t		thread;
+	const uint8_t *	data;
+	size_t			size;
+	uint16_t		crc;					///< CRC of the part, from CRC16_INIT_VALUE
+} crc_part_t;
+
+static const char *	error_names[VCP_ESC_ERR + 1] = { "", "", "", "overflow", "crc", "null", "address", "escape" };
+
+/**
+ * Name         : seconds
+ *
+ * Synopsis     : static double seconds (void)
+ *
+ * \return			Monotonic time, s
+ */
+static double seconds (void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * Name         : kernel_by_name
+ *
+ * Synopsis     : static int kernel_by_name (const char *name)
+ *
+ * \return			VCP_STREAM_AUTO..., -1 for an unknown name
+ */
+static int kernel_by_name (const char *name)
+{
+	for (int k = 0; k < VCP_STREAM_KERNELS; k++)
+		if (strcmp(name, vcp_stream_kernel_name(k)) == 0)
+			return k;
+	return -1;
+}
+
+
+/*****************/
+/* Split         */
+/*****************/
+
+/**
+ * Name         : split_frame
+ *
+ * Synopsis     : static void split_frame (void *context, const vcp_stream_frame_t *frame)
+ *
+ * Description  : Print a good frame
+ */
+static void split_frame (void *context, const vcp_stream_frame_t *frame)
+{
+	split_t *	split = context;
+	static char	line[2 * SPLIT_FRAME_BUFF * 16 + 8];
+	static const char hex[] = "0123456789abcdef";
+	char *		c = line;
+
+	if (frame->status != VCP_TERM || split->quiet || (split->address >= 0 && frame->address != split->address))
+		return;
+
+	if (split->raw)
+	{
+		fwrite(frame->data, 1, frame->size, stdout);
+		return;
+	}
+	if (frame->size * 2 + 8 > sizeof(line))
+		return;
+	*c++ = hex[frame->address >> 4];
+	*c++ = hex[frame->address & 0xF];
+	*c++ = ' ';
+	for (uint32_t i = 0; i < frame->size; i++)
+	{
+		*c++ = hex[frame->data[i] >> 4];
+		*c++ = hex[frame->data[i] & 0xF];
+	}
+	*c++ = '\n';
+	fwrite(line, 1, c - line, stdout);
+}
+
+/**
+ * Name         : split
+ *
+ * Synopsis     : static int split (FILE *in, int kernel, uint32_t frame_buff, split_t *options)
+ *
+ * Description  : Split the stream, print the counts and the decode speed on stderr
+ */
+static int split (FILE *in, int kernel, uint32_t frame_buff, split_t *options)
+{
+	static uint8_t	chunk[SPLIT_CHUNK];
+	uint8_t *		frame = malloc(frame_buff);
+	vcp_stream_t	vs;
+	double			t0 = seconds(), t;
+	size_t			n;
+
+	if (frame == NULL)
+		return 1;
+	vcp_stream_init(&vs, kernel, frame, frame_buff);
+	while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0)
+		vcp_stream_decode(&vs, chunk, n, split_frame, options);
+	t = seconds() - t0;
+
+	fprintf(stderr, "%llu bytes, %llu frames, errors:", (unsigned long long)vs.offset, (unsigned long long)vs.frames);
+	for (int e = VCP_OVR_ERR; e <= VCP_ESC_ERR; e++)
+		if (e != VCP_NULL_ERR)
+			fprintf(stderr, " %s %llu", error_names[e], (unsigned long long)vs.errors[e]);
+	fprintf(stderr, ", %s, %.0f MB/s\n", vcp_stream_kernel_name(vs.kernel), t > 0 ? vs.offset / t / 1e6 : 0);
+	free(frame);
+	return 0;
+}
+
+
+/*****************/
+/* Test          */
+/*****************/
+
+/**
+ * Name         : event_add
+ *
+ * Synopsis     : static void event_add (events_t *events, uint8_t status, uint8_t address, const uint8_t *data, uint32_t size, uint64_t offset)
+ */
+static void event_add (events_t *events, uint8_t status, uint8_t address, const uint8_t *data, uint32_t size, uint64_t offset)
+{
+	event_t *	e;
+
+	if (events->count >= TEST_EVENTS)
+		return;
+	e = &events->event[events->count++];
+	memset(e, 0, sizeof(*e));			// Compared whole, padding too
+	e->status =		status;
+	e->address =	address;
+	e->offset =		offset;
+	e->size =		(status == VCP_TERM) ? size : 0;
+	e->hash =		2166136261u;
+	for (uint32_t i = 0; i < e->size; i++)
+		e->hash = (e->hash ^ data[i]) * 16777619u;
+}
+
+/**
+ * Name         : test_event
+ *
+ * Synopsis     : static void test_event (void *context, const vcp_stream_frame_t *frame)
+ */
+static void test_event (void *context, const vcp_stream_frame_t *frame)
+{
+	event_add(context, frame->status, frame->address, frame->data, frame->size, frame->offset);
+}
+
+/**
+ * Name         : reference_decode
+ *
+ * Synopsis     : static void reference_decode (const uint8_t *data, size_t size, uint8_t *frame, uint16_t frame_buff, events_t *events)
+ *
+ * Description  : Receive_VCP_byte() a byte at a time, starting over after a frame or an error
+ *				  and feeding it the FEND that ended the frame again, as lzss_tool does
+ */
+static void reference_decode (const uint8_t *data, size_t size, uint8_t *frame, uint16_t frame_buff, events_t *events)
+{
+	vcp_ptrbuffer	vcp;
+	uint8_t			status;
+
+	vcpptr_init(&vcp, frame, frame_buff);
+	for (size_t i = 0; i < size; i++)
+	{
+		status = Receive_VCP_byte(&vcp, data[i]);
+		if (status == VCP_TERM || (status >= VCP_OVR_ERR && status <= VCP_ESC_ERR))
+		{
+			event_add(events, status, vcp.address, frame, vcp.index, i);
+			vcpptr_init(&vcp, frame, frame_buff);
+			if (data[i] == FEND)
+				Receive_VCP_byte(&vcp, FEND);
+		}
+	}
+}
+
+/**
+ * Name         : random_stream
+ *
+ * Synopsis     : static size_t random_stream (uint8_t *stream, size_t max)
+ *
+ * Description  : Frames with payloads of random bytes, mostly FEND / FESC or none, and between
+ *				  them noise, repeated FENDs, bad escapes, bad addresses and bit errors
+ *
+ * \return			Stream size
+ */
+static size_t random_stream (uint8_t *stream, size_t max)
+{
+	static uint8_t	payload[2 * SPLIT_FRAME_BUFF], frame[4 * SPLIT_FRAME_BUFF + 8];
+	static const uint8_t addresses[] = { VCP_RADIO_1, VCP_CDHIB_1, VCP_RADIOIB_1, VCP_SUN_SENSOR, 0x0E, 0x55, FESC };
+	size_t			size = 0;
+	double			special = drand48() * drand48();
+
+	while (size + sizeof(frame) < max)
+	{
+		uint16_t	psize = (lrand48() % 4) ? lrand48() % 300 : lrand48() % SPLIT_FRAME_BUFF;
+		uint16_t	fsize = sizeof(frame);
+		uint8_t		address = addresses[lrand48() % sizeof(addresses)];
+
+		for (int i = 0; i < psize; i++)
+			payload[i] = (drand48() < special) ? ((lrand48() & 1) ? FEND : FESC) : (uint8_t)lrand48();
+
+		switch (lrand48() % 8)
+		{
+			case 0:		// Noise
+				for (int i = lrand48() % 64; i > 0; i--)
+					stream[size++] = (lrand48() % 4) ? (uint8_t)lrand48() : FEND;
+				break;
+			case 1:		// Bad escape
+				stream[size++] = FEND;
+				stream[size++] = VCP_CDHIB_1;
+				stream[size++] = FESC;
+				stream[size++] = (lrand48() & 1) ? FEND : (uint8_t)lrand48();
+				break;
+			default:	// Frame, sometimes cut short, sometimes without its opening FEND or with bit errors
+				if (VCP_VALID_ADDRESS(address))
+					Create_VCP_frame(frame, &fsize, address, payload, psize);
+				else
+				{
+					frame[0] = FEND;
+					frame[1] = address;
+					frame[2] = FEND;
+					fsize = 3;
+				}
+				if (lrand48() % 8 == 0)
+					fsize = lrand48() % fsize;
+				memcpy(&stream[size], frame, fsize);
+				if (lrand48() % 8 == 0 && fsize > 0)
+					stream[size + lrand48() % fsize] ^= 1 << (lrand48() % 8);
+				size += fsize;
+				if (lrand48() % 4 == 0)
+					stream[size++] = FEND;
+				break;
+		}
+	}
+	return size;
+}
+
+/**
+ * Name         : test_crc
+ *
+ * Synopsis     : static int test_crc (long buffers)
+ *
+ * Description  : Compare every CRC engine with append_crc16() a byte at a time - random sizes,
+ *				  alignments and starting values - and crc16_host_combine() with the CRC of the whole
+ *
+ * \return			Number of differences
+ */
+static int test_crc (long buffers)
+{
+	static uint8_t	data[8192 + 16];
+	int				failures = 0;
+
+	for (long b = 0; b < buffers; b++)
+	{
+		size_t		offset = lrand48() % 16;
+		size_t		size = (lrand48() % 4) ? lrand48() % 300 : lrand48() % 8192;
+		size_t		split = size ? lrand48() % (size + 1) : 0;
+		uint16		ref = (lrand48() % 2) ? CRC16_INIT_VALUE : (uint16)lrand48();
+		uint16_t	start = ref, whole, a, c;
+
+		for (size_t i = 0; i < size; i++)
+			data[offset + i] = (uint8_t)lrand48();
+		for (size_t i = 0; i < size; i++)
+			append_crc16(data[offset + i], &ref);
+
+		for (int e = CRC16_HOST_TABLE; e < CRC16_HOST_ENGINES; e++)
+		{
+			if (!crc16_host_engine(e))
+				continue;
+			whole = crc16_host(e, start, &data[offset], size);
+			if (whole != ref)
+			{
+				printf("crc %zu bytes at +%zu from 0x%04x, %s: 0x%04x, reference 0x%04x\n", size, offset, start, crc16_host_engine_name(e), whole, ref);
+				failures++;
+			}
+		}
+
+		a = crc16_host(CRC16_HOST_AUTO, start, &data[offset], split);
+		c = crc16_host_combine(a, crc16_host(CRC16_HOST_AUTO, CRC16_INIT_VALUE, &data[offset + split], size - split), size - split);
+		if (c != ref)
+		{
+			printf("crc combine %zu + %zu bytes: 0x%04x, reference 0x%04x\n", split, size - split, c, ref);
+			failures++;
+		}
+	}
+
+	for (int e = CRC16_HOST_TABLE; e < CRC16_HOST_ENGINES; e++)
+		printf("%-8s %s\n", crc16_host_engine_name(e), crc16_host_engine(e) ? "tested" : "not on this CPU");
+	printf("%ld crc buffers, %d differences\n", buffers, failures);
+	return failures;
+}
+
+/**
+ * Name         : test
+ *
+ * Synopsis     : static int test (long streams)
+ *
+ * Description  : Compare every kernel with the byte-wise codec on random streams and payloads,
+ *				  and every CRC engine with append_crc16()
+ *
+ * \return			Number of differences
+ */
+static int test (long streams)
+{
+	static uint8_t	stream[TEST_STREAM], frame[TEST_STREAM], payload[SPLIT_FRAME_BUFF + 2];
+	static uint8_t	ref_frame[2 * SPLIT_FRAME_BUFF + 8], enc_frame[VCP_STREAM_ENCODED_MAX(SPLIT_FRAME_BUFF)];
+	static events_t	ref, got;
+	vcp_stream_t	vs;
+	long			events = 0, bytes = 0;
+	int				failures = 0;
+
+	srand48(1);
+	for (long s = 0; s < streams; s++)
+	{
+		size_t		size = random_stream(stream, sizeof(stream));
+		uint16_t	frame_buff = (lrand48() % 4) ? 2 + lrand48() % 600 : SPLIT_FRAME_BUFF;
+
+		ref.count = 0;
+		reference_decode(stream, size, frame, frame_buff, &ref);
+		events += ref.count;
+		bytes += size;
+
+		for (int k = VCP_STREAM_SCALAR; k < VCP_STREAM_KERNELS; k++)
+		{
+			if (!vcp_stream_kernel(k))
+				continue;
+			got.count = 0;
+			vcp_stream_init(&vs, k, frame, frame_buff);
+			for (size_t pos = 0, n; pos < size; pos += n)
+			{
+				n = (lrand48() % 2) ? 1 + lrand48() % 100 : 1 + lrand48() % 5000;
+				if (n > size - pos)
+					n = size - pos;
+				vcp_stream_decode(&vs, &stream[pos], n, test_event, &got);
+			}
+			if (got.count != ref.count || memcmp(got.event, ref.event, ref.count * sizeof(event_t)))
+			{
+				int	i = 0;
+
+				while (i < ref.count && i < got.count && memcmp(&got.event[i], &ref.event[i], sizeof(event_t)) == 0)
+					i++;
+				printf("stream %ld (%zu bytes, frame buffer %u), %s: %d events, reference %d, first difference at event %d\n",
+					   s, size, frame_buff, vcp_stream_kernel_name(k), got.count, ref.count, i);
+				failures++;
+			}
+		}
+
+		// Encoder
+		for (int f = 0; f < 64; f++)
+		{
+			uint16_t	psize = lrand48() % (SPLIT_FRAME_BUFF + 1);
+			uint16_t	fsize = sizeof(ref_frame);
+			double		special = drand48();
+
+			for (int i = 0; i < psize; i++)
+				payload[i] = (drand48() < special) ? ((lrand48() & 1) ? FEND : FESC) : (uint8_t)lrand48();
+			Create_VCP_frame(ref_frame, &fsize, VCP_RADIOIB_1, payload, psize);
+
+			for (int k = VCP_STREAM_SCALAR; k < VCP_STREAM_KERNELS; k++)
+			{
+				size_t	esize;
+
+				if (!vcp_stream_kernel(k))
+					continue;
+				esize = vcp_stream_encode(k, enc_frame, VCP_RADIOIB_1, payload, psize);
+				if (esize != fsize || memcmp(enc_frame, ref_frame, fsize))
+				{
+					printf("encode %u bytes, %s: %zu bytes, reference %u\n", psize, vcp_stream_kernel_name(k), esize, fsize);
+					failures++;
+				}
+			}
+		}
+	}
+
+	for (int k = VCP_STREAM_SCALAR; k < VCP_STREAM_KERNELS; k++)
+		printf("%-8s %s\n", vcp_stream_kernel_name(k), vcp_stream_kernel(k) ? "tested" : "not on this CPU");
+	printf("%ld streams, %ld bytes, %ld frames and errors, %d differences\n", streams, bytes, events, failures);
+	return failures + test_crc(streams * 50);
+}
+
+
+/*****************/
+/* Benchmark     */
+/*****************/
+
+/**
+ * Name         : benchmark
+ *
+ * Synopsis     : static void benchmark (size_t megabytes, int payload_size, double special)
+ *
+ * Description  : Decode and encode speed of every kernel and of the byte-wise codec
+ */
+static void benchmark (size_t megabytes, int payload_size, double special)
+{
+	size_t			max = megabytes << 20, size = 0, payloads = 0;
+	uint8_t *		stream = malloc(max + VCP_STREAM_ENCODED_MAX(payload_size));
+	uint8_t *		out = malloc(max + VCP_STREAM_ENCODED_MAX(payload_size));
+	size_t			slot = payload_size + 2;		// 2 spare bytes for Create_VCP_frame
+	uint8_t *		payload = malloc(BENCH_PAYLOADS * slot);
+	static uint8_t	frame[SPLIT_FRAME_BUFF];
+	vcp_stream_t	vs;
+	double			t;
+
+	if (stream == NULL || out == NULL || payload == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	srand48(1);
+	for (size_t i = 0; i < BENCH_PAYLOADS * slot; i++)
+		payload[i] = (drand48() < special) ? ((lrand48() & 1) ? FEND : FESC) : (uint8_t)(lrand48() % 0xC0);
+	while (size < max)
+	{
+		size += vcp_stream_encode(VCP_STREAM_SCALAR, &stream[size], VCP_RADIO_1, &payload[(payloads % BENCH_PAYLOADS) * slot], payload_size);
+		payloads++;
+	}
+
+	printf("# %zu MB stream, %d byte payloads, %.4f FEND / FESC share\n", megabytes, payload_size, special);
+	printf("%-10s %10s %10s %10s\n", "codec", "frames", "dec_MB/s", "enc_MB/s");
+
+	for (int k = VCP_STREAM_SCALAR; k <= VCP_STREAM_KERNELS; k++)
+	{
+		double		decode_mbs, encode_mbs;
+		uint64_t	frames;
+
+		if (k < VCP_STREAM_KERNELS)
+		{
+			if (!vcp_stream_kernel(k))
+				continue;
+			vcp_stream_init(&vs, k, frame, sizeof(frame));
+			t = seconds();
+			vcp_stream_decode(&vs, stream, size, NULL, NULL);
+			decode_mbs = size / (seconds() - t) / 1e6;
+			frames = vs.frames;
+
+			t = seconds();
+			for (size_t i = 0, o = 0; i < payloads; i++)
+				o += vcp_stream_encode(k, &out[o], VCP_RADIO_1, &payload[(i % BENCH_PAYLOADS) * slot], payload_size);
+			encode_mbs = (double)payloads * payload_size / (seconds() - t) / 1e6;
+		}
+		else
+		{
+			// Byte-wise codec, as the tools used it before
+			vcp_ptrbuffer	vcp;
+
+			frames = 0;
+			vcpptr_init(&vcp, frame, sizeof(frame));
+			t = seconds();
+			for (size_t i = 0; i < size; i++)
+			{
+				uint8_t status = Receive_VCP_byte(&vcp, stream[i]);
+
+				if (status != VCP_IDLE && status != VCP_ADDRESS && status != VCP_RECEIVING && status != VCP_ESC)
+				{
+					frames += (status == VCP_TERM);
+					vcpptr_init(&vcp, frame, sizeof(frame));
+					if (stream[i] == FEND)
+						Receive_VCP_byte(&vcp, FEND);
+				}
+			}
+			decode_mbs = size / (seconds() - t) / 1e6;
+
+			t = seconds();
+			for (size_t i = 0, o = 0; i < payloads; i++)
+			{
+				uint16_t	fsize = VCP_STREAM_ENCODED_MAX(payload_size);
+
+				Create_VCP_frame(&out[o], &fsize, VCP_RADIO_1, &payload[(i % BENCH_PAYLOADS) * slot], payload_size);
+				o += fsize;
+			}
+			encode_mbs = (double)payloads * payload_size / (seconds() - t) / 1e6;
+		}
+
+		printf("%-10s %10llu %10.0f %10.0f\n", (k < VCP_STREAM_KERNELS) ? vcp_stream_kernel_name(k) : "bytewise",
+			   (unsigned long long)frames, decode_mbs, encode_mbs);
+	}
+
+	free(stream);
+	free(out);
+	free(payload);
+}
+
+/**
+ * Name         : crc_thread
+ *
+ * Synopsis     : static void *crc_thread (void *context)
+ */
+static void *crc_thread (void *context)
+{
+	crc_part_t *	part = context;
+
+	part->crc = crc16_host(CRC16_HOST_AUTO, CRC16_INIT_VALUE, part->data, part->size);
+	return NULL;
+}
+
+/**
+ * Name         : benchmark_crc
+ *
+ * Synopsis     : static void benchmark_crc (size_t megabytes, int threads)
+ *
+ * Description  : CRC speed of crc16() (crclib.c), of every engine and of the fastest engine on
+ *				  parts of the buffer in threads, put together with crc16_host_combine()
+ */
+static void benchmark_crc (size_t megabytes, int threads)
+{
+	static crc_part_t	parts[BENCH_THREADS];
+	size_t				size = megabytes << 20;
+	uint8_t *			data = malloc(size);
+	uint16_t			crc, ref;
+	double				t;
+
+	if (data == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+	for (size_t i = 0; i < size; i++)
+		data[i] = (uint8_t)lrand48();
+
+	printf("# %zu MB CRC\n", megabytes);
+	printf("%-10s %10s %10s\n", "crc", "value", "MB/s");
+
+	t = seconds();
+	ref = crc16(data, size);
+	printf("%-10s %10s %10.0f\n", "crclib", "", size / (seconds() - t) / 1e6);
+
+	for (int e = CRC16_HOST_TABLE; e < CRC16_HOST_ENGINES; e++)
+	{
+		if (!crc16_host_engine(e))
+			continue;
+		t = seconds();
+		crc = crc16_host(e, CRC16_INIT_VALUE, data, size);
+		printf("%-10s %10s %10.0f\n", crc16_host_engine_name(e), (crc == ref) ? "same" : "DIFFERENT", size / (seconds() - t) / 1e6);
+	}
+
+	// The fastest engine in threads, the parts combined in order
+	t = seconds();
+	for (int i = 0; i < threads; i++)
+	{
+		parts[i].data =	data + size / threads * i;
+		parts[i].size =	(i == threads - 1) ? size - size / threads * i : size / threads;
+		pthread_create(&parts[i].thread, NULL, crc_thread, &parts[i]);
+	}
+	crc = CRC16_INIT_VALUE;
+	for (int i = 0; i < threads; i++)
+	{
+		pthread_join(parts[i].thread, NULL);
+		crc = crc16_host_combine(crc, parts[i].crc, parts[i].size);
+	}
+	printf("%-7s x%-2d %10s %10.0f\n", crc16_host_engine_name(crc16_host_engine(CRC16_HOST_AUTO)), threads,
+		   (crc == ref) ? "same" : "DIFFERENT", size / (seconds() - t) / 1e6);
+
+	free(data);
+}
+
+int main (int argc, char **argv)
+{
+	split_t		options = { -1, 0, 0 };
+	int			mode = 0, kernel = VCP_STREAM_AUTO, payload_size = 200, threads = sysconf(_SC_NPROCESSORS_ONLN), opt;
+	long		streams = 200, megabytes = 64, frame_buff = SPLIT_FRAME_BUFF;
+	double		special = 2.0 / 256;
+	FILE *		in = stdin;
+	int			result;
+
+	while ((opt = getopt(argc, argv, "a:bf:j:k:m:n:qrs:tx:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'a':	options.address = strtol(optarg, NULL, 0);	break;
+			case 'b':	mode = 'b';									break;
+			case 'f':	frame_buff = atol(optarg);					break;
+			case 'j':	threads = atoi(optarg);						break;
+			case 'k':	kernel = kernel_by_name(optarg);			break;
+			case 'm':	megabytes = atol(optarg);					break;
+			case 'n':	streams = atol(optarg);						break;
+			case 'q':	options.quiet = 1;							break;
+			case 'r':	options.raw = 1;							break;
+			case 's':	payload_size = atoi(optarg);				break;
+			case 't':	mode = 't';									break;
+			case 'x':	special = atof(optarg);						break;
+			default:
+				fprintf(stderr, "usage: %s [-k kernel] [-f frame buffer] [-a address] [-q | -r] [stream] > frames\n"
+								"       %s -t [-n streams]\n"
+								"       %s -b [-m MB] [-s payload size] [-x escape share] [-j CRC threads]\n", argv[0], argv[0], argv[0]);
+				return 1;
+		}
+	}
+
+	if (kernel < 0 || !vcp_stream_kernel(kernel))
+	{
+		fprintf(stderr, "kernel must be one this CPU has:");
+		for (int k = VCP_STREAM_AUTO; k < VCP_STREAM_KERNELS; k++)
+			if (vcp_stream_kernel(k))
+				fprintf(stderr, " %s", vcp_stream_kernel_name(k));
+		fprintf(stderr, "\n");
+		return 1;
+	}
+
+	if (mode == 't')
+		return test(streams) ? 1 : 0;
+
+	if (mode == 'b')
+	{
+		if (payload_size < 1 || payload_size > SPLIT_FRAME_BUFF - 3 || megabytes < 1)
+		{
+			fprintf(stderr, "payload size must be 1 to %d\n", SPLIT_FRAME_BUFF - 3);
+			return 1;
+		}
+		if (threads < 1 || threads > BENCH_THREADS)
+			threads = (threads < 1) ? 1 : BENCH_THREADS;
+		benchmark(megabytes, payload_size, special);
+		benchmark_crc(megabytes, threads);
+		return 0;
+	}
+
+	if (frame_buff < 2 || frame_buff > SPLIT_FRAME_BUFF * 16)
+	{
+		fprintf(stderr, "frame buffer must be 2 to %d\n", SPLIT_FRAME_BUFF * 16);
+		return 1;
+	}
+	if (optind < argc && (in = fopen(argv[optind], "rb")) == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+	result = split(in, kernel, frame_buff, &options);
+	if (in != stdin)
+		fclose(in);
+	return result;
+}
@@ -0,0 +1,513 @@
+/** \file
+ * vcp_stream.c
+ * \brief Bulk VCP codec for the host tools
+ *
+ *	See vcp_stream.h. A kernel does one thing - copy the bytes up to the next FEND / FESC -
+ *	and the decoder state machine around it is the one of Receive_VCP_byte(), a run at a time.
+ */
+
+#include <string.h>
+
+#include "vcp_stream.h"
+#include "crc16_host.h"
+#include "crclib.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define VCP_STREAM_X86
+#endif
+
+/// Kernel
+typedef struct {
+	const char *	name;
+	/// Copy src to dst up to the first FEND / FESC (FEND only, without escapes), at most n bytes. Returns the bytes copied
+	size_t			(*copy_run)	(uint8_t *dst, const uint8_t *src, size_t n, int escapes);
+} kernel_t;
+
+#define VCP_STREAM_DENSE	16		///< Runs shorter than this - the next bytes go a byte at a time
+
+
+
+/*****************/
+/* Kernels       */
+/*****************/
+
+/**
+ * Name         : copy_run_scalar
+ *
+ * Synopsis     : static size_t copy_run_scalar (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+ *
+ * Description  : A byte at a time. dst NULL - find the run only
+ */
+static size_t copy_run_scalar (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+{
+	const uint8_t	fesc = escapes ? FESC : FEND;
+	size_t			i;
+
+	for (i = 0; i < n && src[i] != FEND && src[i] != fesc; i++)
+		if (dst)
+			dst[i] = src[i];
+	return i;
+}
+
+#ifdef VCP_STREAM_X86
+
+/**
+ * Name         : copy_run_sse2
+ *
+ * Synopsis     : static size_t copy_run_sse2 (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+ *
+ * Description  : 16 bytes at a time - compare with FEND and FESC, store the block whole (it is
+ *				  inside dst[n]), stop at the first set bit of the mask. The tail is scalar
+ */
+__attribute__((target("sse2")))
+static size_t copy_run_sse2 (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+{
+	const __m128i	fend = _mm_set1_epi8((char)FEND);
+	const __m128i	fesc = _mm_set1_epi8((char)(escapes ? FESC : FEND));
+	size_t			i;
+
+	// Escapes close together - don't load a block for a run of none
+	if (n == 0 || src[0] == FEND || src[0] == (escapes ? FESC : FEND))
+		return 0;
+	for (i = 0; i + 16 <= n; i += 16)
+	{
+		__m128i		v = _mm_loadu_si128((const __m128i *)(src + i));
+		unsigned	mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, fend), _mm_cmpeq_epi8(v, fesc)));
+
+		if (dst)
+			_mm_storeu_si128((__m128i *)(dst + i), v);
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+	return i + copy_run_scalar(dst ? dst + i : NULL, src + i, n - i, escapes);
+}
+
+/**
+ * Name         : copy_run_avx2
+ *
+ * Synopsis     : static size_t copy_run_avx2 (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+ *
+ * Description  : 32 bytes at a time, as copy_run_sse2(). The tail goes to copy_run_sse2()
+ */
+__attribute__((target("avx2")))
+static size_t copy_run_avx2 (uint8_t *dst, const uint8_t *src, size_t n, int escapes)
+{
+	const __m256i	fend = _mm256_set1_epi8((char)FEND);
+	const __m256i	fesc = _mm256_set1_epi8((char)(escapes ? FESC : FEND));
+	size_t			i;
+
+	if (n == 0 || src[0] == FEND || src[0] == (escapes ? FESC : FEND))
+		return 0;
+	for (i = 0; i + 32 <= n; i += 32)
+	{
+		__m256i		v = _mm256_loadu_si256((const __m256i *)(src + i));
+		unsigned	mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, fend), _mm256_cmpeq_epi8(v, fesc)));
+
+		if (dst)
+			_mm256_storeu_si256((__m256i *)(dst + i), v);
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+	return i + copy_run_sse2(dst ? dst + i : NULL, src + i, n - i, escapes);
+}
+
+#endif
+
+/// Kernel table, indexed by VCP_STREAM_SCALAR...
+static const kernel_t	kernels[VCP_STREAM_KERNELS] = {
+	{	"auto",		copy_run_scalar	},
+	{	"scalar",	copy_run_scalar	},
+#ifdef VCP_STREAM_X86
+	{	"sse2",		copy_run_sse2	},
+	{	"avx2",		copy_run_avx2	},
+#else
+	{	"sse2",		NULL			},
+	{	"avx2",		NULL			},
+#endif
+};
+
+/**
+ * Name         : vcp_stream_kernel
+ *
+ * Synopsis     : uint8_t vcp_stream_kernel (uint8_t kernel)
+ *
+ * \param	kernel	VCP_STREAM_AUTO, VCP_STREAM_SCALAR...
+ *
+ * \return			The kernel that runs - the fastest one for VCP_STREAM_AUTO, 0 if this CPU does not have it
+ */
+uint8_t vcp_stream_kernel (uint8_t kernel)
+{
+	switch (kernel)
+	{
+		case VCP_STREAM_AUTO:
+			if (vcp_stream_kernel(VCP_STREAM_AVX2))
+				return VCP_STREAM_AVX2;
+			if (vcp_stream_kernel(VCP_STREAM_SSE2))
+				return VCP_STREAM_SSE2;
+			return VCP_STREAM_SCALAR;
+		case VCP_STREAM_SCALAR:
+			return kernel;
+#ifdef VCP_STREAM_X86
+		case VCP_STREAM_SSE2:
+			return __builtin_cpu_supports("sse2") ? kernel : 0;
+		case VCP_STREAM_AVX2:
+			return __builtin_cpu_supports("avx2") ? kernel : 0;
+#endif
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Name         : vcp_stream_kernel_name
+ *
+ * Synopsis     : const char *vcp_stream_kernel_name (uint8_t kernel)
+ *
+ * \return			Kernel name, "auto", "scalar"... NULL past the last kernel
+ */
+const char *vcp_stream_kernel_name (uint8_t kernel)
+{
+	return (kernel < VCP_STREAM_KERNELS) ? kernels[kernel].name : NULL;
+}
+
+
+/*****************/
+/* Decoder       */
+/*****************/
+
+/**
+ * Name         : vcp_stream_init
+ *
+ * Synopsis     : void vcp_stream_init (vcp_stream_t *vs, uint8_t kernel, uint8_t *buffer, uint32_t size)
+ *
+ * \param	kernel	VCP_STREAM_AUTO, VCP_STREAM_SCALAR... - the scalar kernel if this CPU does not have it
+ * \param	buffer	Frame buffer
+ * \param	size	Frame buffer size, at least 2. As the size given to vcpptr_init() - frames from
+ *					size - 1 bytes with the CRC are VCP_OVR_ERR
+ *
+ * Description  : Start a decoder, waiting for a FEND
+ */
+void vcp_stream_init (vcp_stream_t *vs, uint8_t kernel, uint8_t *buffer, uint32_t size)
+{
+	memset(vs, 0, sizeof(*vs));
+	vs->kernel =	vcp_stream_kernel(kernel);
+	if (!vs->kernel)
+		vs->kernel = VCP_STREAM_SCALAR;
+	vs->status =	VCP_IDLE;
+	vs->message =	buffer;
+	vs->size =		size;
+}
+
+/**
+ * Name         : vcp_stream_start
+ *
+ * Synopsis     : void vcp_stream_start (vcp_stream_t *vs, uint64_t offset)
+ *
+ * \param	offset	Stream offset of the next byte, just after a FEND
+ *
+ * Description  : Decode from the middle of a stream. After a FEND the decoder is always waiting for
+ *				  an address, whatever came before - a frame, an error or nothing. So parts of a
+ *				  stream cut just after FENDs decode to the same frames as the whole stream
+ */
+void vcp_stream_start (vcp_stream_t *vs, uint64_t offset)
+{
+	vs->status =	VCP_ADDRESS;
+	vs->address =	0;
+	vs->index =		0;
+	vs->offset =	offset;
+}
+
+/**
+ * Name         : stream_restart
+ *
+ * Synopsis     : static void stream_restart (vcp_stream_t *vs, uint8_t byte)
+ *
+ * \param	byte	Byte that ended the frame
+ *
+ * Description  : Start over after a frame or an error. A FEND that ended the frame starts the next one
+ */
+static void stream_restart (vcp_stream_t *vs, uint8_t byte)
+{
+	vs->status =	(byte == FEND) ? VCP_ADDRESS : VCP_IDLE;
+	vs->address =	0;
+	vs->index =		0;
+}
+
+/**
+ * Name         : stream_event
+ *
+ * Synopsis     : static void stream_event (vcp_stream_t *vs, uint8_t status, uint64_t offset, uint32_t size, vcp_stream_fn fn, void *context)
+ *
+ * Description  : Count a frame or an error and give it to the callback
+ */
+static void stream_event (vcp_stream_t *vs, uint8_t status, uint64_t offset, uint32_t size, vcp_stream_fn fn, void *context)
+{
+	vcp_stream_frame_t	frame;
+
+	if (status == VCP_TERM)
+		vs->frames++;
+	else
+		vs->errors[status]++;
+
+	if (fn)
+	{
+		frame.status =	status;
+		frame.address =	vs->address;
+		frame.data =	vs->message;
+		frame.size =	size;
+		frame.offset =	offset;
+		fn(context, &frame);
+	}
+}
+
+/**
+ * Name         : stream_frame_end
+ *
+ * Synopsis     : static void stream_frame_end (vcp_stream_t *vs, uint64_t offset, vcp_stream_fn fn, void *context)
+ *
+ * Description  : FEND after the frame data - check the CRC (the last 2 bytes, MSB first) over the
+ *				  address and the payload
+ */
+static void stream_frame_end (vcp_stream_t *vs, uint64_t offset, vcp_stream_fn fn, void *context)
+{
+	uint32_t	size = vs->index - 2;
+	uint16_t	crc;
+
+	if (vs->index < 2)
+	{
+		stream_event(vs, VCP_CRC_ERR, offset, 0, fn, context);
+		return;
+	}
+
+	crc = crc16_host(CRC16_HOST_AUTO, CRC16_INIT_VALUE, &vs->address, 1);
+	crc = crc16_host(CRC16_HOST_AUTO, crc, vs->message, size);
+
+	if (crc != ((vs->message[size] << 8) | vs->message[size + 1]))
+		stream_event(vs, VCP_CRC_ERR, offset, size, fn, context);
+	else
+		stream_event(vs, VCP_TERM, offset, size, fn, context);
+}
+
+/**
+ * Name         : stream_dense
+ *
+ * Synopsis     : static const uint8_t *stream_dense (vcp_stream_t *vs, const uint8_t *p, const uint8_t *end)
+ *
+ * Description  : Frame data and whole escapes, a byte at a time, for up to 2 * VCP_STREAM_DENSE bytes.
+ *				  Stops before a FEND, an escape cut by the end of data and a full buffer
+ *
+ * \return			The next byte
+ */
+static const uint8_t *stream_dense (vcp_stream_t *vs, const uint8_t *p, const uint8_t *end)
+{
+	const uint8_t *	stop = (end - p > 2 * VCP_STREAM_DENSE) ? p + 2 * VCP_STREAM_DENSE : end;
+	uint8_t *		message = vs->message;
+	uint32_t		index = vs->index, last = vs->size - 1;
+
+	while (p < stop && index < last && *p != FEND)
+	{
+		if (*p != FESC)
+			message[index++] = *p++;
+		else if (p + 1 < end && (p[1] == TFEND || p[1] == TFESC))
+		{
+			message[index++] = (p[1] == TFEND) ? FEND : FESC;
+			p += 2;
+		}
+		else
+			break;
+	}
+	vs->index = index;
+	return p;
+}
+
+/**
+ * Name         : vcp_stream_decode
+ *
+ * Synopsis     : void vcp_stream_decode (vcp_stream_t *vs, const uint8_t *data, size_t size, vcp_stream_fn fn, void *context)
+ *
+ * \param	data	Next part of the stream, any size - frames can span calls
+ * \param	fn		Called for every frame and error, NULL to count them only
+ *
+ * Description  : Decode the stream. The states are those of Receive_VCP_byte(). Waiting for a
+ *				  FEND and receiving the frame data go a run at a time through the kernel; the
+ *				  buffer size check comes first, as in Receive_VCP_byte()
+ */
+void vcp_stream_decode (vcp_stream_t *vs, const uint8_t *data, size_t size, vcp_stream_fn fn, void *context)
+{
+	size_t			(*copy_run)(uint8_t *, const uint8_t *, size_t, int) = kernels[vs->kernel].copy_run;
+	const uint8_t *	p = data;
+	const uint8_t *	end = data + size;
+	size_t			n, run;
+	uint8_t			byte;
+
+#define OFFSET		(vs->offset + (uint64_t)(p - 1 - data))		// of the byte just taken
+
+	while (p < end)
+	{
+		switch (vs->status)
+		{
+			case VCP_IDLE:
+				p += copy_run(NULL, p, end - p, 0);
+				if (p < end)
+				{
+					p++;
+					vs->status = VCP_ADDRESS;
+				}
+				break;
+
+			case VCP_ADDRESS:
+				byte = *p++;
+				if (byte == FEND)
+					break;
+				if (VCP_VALID_ADDRESS(byte))
+				{
+					vs->address =	byte;
+					vs->status =	VCP_RECEIVING;
+				}
+				else
+				{
+					stream_event(vs, VCP_ADDR_ERR, OFFSET, 0, fn, context);
+					stream_restart(vs, byte);
+				}
+				break;
+
+			case VCP_RECEIVING:
+				// Plain bytes up to the next FEND / FESC, as many as the buffer takes
+				n = vs->size - 1 - vs->index;
+				if ((size_t)(end - p) < n)
+					n = end - p;
+				run = copy_run(vs->message + vs->index, p, n, 1);
+				vs->index +=	run;
+				p +=			run;
+				if (p == end)
+					break;
+				byte = *p++;
+				if (vs->index >= vs->size - 1)
+				{
+					stream_event(vs, VCP_OVR_ERR, OFFSET, 0, fn, context);
+					stream_restart(vs, byte);
+				}
+				else if (byte == FESC)
+				{
+					// The usual escape, both bytes here - no trip round the state machine
+					if (p < end && (*p == TFEND || *p == TFESC))
+						vs->message[vs->index++] = (*p++ == TFEND) ? FEND : FESC;
+					else
+					{
+						vs->status = VCP_ESC;
+						break;
+					}
+					// Escapes close together - a byte at a time for a while, a block load finds nothing
+					if (run < VCP_STREAM_DENSE)
+						p = stream_dense(vs, p, end);
+				}
+				else if (vs->index > 0)
+				{
+					stream_frame_end(vs, OFFSET, fn, context);
+					stream_restart(vs, byte);
+				}
+				else
+					vs->status = VCP_ADDRESS;	// No data between FENDs
+				break;
+
+			case VCP_ESC:
+				// No buffer size check - the FESC passed it, with the same index
+				byte = *p++;
+				if (byte == TFEND || byte == TFESC)
+				{
+					vs->message[vs->index++] =	(byte == TFEND) ? FEND : FESC;
+					vs->status =				VCP_RECEIVING;
+				}
+				else
+				{
+					stream_event(vs, VCP_ESC_ERR, OFFSET, 0, fn, context);
+					stream_restart(vs, byte);
+				}
+				break;
+
+			default:
+				vs->status = VCP_IDLE;
+				break;
+		}
+	}
+#undef OFFSET
+
+	vs->offset += size;
+}
+
+
+/*****************/
+/* Encoder       */
+/*****************/
+
+/**
+ * Name         : vcp_stream_encode
+ *
+ * Synopsis     : size_t vcp_stream_encode (uint8_t kernel, uint8_t *dst, uint8_t address, const uint8_t *src, size_t size)
+ *
+ * \param	kernel	VCP_STREAM_AUTO, VCP_STREAM_SCALAR...
+ * \param	dst		Frame, VCP_STREAM_ENCODED_MAX(size) bytes
+ * \param	address	VCP address
+ * \param	src		Payload, left as it is (Create_VCP_frame() appends the CRC to it)
+ *
+ * Description  : Build the VCP frame - FEND, address, payload and CRC escaped, FEND
+ *
+ * \return			Frame size, 0 for an invalid address
+ */
+size_t vcp_stream_encode (uint8_t kernel, uint8_t *dst, uint8_t address, const uint8_t *src, size_t size)
+{
+	size_t			(*copy_run)(uint8_t *, const uint8_t *, size_t, int);
+	uint8_t			crc_bytes[2];
+	const uint8_t *	end = src + size;
+	uint8_t *		d = dst;
+	uint16_t		crc;
+
+	if (!VCP_VALID_ADDRESS(address))
+		return 0;
+	kernel =	vcp_stream_kernel(kernel);
+	copy_run =	kernels[kernel ? kernel : VCP_STREAM_SCALAR].copy_run;
+
+	crc =			crc16_host(CRC16_HOST_AUTO, CRC16_INIT_VALUE, &address, 1);
+	crc =			crc16_host(CRC16_HOST_AUTO, crc, src, size);
+	crc_bytes[0] =	crc >> 8;
+	crc_bytes[1] =	crc & 0xFF;
+
+	*d++ = FEND;
+	*d++ = address;
+	for (int part = 0; part < 2; part++)
+	{
+		while (src < end)
+		{
+			size_t	run = copy_run(d, src, end - src, 1);
+
+			d +=	run;
+			src +=	run;
+			if (src < end)
+			{
+				*d++ = FESC;
+				*d++ = (*src++ == FEND) ? TFEND : TFESC;
+			}
+			if (run < VCP_STREAM_DENSE)
+			{
+				// Escapes close together - a byte at a time for a while
+				const uint8_t *	stop = (end - src > 2 * VCP_STREAM_DENSE) ? src + 2 * VCP_STREAM_DENSE : end;
+
+				for (; src < stop; src++)
+				{
+					if (*src == FEND || *src == FESC)
+					{
+						*d++ = FESC;
+						*d++ = (*src == FEND) ? TFEND : TFESC;
+					}
+					else
+						*d++ = *src;
+				}
+			}
+		}
+		src =	crc_bytes;
+		end =	crc_bytes + 2;
+	}
+	*d++ = FEND;
+	return d - dst;
+}
@@ -0,0 +1,69 @@
+/** \file
+ * vcp_stream.h
+ * \brief Bulk VCP codec for the host tools
+ *
+ *	Decodes a captured VCP byte stream into frames, and encodes frames, many bytes at a time
+ *	instead of one byte per Receive_VCP_byte() call. The kernels find the next FEND / FESC
+ *	16 (SSE2) or 32 (AVX2) bytes at a time, and the bytes in between are copied in bulk. The CRC
+ *	is crc16_host.c. The x86 kernels are picked at run time, on the CPUs that have them; the
+ *	scalar kernel runs everywhere.
+ *
+ *	The results are the same as the byte-wise codec (vcp_library.c), with every kernel:
+ * *	Decoding follows Receive_VCP_byte() as the host tools call it - after a frame or an error the
+ *		decoder starts over, and the FEND that ended the frame may start the next one
+ * *	Encoding gives the frame Create_VCP_frame() does
+ *	vcp_split -t checks this on random streams.
+ */
+
+
+#ifndef VCP_STREAM_H_
+#define VCP_STREAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vcp_library.h"
+
+// Kernels
+#define VCP_STREAM_AUTO		0		///< The fastest kernel this CPU has
+#define VCP_STREAM_SCALAR	1		///< A byte at a time, any CPU
+#define VCP_STREAM_SSE2		2		///< 16 bytes at a time, x86
+#define VCP_STREAM_AVX2		3		///< 32 bytes at a time, x86 with AVX2
+#define VCP_STREAM_KERNELS	4
+
+/// Decoded frame or receive error, for the frame callback
+typedef struct {
+	uint8_t			status;			///< VCP_TERM, or the error - VCP_OVR_ERR...
+	uint8_t			address;		///< VCP address, 0 for VCP_ADDR_ERR and VCP_OVR_ERR before the address
+	const uint8_t *	data;			///< Payload, without the CRC (VCP_TERM and VCP_CRC_ERR)
+	uint32_t		size;			///< Payload size
+	uint64_t		offset;			///< Stream offset of the byte that ended the frame
+} vcp_stream_frame_t;
+
+/// Called for every frame and receive error, in stream order
+typedef void (*vcp_stream_fn)(void *context, const vcp_stream_frame_t *frame);
+
+/// Stream decoder
+typedef struct {
+	uint8_t			kernel;			///< VCP_STREAM_SCALAR...
+	uint8_t			status;			///< VCP_IDLE, VCP_ADDRESS, VCP_RECEIVING or VCP_ESC
+	uint8_t			address;		///< Address of the frame being received
+	uint8_t *		message;		///< Frame buffer
+	uint32_t		size;			///< Frame buffer size, as given to vcpptr_init()
+	uint32_t		index;			///< Bytes in the frame buffer
+	uint64_t		offset;			///< Stream bytes decoded
+	uint64_t		frames;			///< Good frames
+	uint64_t		errors[VCP_ESC_ERR + 1];	///< Receive errors, by VCP_OVR_ERR...
+} vcp_stream_t;
+
+// Functions
+uint8_t		vcp_stream_kernel		(uint8_t kernel);
+const char *vcp_stream_kernel_name	(uint8_t kernel);
+void		vcp_stream_init			(vcp_stream_t *vs, uint8_t kernel, uint8_t *buffer, uint32_t size);
+void		vcp_stream_start		(vcp_stream_t *vs, uint64_t offset);
+void		vcp_stream_decode		(vcp_stream_t *vs, const uint8_t *data, size_t size, vcp_stream_fn fn, void *context);
+size_t		vcp_stream_encode		(uint8_t kernel, uint8_t *dst, uint8_t address, const uint8_t *src, size_t size);
+
+#define VCP_STREAM_ENCODED_MAX(size)	(2 * (size_t)(size) + 7)	///< Largest encoded frame for a payload size
+
+#endif /* VCP_STREAM_H_ */